@@ -6,6 +6,7 @@ import matplotlib.pyplot as plt
 from   pylab import *
 import h5py
 from matplotlib.colors import LogNorm
+from xolotlConcs import readConcentrations
 
 ## Set the Zero
 zero = 1.0e-20
@@ -33,10 +34,6 @@ for i in range(len(name)):
     groupName ='concentrationsGroup/concentration_0_' + str(timestep[i])
     concGroup = f[groupName]
 
-    ## Read the concentration and index datasets
-    concDset = concGroup['concs']
-    indexDset = concGroup['concs_startingIndices']
-
     ## Read the time at the chosen time step
     time = concGroup.attrs['absoluteTime']
 
@@ -51,18 +48,19 @@ for i in range(len(name)):
         x[j] = j
         xeArray[j] = zero
     
+    ## Read the concentrations of the clusters only (skip the moments for now)
     pos = 0 ## if 0D
-    for j in range(indexDset[pos], indexDset[pos+1]):
-        ## Skip the moments for now
-        if (int(concDset[j][0]) > totalSize - 1): continue
+    concs = readConcentrations(concGroup, pos, 1, 0, totalSize)[0]
+    for j in range(totalSize):
+        if (concs[j] == 0.0): continue
         ## Get the cluster bounds
-        groupName = str(concDset[j][0])
+        groupName = str(j)
         clusterGroup = networkGroup[groupName]
         bounds = clusterGroup.attrs['bounds']
         ## Loop on Xe size
         for l in range(bounds[0], bounds[1]+1):
             ## Fill the array
-            xeArray[l] = xeArray[l] + concDset[j][1]
+            xeArray[l] = xeArray[l] + concs[j]
 
     ## Plot the data
     x = np.delete(x,(0), axis=0)
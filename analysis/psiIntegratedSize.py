@@ -6,6 +6,7 @@ import matplotlib.pyplot as plt
 from   pylab import *
 import h5py
 from matplotlib.colors import LogNorm
+from xolotlConcs import readConcentrations
 
 ## Set the Zero
 zero = 1.0e-20
@@ -25,10 +26,6 @@ lastLoop = concGroup.attrs['lastLoop']
 groupName ='concentrationsGroup/concentration_' + str(lastLoop) + '_' + str(timestep)
 concGroup = f[groupName]
 
-## Read the concentration and index datasets
-concDset = concGroup['concs']
-indexDset = concGroup['concs_startingIndices']
-
 ## Read the time at the chosen time step
 time = concGroup.attrs['absoluteTime']
 
@@ -52,16 +49,18 @@ for i in range(0, maxSize+1):
     hArray[i] = zero
     x[i] = i
 
+## Read the concentrations of the clusters only (skip the moments for now)
+concs = readConcentrations(concGroup, 0, None, 0, totalSize)
+
 ## Loop on the grid
-for j in range(len(indexDset)-1):
+for j in range(len(concs)):
     ## Get the size of the grid point
     dgrid = gridDset[j] - gridDset[j-1]
     ## Loop on the concentrations
-    for i in range(indexDset[j], indexDset[j+1]):
-        ## Skip the moments for now
-        if (int(concDset[i][0]) > totalSize - 1): continue
+    for i in range(totalSize):
+        if (concs[j][i] == 0.0): continue
         ## Get the cluster bounds
-        groupName = str(concDset[i][0])
+        groupName = str(i)
         clusterGroup = networkGroup[groupName]
         bounds = clusterGroup.attrs['bounds']
         if (bounds[8] > 0): continue # I case
@@ -71,10 +70,10 @@ for j in range(len(indexDset)-1):
                 for t in range(bounds[4], bounds[5]+1):
                     for v in range(bounds[6], bounds[7]+1):
                         ## Fill the arrays
-                        heArray[he] = heArray[he] + concDset[i][1] * dgrid
-                        dArray[d] = dArray[d] + concDset[i][1] * dgrid
-                        tArray[t] = tArray[t] + concDset[i][1] * dgrid
-                        hArray[d+t] = hArray[d+t] + concDset[i][1] * dgrid
+                        heArray[he] = heArray[he] + concs[j][i] * dgrid
+                        dArray[d] = dArray[d] + concs[j][i] * dgrid
+                        tArray[t] = tArray[t] + concs[j][i] * dgrid
+                        hArray[d+t] = hArray[d+t] + concs[j][i] * dgrid
 
 ## Create plots
 fig = plt.figure()
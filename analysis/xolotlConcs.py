@@ -0,0 +1,41 @@
+#!/usr/bin/env python
+
+###################################################################
+# Helpers to read the concentrations of a time step group whichever
+# layout it was written with:
+#  - ragged: 'concs' (index, value) pairs with 'concs_startingIndices'
+#  - dense: 'denseConcs' (grid point x value) chunked array, written
+#    with the -dense_concs PETSc option or converted with xconv
+# Only the selected grid points and cluster range are read from a
+# dense dataset.
+###################################################################
+
+import numpy as np
+
+def readConcentrations(concGroup, firstPoint=0, nPoints=None,
+                       firstCluster=0, nClusters=None):
+    """Return a (nPoints x nClusters) array of the concentrations of
+    the grid points [firstPoint, firstPoint + nPoints) and the clusters
+    [firstCluster, firstCluster + nClusters), zero where nothing was
+    written. The last value of each grid point is the temperature."""
+    if 'denseConcs' in concGroup:
+        concDset = concGroup['denseConcs']
+        if nPoints is None: nPoints = concDset.shape[0] - firstPoint
+        if nClusters is None: nClusters = concDset.shape[1] - firstCluster
+        ## Hyperslab selection, only the chunks needed are decompressed
+        return concDset[firstPoint:firstPoint+nPoints,
+                        firstCluster:firstCluster+nClusters]
+
+    concDset = concGroup['concs']
+    indexDset = concGroup['concs_startingIndices']
+    if nPoints is None: nPoints = len(indexDset) - 1 - firstPoint
+    indices = indexDset[firstPoint:firstPoint+nPoints+1]
+    data = concDset[indices[0]:indices[-1]]
+    if nClusters is None:
+        nClusters = max([int(d[0]) for d in data] + [-1]) + 1 - firstCluster
+    concs = np.zeros([nPoints, nClusters])
+    for j in range(nPoints):
+        for d in data[indices[j]-indices[0]:indices[j+1]-indices[0]]:
+            l = int(d[0]) - firstCluster
+            if (l >= 0 and l < nClusters): concs[j][l] = d[1]
+    return concs
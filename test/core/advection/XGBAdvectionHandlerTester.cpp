@@ -140,6 +140,24 @@ BOOST_AUTO_TEST_CASE(checkAdvection)
 	BOOST_REQUIRE_CLOSE(updatedConcOffset[0], 0.0, 0.01); // Does not advect
 	BOOST_REQUIRE_CLOSE(updatedConcOffset[15], 0.0, 0.01); // Does not advect
 
+	// Compute the same advection on the whole line in one pass
+	for (int i = 0; i < 9 * dof; i++) {
+		newConcentration[i] = 0.0;
+	}
+	double* concPoints[3] = {concVector[1], concVector[0], concVector[2]};
+	double** concLines[3] = {concPoints + 1, nullptr, nullptr};
+	double* updatedLine[1] = {updatedConcOffset};
+	std::uint8_t pointMask[1] = {1};
+	advectionHandler.computeAdvectionLine(network, gridPosition,
+		&gridPosition[0], concLines, updatedLine, &hx, &hx, pointMask, 0, 1, hy,
+		1);
+
+	// Check that it gives the same values
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[1], -5.5382e+11, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[7], -1.2366e+12, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[13], -2.0377e+10, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[0], 0.0, 0.01);
+
 	// Initialize the rows, columns, and values to set in the Jacobian
 	int nAdvec = advectionHandler.getNumberOfAdvecting();
 	IdType indices[nAdvec];
@@ -141,6 +141,24 @@ BOOST_AUTO_TEST_CASE(checkDiffusion)
 		updatedConcOffset[15], 0.0, 0.01); // He_8 does not diffuse
 	BOOST_REQUIRE_CLOSE(updatedConcOffset[0], 2.9207e+08, 0.01);
 
+	// Compute the same diffusion on the whole line in one pass
+	for (int i = 0; i < 3 * dof; i++) {
+		newConcentration[i] = 0.0;
+	}
+	double* concPoints[3] = {conc, concOffset, conc + 2 * dof};
+	double** concLines[1] = {concPoints + 1};
+	double* updatedLine[1] = {updatedConcOffset};
+	std::uint8_t pointMask[1] = {1};
+	diffusionHandler.computeDiffusionLine(
+		network, concLines, updatedLine, &hx, &hx, pointMask, 0, 1);
+
+	// Check that it gives the same values
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[1], 3.7081e+12, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[3], 1.8160e+12, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[13], 2.7860e+09, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[15], 0.0, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[0], 2.9207e+08, 0.01);
+
 	// Initialize the indices and values to set in the Jacobian
 	int nDiff = diffusionHandler.getNumberOfDiffusing();
 	IdType indices[nDiff];
@@ -143,6 +143,30 @@ BOOST_AUTO_TEST_CASE(checkDiffusion)
 		updatedConcOffset[15], 0.0, 0.01); // He_8 does not diffuse
 	BOOST_REQUIRE_CLOSE(updatedConcOffset[0], 2.6578e+09, 0.01);
 
+	// Compute the same diffusion on the middle line in one pass
+	for (int i = 0; i < 27 * dof; i++) {
+		newConcentration[i] = 0.0;
+	}
+	double* concPoints[3][3][3]{};
+	for (int k = 0; k < 3; k++)
+		for (int j = 0; j < 3; j++)
+			for (int i = 0; i < 3; i++) {
+				concPoints[k][j][i] = conc + (9 * k + 3 * j + i) * dof;
+			}
+	double** concLines[5] = {concPoints[1][1] + 1, concPoints[1][0] + 1,
+		concPoints[1][2] + 1, concPoints[0][1] + 1, concPoints[2][1] + 1};
+	double* updatedLine[1] = {updatedConcOffset};
+	std::uint8_t pointMask[1] = {1};
+	diffusionHandler.computeDiffusionLine(network, concLines, updatedLine, &hx,
+		&hx, pointMask, 0, 1, sy, 1, sz, 1);
+
+	// Check that it gives the same values
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[1], 3.3744e+13, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[3], 1.6526e+13, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[13], 2.5353e+10, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[15], 0.0, 0.01);
+	BOOST_REQUIRE_CLOSE(updatedConcOffset[0], 2.6578e+09, 0.01);
+
 	// Initialize the indices and values to set in the Jacobian
 	int nDiff = diffusionHandler.getNumberOfDiffusing();
 	IdType indices[nDiff];
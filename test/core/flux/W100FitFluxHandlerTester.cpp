@@ -1,6 +1,8 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE Regression
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 
@@ -304,6 +306,90 @@ BOOST_AUTO_TEST_CASE(checkFluxAmplitude)
 	return;
 }
 
+BOOST_AUTO_TEST_CASE(checkTimeProfileFluxSurfaces)
+{
+	// Create the option to create a network
+	xolotl::options::Options opts;
+	// Create a good parameter file
+	std::string parameterFile = "param.txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "netParam=9 0 0 0 0" << std::endl;
+	paramFile.close();
+
+	// Create a fake command line to read the options
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	opts.readParams(cl.argc, cl.argv);
+
+	std::remove(parameterFile.c_str());
+
+	// Create a non uniform grid
+	std::vector<double> grid = {0.0, 0.5, 1.5, 3.0, 5.0, 7.5, 10.5, 14.0};
+
+	// Create the network
+	using NetworkType =
+		network::PSIReactionNetwork<network::PSIFullSpeciesList>;
+	NetworkType::AmountType maxV = opts.getMaxV();
+	NetworkType::AmountType maxI = opts.getMaxI();
+	NetworkType::AmountType maxHe = opts.getMaxImpurity();
+	NetworkType::AmountType maxD = opts.getMaxD();
+	NetworkType::AmountType maxT = opts.getMaxT();
+	NetworkType network({maxHe, maxD, maxT, maxV, maxI}, grid.size(), opts);
+	// Get its size
+	const int dof = network.getDOF();
+
+	// Create a file with a time profile for the flux
+	std::string fluxFile = "fluxFileSurfaces.dat";
+	std::ofstream writeFluxFile(fluxFile);
+	writeFluxFile << "0.0 1000.0 \n"
+					 "4.0 3000.0";
+	writeFluxFile.close();
+
+	// Compute the flux on the grid points of a line with the given surface
+	auto computeLine = [&grid, dof](W100FitFluxHandler& handler,
+						   double currTime, int surfacePos) {
+		std::vector<double> fluxes;
+		std::vector<double> concs(dof, 0.0);
+		for (int xi = surfacePos + 1; xi < grid.size() - 3; xi++) {
+			std::fill(concs.begin(), concs.end(), 0.0);
+			handler.computeIncidentFlux(
+				currTime, concs.data(), xi, surfacePos);
+			fluxes.push_back(concs[0]);
+		}
+		return fluxes;
+	};
+
+	// Two lines of a 2D grid with different surfaces, at the same time
+	W100FitFluxHandler testFitFlux(opts);
+	testFitFlux.initializeTimeProfile(fluxFile);
+	testFitFlux.initializeFluxHandler(network, 0, grid);
+	double currTime = 1.0;
+	auto firstLine = computeLine(testFitFlux, currTime, 0);
+	auto secondLine = computeLine(testFitFlux, currTime, 1);
+	auto firstLineAgain = computeLine(testFitFlux, currTime, 0);
+
+	// Each line gets the flux of a handler only using its surface
+	for (int surfacePos = 0; surfacePos < 2; surfacePos++) {
+		W100FitFluxHandler refFitFlux(opts);
+		refFitFlux.initializeTimeProfile(fluxFile);
+		refFitFlux.initializeFluxHandler(network, surfacePos, grid);
+		auto refLine = computeLine(refFitFlux, currTime, surfacePos);
+		auto& line = surfacePos == 0 ? firstLine : secondLine;
+		BOOST_REQUIRE_EQUAL(line.size(), refLine.size());
+		for (std::size_t i = 0; i < refLine.size(); i++) {
+			BOOST_REQUIRE_CLOSE(line[i], refLine[i], 1.0e-10);
+		}
+	}
+	BOOST_REQUIRE_EQUAL(firstLineAgain.size(), firstLine.size());
+	for (std::size_t i = 0; i < firstLine.size(); i++) {
+		BOOST_REQUIRE_CLOSE(firstLineAgain[i], firstLine[i], 1.0e-10);
+	}
+	// Reusing the profile of the first surface would give its values
+	BOOST_REQUIRE(std::abs(secondLine[0] - firstLine[0]) > 1.0e-10);
+
+	// Remove the created file
+	std::remove(fluxFile.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(checkTimeProfileFlux)
 {
 	// Create the option to create a network
@@ -408,6 +494,11 @@ BOOST_AUTO_TEST_CASE(checkTimeProfileFlux)
 	BOOST_REQUIRE_EQUAL(instantFlux.size(), 1);
 	BOOST_REQUIRE_CLOSE(instantFlux[0], 1500.0, 0.01);
 
+	// Check the instant flux in earlier intervals and on a stored time
+	BOOST_REQUIRE_CLOSE(testFitFlux->getInstantFlux(1.5)[0], 3000.0, 0.01);
+	BOOST_REQUIRE_CLOSE(testFitFlux->getInstantFlux(2.0)[0], 2000.0, 0.01);
+	BOOST_REQUIRE_CLOSE(testFitFlux->getInstantFlux(0.25)[0], 1750.0, 0.01);
+
 	// Reinitialize their values
 	for (int i = 0; i < 5 * dof; i++) {
 		newConcentration[i] = 0.0;
@@ -1,6 +1,11 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE Regression
 
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
 #include <boost/test/unit_test.hpp>
 
 #include <xolotl/core/network/FeReactionNetwork.h>
@@ -15,6 +20,43 @@ using namespace network;
 using Kokkos::ScopeGuard;
 BOOST_GLOBAL_FIXTURE(ScopeGuard);
 
+namespace
+{
+/**
+ * Creates a Fe network over the given number of grid points from its netParam
+ * and extra lines of the parameter file.
+ */
+std::unique_ptr<FeReactionNetwork>
+createNetwork(const std::string& netParam,
+	FeReactionNetwork::IndexType gridSize,
+	const std::vector<std::string>& optionLines = {})
+{
+	// Create a good parameter file
+	xolotl::options::Options opts;
+	std::string parameterFile = "param.txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "netParam=" << netParam << std::endl
+			  << "process=reaction sink" << std::endl;
+	for (const auto& line : optionLines) {
+		paramFile << line << std::endl;
+	}
+	paramFile.close();
+
+	// Create a fake command line to read the options
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	opts.readParams(cl.argc, cl.argv);
+	std::remove(parameterFile.c_str());
+
+	using NetworkType = FeReactionNetwork;
+	return std::make_unique<NetworkType>(
+		std::vector<NetworkType::AmountType>{
+			(NetworkType::AmountType)opts.getMaxImpurity(),
+			(NetworkType::AmountType)opts.getMaxV(),
+			(NetworkType::AmountType)opts.getMaxI()},
+		gridSize, opts);
+}
+} // namespace
+
 /**
  * This suite is responsible for testing the Fe network.
  */
@@ -152,6 +194,30 @@ BOOST_AUTO_TEST_CASE(fullyRefined)
 		BOOST_REQUIRE_CLOSE(fluxes[i], knownFluxes[i], 0.01);
 	}
 
+	// Check the batched fluxes computation, the middle row is skipped
+	const NetworkType::IndexType nRows = 3;
+	auto dBatchConcs = Kokkos::View<double**, Kokkos::LayoutRight>(
+		"Batch Concentrations", nRows, dof + 1);
+	Kokkos::deep_copy(dBatchConcs, 1.0);
+	auto dBatchFluxes = Kokkos::View<double**, Kokkos::LayoutRight>(
+		"Batch Fluxes", nRows, dof + 1);
+	auto batchIds = NetworkType::GridIndicesView("Grid Indices", nRows);
+	batchIds.h_view(0) = gridId;
+	batchIds.h_view(1) = network.invalidIndex();
+	batchIds.h_view(2) = gridId;
+	batchIds.modify_host();
+	batchIds.sync_device();
+	std::vector<double> batchDepths(nRows, 1.0), batchSpacings(nRows, 1.0);
+	network.computeAllFluxes(
+		dBatchConcs, dBatchFluxes, batchIds, batchDepths, batchSpacings);
+	auto hBatchFluxes = create_mirror_view(dBatchFluxes);
+	deep_copy(hBatchFluxes, dBatchFluxes);
+	for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+		BOOST_REQUIRE_CLOSE(hBatchFluxes(0, i), knownFluxes[i], 0.01);
+		BOOST_REQUIRE_EQUAL(hBatchFluxes(1, i), 0.0);
+		BOOST_REQUIRE_CLOSE(hBatchFluxes(2, i), knownFluxes[i], 0.01);
+	}
+
 	// Check the partials computation
 	std::vector<double> knownPartials = {-9.43288e+10, -7.01816e+09,
 		-7.91224e+09, -1.03421e+10, -6.86896e+09, -7.76165e+09, -8.38785e+09,
@@ -207,6 +273,19 @@ BOOST_AUTO_TEST_CASE(fullyRefined)
 		}
 	}
 
+	// Check the batched partials computation against the single one
+	auto dBatchPartials = Kokkos::View<double**, Kokkos::LayoutRight>(
+		"Batch Partials", nRows, nPartials);
+	network.computeAllPartials(
+		dBatchConcs, dBatchPartials, batchIds, batchDepths, batchSpacings);
+	auto hBatchPartials = create_mirror_view(dBatchPartials);
+	deep_copy(hBatchPartials, dBatchPartials);
+	for (NetworkType::IndexType i = 0; i < nPartials; i++) {
+		BOOST_REQUIRE_CLOSE(hBatchPartials(0, i), hPartials[i], 0.01);
+		BOOST_REQUIRE_EQUAL(hBatchPartials(1, i), 0.0);
+		BOOST_REQUIRE_CLOSE(hBatchPartials(2, i), hPartials[i], 0.01);
+	}
+
 	// Check clusters
 	NetworkType::Composition comp = NetworkType::Composition::zero();
 	comp[Spec::He] = 1;
@@ -724,4 +803,367 @@ BOOST_AUTO_TEST_CASE(grouped)
 	BOOST_REQUIRE_EQUAL(momId.extent(0), 2);
 }
 
+BOOST_AUTO_TEST_CASE(rateStorageByTemperature)
+{
+	using NetworkType = FeReactionNetwork;
+	auto network = createNetwork("3 0 0 3 1", 3, {"rateStorage=temperature"});
+	const auto dof = network->getDOF();
+	NetworkType::SparseFillMap dfill;
+	network->getDiagonalFill(dfill);
+
+	// The first and last grid points share their rates
+	std::vector<double> temperatures = {1000.0, 800.0, 1000.0};
+	std::vector<double> depths = {1.0, 2.0, 3.0};
+	network->setTemperatures(temperatures, depths);
+	BOOST_REQUIRE_CLOSE(network->getLargestRate(), 751630489466.0, 0.01);
+
+	auto dConcs = Kokkos::View<double*>("Concentrations", dof + 1);
+	Kokkos::deep_copy(dConcs, 1.0);
+	auto dFluxes = Kokkos::View<double*>("Fluxes", dof + 1);
+
+	// Same fluxes as the single grid point test at 1000 K
+	std::vector<double> knownFluxes = {-9.43288e+10, -5.16275e+11, -5.63061e+11,
+		-6.10778e+11, -4.75639e+12, -1.45044e+11, -1.55625e+11, -1.69757e+11,
+		-7.60177e+11, 1.45774e+11, 1.57282e+11, 1.59414e+11, 2.6994e+11,
+		5.20973e+11, 5.63078e+11, 5.86753e+11, 0};
+	auto hFluxes = create_mirror_view(dFluxes);
+	for (NetworkType::IndexType gridId : {0, 2}) {
+		Kokkos::deep_copy(dFluxes, 0.0);
+		network->computeAllFluxes(dConcs, dFluxes, gridId);
+		deep_copy(hFluxes, dFluxes);
+		for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+			BOOST_REQUIRE_CLOSE(hFluxes(i), knownFluxes[i], 0.01);
+		}
+	}
+
+	// Changing one temperature splits the shared rates
+	temperatures[2] = 800.0;
+	network->setTemperatures(temperatures, depths);
+	Kokkos::deep_copy(dFluxes, 0.0);
+	network->computeAllFluxes(dConcs, dFluxes, 1);
+	auto hFluxesLow = create_mirror_view(dFluxes);
+	deep_copy(hFluxesLow, dFluxes);
+	Kokkos::deep_copy(dFluxes, 0.0);
+	network->computeAllFluxes(dConcs, dFluxes, 2);
+	deep_copy(hFluxes, dFluxes);
+	for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+		BOOST_REQUIRE_CLOSE(hFluxes(i), hFluxesLow(i), 0.01);
+	}
+	Kokkos::deep_copy(dFluxes, 0.0);
+	network->computeAllFluxes(dConcs, dFluxes, 0);
+	deep_copy(hFluxes, dFluxes);
+	for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+		BOOST_REQUIRE_CLOSE(hFluxes(i), knownFluxes[i], 0.01);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(rateTable)
+{
+	// Create one network computing the rates and one interpolating them
+	constexpr double minTemp = 700.0, maxTemp = 1100.0, step = 0.5;
+	std::ostringstream rateTable;
+	rateTable << "rateTable=" << minTemp << " " << maxTemp << " " << step;
+	auto network = createNetwork("3 0 0 3 1", 4);
+	auto tabNetwork = createNetwork("3 0 0 3 1", 4, {rateTable.str()});
+
+	// On the lattice, between lattice temperatures, and outside of it
+	std::vector<double> temperatures = {700.0, 812.3, 1000.0, 1200.0};
+	std::vector<double> depths = {1.0, 2.0, 3.0, 4.0};
+	network->setTemperatures(temperatures, depths);
+	tabNetwork->setTemperatures(temperatures, depths);
+
+	// Relative interpolation error bound step^2 * max|f''| / 8 of an
+	// Arrhenius term with energies (migration plus binding) up to 8 eV,
+	// in percent
+	constexpr double maxEnergy = 8.0;
+	const double bound = 100.0 * step * step / 8.0 *
+		std::pow(maxEnergy / (kBoltzmann * minTemp * minTemp), 2.0);
+
+	const auto numClusters = network->getNumClusters();
+	std::vector<IdType> clusterIds(numClusters);
+	for (IdType i = 0; i < numClusters; ++i) {
+		clusterIds[i] = i;
+	}
+	std::vector<double> coefs, tabCoefs;
+	network->getDiffusionCoefficients(clusterIds, coefs);
+	tabNetwork->getDiffusionCoefficients(clusterIds, tabCoefs);
+	for (std::size_t i = 0; i < coefs.size(); ++i) {
+		BOOST_REQUIRE_CLOSE(tabCoefs[i], coefs[i], bound);
+	}
+
+	const auto dof = network->getDOF();
+	auto dConcs = Kokkos::View<double*>("Concentrations", dof + 1);
+	Kokkos::deep_copy(dConcs, 1.0);
+	for (IdType gridId = 0; gridId < temperatures.size(); ++gridId) {
+		for (IdType i = 0; i < numClusters; ++i) {
+			BOOST_REQUIRE_CLOSE(tabNetwork->getLeftSideRate(dConcs, i, gridId),
+				network->getLeftSideRate(dConcs, i, gridId), bound);
+		}
+	}
+
+	// The rates outside of the lattice are computed
+	for (IdType i = 0; i < numClusters; ++i) {
+		BOOST_REQUIRE_CLOSE(tabNetwork->getLeftSideRate(dConcs, i, 3),
+			network->getLeftSideRate(dConcs, i, 3), 1.0e-10);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(incrementalTemperatures)
+{
+	using NetworkType = FeReactionNetwork;
+	auto network = createNetwork("3 0 0 3 1", 2);
+	const auto dof = network->getDOF();
+	NetworkType::SparseFillMap dfill;
+	network->getDiagonalFill(dfill);
+
+	std::vector<double> temperatures = {1000.0, 1000.0};
+	std::vector<double> depths = {1.0, 2.0};
+	network->setTemperatures(temperatures, depths);
+
+	// Only update the second grid point
+	temperatures[1] = 800.0;
+	network->setTemperatures(temperatures, depths, {1});
+
+	auto dConcs = Kokkos::View<double*>("Concentrations", dof + 1);
+	Kokkos::deep_copy(dConcs, 1.0);
+	auto dFluxes = Kokkos::View<double*>("Fluxes", dof + 1);
+	auto hFluxes = create_mirror_view(dFluxes);
+
+	// The first grid point is untouched
+	std::vector<double> knownFluxes = {-9.43288e+10, -5.16275e+11, -5.63061e+11,
+		-6.10778e+11, -4.75639e+12, -1.45044e+11, -1.55625e+11, -1.69757e+11,
+		-7.60177e+11, 1.45774e+11, 1.57282e+11, 1.59414e+11, 2.6994e+11,
+		5.20973e+11, 5.63078e+11, 5.86753e+11, 0};
+	Kokkos::deep_copy(dFluxes, 0.0);
+	network->computeAllFluxes(dConcs, dFluxes, 0);
+	deep_copy(hFluxes, dFluxes);
+	for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+		BOOST_REQUIRE_CLOSE(hFluxes(i), knownFluxes[i], 0.01);
+	}
+
+	// The second grid point matches a full update
+	Kokkos::deep_copy(dFluxes, 0.0);
+	network->computeAllFluxes(dConcs, dFluxes, 1);
+	auto hIncrFluxes = create_mirror_view(dFluxes);
+	deep_copy(hIncrFluxes, dFluxes);
+	network->setTemperatures(temperatures, depths);
+	Kokkos::deep_copy(dFluxes, 0.0);
+	network->computeAllFluxes(dConcs, dFluxes, 1);
+	deep_copy(hFluxes, dFluxes);
+	for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+		BOOST_REQUIRE_CLOSE(hIncrFluxes(i), hFluxes(i), 0.01);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(gatherFluxes)
+{
+	using NetworkType = FeReactionNetwork;
+	auto network = createNetwork("3 0 0 3 1", 1, {"fluxAccumulation=gather"});
+	const auto dof = network->getDOF();
+	NetworkType::SparseFillMap dfill;
+	network->getDiagonalFill(dfill);
+
+	std::vector<double> temperatures = {1000.0};
+	std::vector<double> depths = {1.0};
+	network->setTemperatures(temperatures, depths);
+	NetworkType::IndexType gridId = 0;
+
+	auto dConcs = Kokkos::View<double*>("Concentrations", dof + 1);
+	Kokkos::deep_copy(dConcs, 1.0);
+	auto dFluxes = Kokkos::View<double*>("Fluxes", dof + 1);
+	Kokkos::deep_copy(dFluxes, 0.0);
+	auto hFluxes = create_mirror_view(dFluxes);
+
+	// Same fluxes as with the atomic accumulation
+	std::vector<double> knownFluxes = {-9.43288e+10, -5.16275e+11, -5.63061e+11,
+		-6.10778e+11, -4.75639e+12, -1.45044e+11, -1.55625e+11, -1.69757e+11,
+		-7.60177e+11, 1.45774e+11, 1.57282e+11, 1.59414e+11, 2.6994e+11,
+		5.20973e+11, 5.63078e+11, 5.86753e+11, 0};
+	network->computeAllFluxes(dConcs, dFluxes, gridId);
+	deep_copy(hFluxes, dFluxes);
+	for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+		BOOST_REQUIRE_CLOSE(hFluxes(i), knownFluxes[i], 0.01);
+	}
+
+	// The batched fluxes, the middle row is skipped
+	const NetworkType::IndexType nRows = 3;
+	auto dBatchConcs = Kokkos::View<double**, Kokkos::LayoutRight>(
+		"Batch Concentrations", nRows, dof + 1);
+	Kokkos::deep_copy(dBatchConcs, 1.0);
+	auto dBatchFluxes = Kokkos::View<double**, Kokkos::LayoutRight>(
+		"Batch Fluxes", nRows, dof + 1);
+	auto batchIds = NetworkType::GridIndicesView("Grid Indices", nRows);
+	batchIds.h_view(0) = gridId;
+	batchIds.h_view(1) = network->invalidIndex();
+	batchIds.h_view(2) = gridId;
+	batchIds.modify_host();
+	batchIds.sync_device();
+	std::vector<double> batchDepths(nRows, 1.0), batchSpacings(nRows, 1.0);
+	network->computeAllFluxes(
+		dBatchConcs, dBatchFluxes, batchIds, batchDepths, batchSpacings);
+	auto hBatchFluxes = create_mirror_view(dBatchFluxes);
+	deep_copy(hBatchFluxes, dBatchFluxes);
+	for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+		BOOST_REQUIRE_CLOSE(hBatchFluxes(0, i), knownFluxes[i], 0.01);
+		BOOST_REQUIRE_EQUAL(hBatchFluxes(1, i), 0.0);
+		BOOST_REQUIRE_CLOSE(hBatchFluxes(2, i), knownFluxes[i], 0.01);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(networkCache)
+{
+	using NetworkType = FeReactionNetwork;
+	const std::string cacheDir = "networkCacheTest";
+	const std::string cacheOption = "networkCache=" + cacheDir;
+	std::vector<double> knownFluxes = {-9.43288e+10, -5.16275e+11, -5.63061e+11,
+		-6.10778e+11, -4.75639e+12, -1.45044e+11, -1.55625e+11, -1.69757e+11,
+		-7.60177e+11, 1.45774e+11, 1.57282e+11, 1.59414e+11, 2.6994e+11,
+		5.20973e+11, 5.63078e+11, 5.86753e+11, 0};
+	auto cacheFiles = [&cacheDir]() {
+		std::vector<xolotl::fs::path> files;
+		for (const auto& entry : xolotl::fs::directory_iterator(cacheDir)) {
+			files.push_back(entry.path());
+		}
+		return files;
+	};
+
+	// The first network writes the cache, the second one reads it
+	xolotl::fs::path cacheFile;
+	xolotl::fs::file_time_type writeTime;
+	for (int n = 0; n < 2; ++n) {
+		auto network = createNetwork("3 0 0 3 1", 1, {cacheOption});
+		auto files = cacheFiles();
+		BOOST_REQUIRE_EQUAL(files.size(), 1);
+		if (n == 0) {
+			// Age the file so that a rewrite could not keep its time
+			cacheFile = files[0];
+			writeTime = xolotl::fs::last_write_time(cacheFile) -
+				std::chrono::hours(1);
+			xolotl::fs::last_write_time(cacheFile, writeTime);
+		}
+		else {
+			// Cache hit, the file was read and not written again
+			BOOST_REQUIRE(files[0] == cacheFile);
+			BOOST_REQUIRE(xolotl::fs::last_write_time(cacheFile) == writeTime);
+		}
+
+		const auto dof = network->getDOF();
+		NetworkType::SparseFillMap dfill;
+		auto nPartials = network->getDiagonalFill(dfill);
+		BOOST_REQUIRE_EQUAL(nPartials, 176);
+
+		std::vector<double> temperatures = {1000.0};
+		std::vector<double> depths = {1.0};
+		network->setTemperatures(temperatures, depths);
+
+		auto dConcs = Kokkos::View<double*>("Concentrations", dof + 1);
+		Kokkos::deep_copy(dConcs, 1.0);
+		auto dFluxes = Kokkos::View<double*>("Fluxes", dof + 1);
+		Kokkos::deep_copy(dFluxes, 0.0);
+		network->computeAllFluxes(dConcs, dFluxes, 0);
+		auto hFluxes = create_mirror_view(dFluxes);
+		deep_copy(hFluxes, dFluxes);
+		for (NetworkType::IndexType i = 0; i < dof + 1; i++) {
+			BOOST_REQUIRE_CLOSE(hFluxes(i), knownFluxes[i], 0.01);
+		}
+	}
+
+	// The header holds the format version and the name of the network
+	auto readHeader = [&cacheFile]() {
+		std::ifstream ifs(cacheFile, std::ios::binary);
+		std::uint64_t values[4] = {};
+		ifs.read(reinterpret_cast<char*>(values), sizeof(values));
+		std::string name(values[3], ' ');
+		ifs.read(name.data(), name.size());
+		return std::make_pair(values[1], name);
+	};
+	auto [version, name] = readHeader();
+	BOOST_REQUIRE_EQUAL(version, detail::NetworkCache::formatVersion);
+	BOOST_REQUIRE_EQUAL(name.substr(name.find(':')), ":He,V,I");
+
+	// A file written with another format version is not reused
+	{
+		std::fstream file(
+			cacheFile, std::ios::binary | std::ios::in | std::ios::out);
+		std::uint64_t oldVersion = detail::NetworkCache::formatVersion - 1;
+		file.seekp(sizeof(std::uint64_t));
+		file.write(reinterpret_cast<const char*>(&oldVersion),
+			sizeof(oldVersion));
+	}
+	xolotl::fs::last_write_time(cacheFile, writeTime);
+	createNetwork("3 0 0 3 1", 1, {cacheOption});
+	BOOST_REQUIRE_EQUAL(cacheFiles().size(), 1);
+	BOOST_REQUIRE(xolotl::fs::last_write_time(cacheFile) != writeTime);
+	BOOST_REQUIRE_EQUAL(
+		readHeader().first, detail::NetworkCache::formatVersion);
+	writeTime = xolotl::fs::last_write_time(cacheFile);
+
+	// A different network does not reuse the cache and writes its own file
+	auto network = createNetwork("3 0 0 4 1", 1, {cacheOption});
+	BOOST_REQUIRE_EQUAL(cacheFiles().size(), 2);
+	BOOST_REQUIRE(xolotl::fs::last_write_time(cacheFile) == writeTime);
+	BOOST_REQUIRE_GT(network->getNumClusters(), 16);
+
+	xolotl::fs::remove_all(cacheDir);
+}
+
+BOOST_AUTO_TEST_CASE(hostDataMirror)
+{
+	using NetworkType = FeReactionNetwork;
+	auto network = createNetwork("3 0 0 3 1", 2);
+	const auto nClusters = network->getNumClusters();
+	std::vector<IdType> clusterIds(nClusters);
+	for (NetworkType::IndexType i = 0; i < nClusters; i++) {
+		clusterIds[i] = i;
+	}
+
+	std::vector<double> temperatures = {1000.0, 1000.0};
+	std::vector<double> depths = {1.0, 2.0};
+	network->setTemperatures(temperatures, depths);
+	const auto* subpavingMirror = &network->getSubpavingMirror();
+	const auto* dataMirror = &network->getClusterDataMirror();
+
+	// The host data follows the temperature updates, full or partial,
+	// without being rebuilt
+	std::vector<double> coefs;
+	for (auto temp : {800.0, 1200.0}) {
+		temperatures[1] = temp;
+		if (temp > 1000.0) {
+			network->setTemperatures(temperatures, depths, {1});
+		}
+		else {
+			network->setTemperatures(temperatures, depths);
+		}
+		network->setTime(1.0);
+		network->getDiffusionCoefficients(clusterIds, coefs);
+		for (NetworkType::IndexType i = 0; i < nClusters; i++) {
+			auto cluster = network->getClusterCommon(i);
+			BOOST_REQUIRE_CLOSE(cluster.getTemperature(0), 1000.0, 0.01);
+			BOOST_REQUIRE_CLOSE(cluster.getTemperature(1), temp, 0.01);
+			for (NetworkType::IndexType j = 0; j < 2; j++) {
+				BOOST_REQUIRE_EQUAL(
+					cluster.getDiffusionCoefficient(j), coefs[i * 2 + j]);
+			}
+		}
+		BOOST_REQUIRE_EQUAL(&network->getSubpavingMirror(), subpavingMirror);
+		BOOST_REQUIRE_EQUAL(&network->getClusterDataMirror(), dataMirror);
+	}
+
+	// Same with a new grid
+	network->setGridSize(3);
+	temperatures = {900.0, 900.0, 900.0};
+	depths = {1.0, 2.0, 3.0};
+	network->setTemperatures(temperatures, depths);
+	network->getDiffusionCoefficients(clusterIds, coefs);
+	for (NetworkType::IndexType i = 0; i < nClusters; i++) {
+		auto cluster = network->getClusterCommon(i);
+		for (NetworkType::IndexType j = 0; j < 3; j++) {
+			BOOST_REQUIRE_CLOSE(cluster.getTemperature(j), 900.0, 0.01);
+			BOOST_REQUIRE_EQUAL(
+				cluster.getDiffusionCoefficient(j), coefs[i * 3 + j]);
+		}
+	}
+	BOOST_REQUIRE_EQUAL(&network->getSubpavingMirror(), subpavingMirror);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <tuple>
 
 #include <boost/test/unit_test.hpp>
 
@@ -128,6 +129,51 @@ public:
 		return hPartials;
 	}
 
+	/**
+	 * Compares the fluxes of all the grid points computed in one batch with
+	 * the ones computed point by point. The surface is moved by the given
+	 * number of grid points and the grid indices are repeated if asked for.
+	 */
+	void
+	checkBatchedFluxes(int surfaceShift, bool repeatIndices)
+	{
+		using BatchView = Kokkos::View<double**, Kokkos::LayoutRight>;
+		const IndexType nRows = _nGrid - 2;
+		auto dBatchConcs = BatchView("Batch Concentrations", nRows, _dof);
+		auto dBatchFluxes = BatchView("Batch Fluxes", nRows, _dof);
+		auto batchIds = NetworkType::GridIndicesView("Grid Indices", nRows);
+		std::vector<double> depths(nRows), spacings(nRows);
+		std::vector<Kokkos::View<double*, Kokkos::HostSpace>> expected;
+		for (IndexType b = 0; b < nRows; ++b) {
+			int gridIndex = repeatIndices ? 1 + b % 2 : b + 1;
+			auto dConcs = getConcentrations(b + 1);
+			Kokkos::deep_copy(
+				Kokkos::subview(dBatchConcs, b, Kokkos::ALL), dConcs);
+			batchIds.h_view(b) = gridIndex;
+			std::tie(depths[b], spacings[b]) = getDepthAndSpacing(b + 1);
+			depths[b] -= surfaceShift * 0.1;
+
+			auto dFluxes = Kokkos::View<double*>("Fluxes", _dof);
+			_network.computeAllFluxes(
+				dConcs, dFluxes, gridIndex, depths[b], spacings[b]);
+			auto hFluxes = create_mirror_view(dFluxes);
+			deep_copy(hFluxes, dFluxes);
+			expected.push_back(hFluxes);
+		}
+		batchIds.modify_host();
+		batchIds.sync_device();
+
+		_network.computeAllFluxes(
+			dBatchConcs, dBatchFluxes, batchIds, depths, spacings);
+		auto hBatchFluxes = create_mirror_view(dBatchFluxes);
+		deep_copy(hBatchFluxes, dBatchFluxes);
+		for (IndexType b = 0; b < nRows; ++b) {
+			for (IndexType i = 0; i < _dof; ++i) {
+				BOOST_REQUIRE_CLOSE(hBatchFluxes(b, i), expected[b](i), 1.0e-8);
+			}
+		}
+	}
+
 private:
 	static std::vector<double>
 	makeGrid(int nGrid)
@@ -262,6 +308,19 @@ BOOST_AUTO_TEST_CASE(W100)
 		partials[hlp.getPartialsIndex(1, 71)], 5.53624e+14, 0.01);
 }
 
+BOOST_AUTO_TEST_CASE(batchedFluxes)
+{
+	TungstenTMTestHelper hlp("W100");
+	hlp.setTemperatures(1200.0);
+
+	// Distinct grid points read the trap-mutation table in a single launch
+	hlp.checkBatchedFluxes(0, false);
+	// The table entries follow the surface
+	hlp.checkBatchedFluxes(2, false);
+	// Rows sharing grid points are processed one by one
+	hlp.checkBatchedFluxes(0, true);
+}
+
 BOOST_AUTO_TEST_CASE(W110)
 {
 	TungstenTMTestHelper hlp("W110");
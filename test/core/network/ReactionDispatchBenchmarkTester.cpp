@@ -0,0 +1,143 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <xolotl/core/network/FeReactionNetwork.h>
+#include <xolotl/options/Options.h>
+#include <xolotl/test/CommandLine.h>
+
+using namespace std;
+using namespace xolotl;
+using namespace core;
+using namespace network;
+
+using Kokkos::ScopeGuard;
+BOOST_GLOBAL_FIXTURE(ScopeGuard);
+
+namespace
+{
+using NetworkType = FeReactionNetwork;
+
+//! Number of grid points computed together
+constexpr NetworkType::IndexType numRows = 64;
+//! Number of timed calls of each kind
+constexpr int numCalls = 20;
+
+struct DispatchTiming
+{
+	//! Mean time per call (s)
+	double fluxes;
+	double partials;
+	//! Fluxes of the last call
+	std::vector<double> hFluxes;
+};
+
+/**
+ * Times the batched fluxes and partials of the same network with the given
+ * reaction dispatch mode.
+ */
+DispatchTiming
+timeDispatch(const std::string& dispatch)
+{
+	xolotl::options::Options opts;
+	std::string parameterFile = "param_" + dispatch + ".txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "netParam=8 0 0 30 8" << std::endl
+			  << "process=reaction sink" << std::endl
+			  << "reactionDispatch=" << dispatch << std::endl;
+	paramFile.close();
+
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	opts.readParams(cl.argc, cl.argv);
+	std::remove(parameterFile.c_str());
+
+	NetworkType network({(NetworkType::AmountType)opts.getMaxImpurity(),
+							(NetworkType::AmountType)opts.getMaxV(),
+							(NetworkType::AmountType)opts.getMaxI()},
+		numRows, opts);
+	const auto dof = network.getDOF();
+	NetworkType::SparseFillMap dfill;
+	auto nPartials = network.getDiagonalFill(dfill);
+
+	std::vector<double> temperatures(numRows, 1000.0);
+	std::vector<double> depths(numRows, 1.0);
+	network.setTemperatures(temperatures, depths);
+	std::vector<double> spacings(numRows, 1.0);
+
+	Kokkos::View<double**, Kokkos::LayoutRight> concs(
+		"Concentrations", numRows, dof);
+	Kokkos::deep_copy(concs, 1.0);
+	Kokkos::View<double**, Kokkos::LayoutRight> fluxes(
+		"Fluxes", numRows, dof);
+	Kokkos::View<double**, Kokkos::LayoutRight> partials(
+		"Partials", numRows, nPartials);
+	NetworkType::GridIndicesView gridIds("Grid Indices", numRows);
+	for (NetworkType::IndexType b = 0; b < numRows; ++b) {
+		gridIds.h_view(b) = b;
+	}
+	gridIds.modify_host();
+	gridIds.sync_device();
+
+	// Warm up both paths before timing them
+	network.computeAllFluxes(concs, fluxes, gridIds, depths, spacings);
+	network.computeAllPartials(concs, partials, gridIds, depths, spacings);
+	Kokkos::fence();
+
+	using Clock = std::chrono::steady_clock;
+	DispatchTiming timing;
+	auto start = Clock::now();
+	for (int i = 0; i < numCalls; ++i) {
+		Kokkos::deep_copy(fluxes, 0.0);
+		network.computeAllFluxes(concs, fluxes, gridIds, depths, spacings);
+	}
+	Kokkos::fence();
+	std::chrono::duration<double> elapsed = Clock::now() - start;
+	timing.fluxes = elapsed.count() / numCalls;
+
+	start = Clock::now();
+	for (int i = 0; i < numCalls; ++i) {
+		network.computeAllPartials(
+			concs, partials, gridIds, depths, spacings);
+	}
+	Kokkos::fence();
+	elapsed = Clock::now() - start;
+	timing.partials = elapsed.count() / numCalls;
+
+	auto hFluxes =
+		Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, fluxes);
+	timing.hFluxes.assign(hFluxes.data(), hFluxes.data() + hFluxes.size());
+
+	return timing;
+}
+} // namespace
+
+/**
+ * This suite compares the time per call of the reaction dispatch modes.
+ */
+BOOST_AUTO_TEST_SUITE(ReactionDispatchBenchmark_testSuite)
+
+BOOST_AUTO_TEST_CASE(fusedVersusType)
+{
+	auto fused = timeDispatch("fused");
+	auto typed = timeDispatch("type");
+
+	// Only shown with --log_level=message
+	BOOST_TEST_MESSAGE("Reaction dispatch, "
+		<< numRows << " grid points, mean of " << numCalls
+		<< " calls (s): fluxes fused " << fused.fluxes << ", type "
+		<< typed.fluxes << "; partials fused " << fused.partials
+		<< ", type " << typed.partials);
+
+	// Both modes compute the same thing
+	BOOST_REQUIRE_EQUAL(fused.hFluxes.size(), typed.hFluxes.size());
+	for (std::size_t i = 0; i < fused.hFluxes.size(); ++i) {
+		BOOST_REQUIRE_CLOSE(typed.hFluxes[i], fused.hFluxes[i], 0.01);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
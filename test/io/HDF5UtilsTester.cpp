@@ -1,12 +1,16 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE Regression
 
+#include <cmath>
+#include <fstream>
 #include <memory>
 
 #include <boost/test/framework.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <xolotl/core/network/PSIReactionNetwork.h>
+#include <xolotl/io/CheckpointWriter.h>
+#include <xolotl/io/TimeSeriesWriter.h>
 #include <xolotl/io/XFile.h>
 #include <xolotl/options/Options.h>
 #include <xolotl/test/CommandLine.h>
@@ -615,4 +619,605 @@ BOOST_AUTO_TEST_CASE(checkSurface3D)
 	}
 }
 
+/**
+ * Method checking that the checkpoints written through the checkpoint writer
+ * are all in the file once it is closed.
+ */
+BOOST_AUTO_TEST_CASE(checkCheckpointWriter)
+{
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+	const int nGridPointsPerRank = 3;
+
+	// Create the test HDF5 file.
+	const std::string testFileName = "test_checkpoint.h5";
+	{
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+	}
+
+	// Write two checkpoints, the second one is submitted while the first
+	// one may still be written
+	const int nSteps = 2;
+	{
+		// Only written in the background when asked for
+		{
+			CheckpointWriter writer(testFileName, MPI_COMM_WORLD);
+			BOOST_REQUIRE(not writer.isAsync());
+		}
+
+		CheckpointWriter writer(testFileName, MPI_COMM_WORLD, true);
+		for (int step = 0; step < nSteps; step++) {
+			// The concentrations of the grid points we own
+			XFile::TimestepGroup::Concs1DType myConcs(nGridPointsPerRank);
+			for (int i = 0; i < nGridPointsPerRank; i++) {
+				int x = commRank * nGridPointsPerRank + i;
+				myConcs[i].emplace_back(0, (double)(step + 1) * x);
+				myConcs[i].emplace_back(x + 1, 1.0);
+			}
+
+			double time = 0.1 * (step + 1);
+			int baseX = commRank * nGridPointsPerRank;
+			writer.submit([step, time, baseX, myConcs = std::move(myConcs)](
+							  XFile& file, MPI_Comm) {
+				// Boost checks are not thread-safe, errors are rethrown by
+				// the writer instead
+				auto concGroup = file.getGroup<XFile::ConcentrationGroup>();
+				if (!concGroup)
+					throw std::runtime_error("Missing concentration group");
+				auto tsGroup =
+					concGroup->addTimestepGroup(0, step, time, 0.0, 0.1);
+				tsGroup->writeConcentrations(file, baseX, myConcs);
+			});
+		}
+	}
+
+	// Read the file to check the values we wrote.
+	{
+		XFile testFile(
+			testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		for (int step = 0; step < nSteps; step++) {
+			auto tsGroup = concGroup->getTimestepGroup(0, step);
+			BOOST_REQUIRE(tsGroup);
+			double t = 0.0, dt = 0.0;
+			std::tie(t, dt) = tsGroup->readTimes();
+			BOOST_REQUIRE_CLOSE(t, 0.1 * (step + 1), 0.0001);
+
+			auto baseX = commRank * nGridPointsPerRank;
+			auto readConcs = tsGroup->readConcentrations(
+				testFile, baseX, nGridPointsPerRank);
+			BOOST_REQUIRE_EQUAL(readConcs.size(), nGridPointsPerRank);
+			for (int i = 0; i < nGridPointsPerRank; i++) {
+				int x = baseX + i;
+				BOOST_REQUIRE_EQUAL(readConcs[i].size(), 2);
+				BOOST_REQUIRE_EQUAL(readConcs[i][0].first, 0);
+				BOOST_REQUIRE_CLOSE(
+					readConcs[i][0].second, (double)(step + 1) * x, 0.0001);
+				BOOST_REQUIRE_EQUAL(readConcs[i][1].first, x + 1);
+			}
+		}
+	}
+}
+
+/**
+ * Method checking the writing and reading of the dense concentration layout,
+ * and that the ragged one can be read the same way.
+ */
+BOOST_AUTO_TEST_CASE(checkDenseConcentrations)
+{
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+	const int nGridPointsPerRank = 3;
+	const int nValues = 6;
+	int baseX = commRank * nGridPointsPerRank;
+
+	// The values of the grid points we own, zero on every other value
+	XFile::TimestepGroup::DenseConcsType myDenseConcs(
+		nGridPointsPerRank * nValues, 0.0);
+	XFile::TimestepGroup::Concs1DType myConcs(nGridPointsPerRank);
+	for (int i = 0; i < nGridPointsPerRank; i++) {
+		int x = baseX + i;
+		for (int l = 0; l < nValues; l += 2) {
+			double conc = 1.0 + x * nValues + l;
+			myDenseConcs[i * nValues + l] = conc;
+			myConcs[i].emplace_back(l, conc);
+		}
+	}
+
+	// Write both layouts in two time steps
+	const std::string testFileName = "test_dense.h5";
+	{
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto denseGroup = concGroup->addTimestepGroup(0, 0, 0.1, 0.0, 0.1);
+		denseGroup->writeDenseConcentrations(
+			testFile, baseX, nGridPointsPerRank, nValues, myDenseConcs);
+		auto raggedGroup = concGroup->addTimestepGroup(0, 1, 0.2, 0.1, 0.1);
+		raggedGroup->writeConcentrations(testFile, baseX, myConcs);
+	}
+
+	XFile testFile(
+		testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+	auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+	BOOST_REQUIRE(concGroup);
+	auto denseGroup = concGroup->getTimestepGroup(0, 0);
+	auto raggedGroup = concGroup->getTimestepGroup(0, 1);
+	BOOST_REQUIRE(denseGroup);
+	BOOST_REQUIRE(raggedGroup);
+	BOOST_REQUIRE(denseGroup->hasDenseConcentrations());
+	BOOST_REQUIRE(not denseGroup->hasRaggedConcentrations());
+	BOOST_REQUIRE(not raggedGroup->hasDenseConcentrations());
+	BOOST_REQUIRE(raggedGroup->hasRaggedConcentrations());
+	BOOST_REQUIRE_EQUAL(denseGroup->getNumDenseValues(), nValues);
+
+	// The ragged representation of the dense layout only has the non-zero
+	// values
+	auto readConcs =
+		denseGroup->readConcentrations(testFile, baseX, nGridPointsPerRank);
+	BOOST_REQUIRE_EQUAL(readConcs.size(), nGridPointsPerRank);
+	for (int i = 0; i < nGridPointsPerRank; i++) {
+		BOOST_REQUIRE_EQUAL(readConcs[i].size(), myConcs[i].size());
+		for (int n = 0; n < myConcs[i].size(); n++) {
+			BOOST_REQUIRE_EQUAL(readConcs[i][n].first, myConcs[i][n].first);
+			BOOST_REQUIRE_CLOSE(
+				readConcs[i][n].second, myConcs[i][n].second, 0.0001);
+		}
+	}
+
+	// Select a range of values with both layouts
+	const int firstValue = 1;
+	const int nRange = 3;
+	for (auto group : {denseGroup.get(), raggedGroup.get()}) {
+		auto rangeConcs = group->readDenseConcentrations(
+			testFile, baseX, nGridPointsPerRank, firstValue, nRange);
+		BOOST_REQUIRE_EQUAL(rangeConcs.size(), nGridPointsPerRank * nRange);
+		for (int i = 0; i < nGridPointsPerRank; i++) {
+			for (int l = 0; l < nRange; l++) {
+				BOOST_REQUIRE_CLOSE(rangeConcs[i * nRange + l],
+					myDenseConcs[i * nValues + firstValue + l], 0.0001);
+			}
+		}
+	}
+}
+
+/**
+ * Method checking that the concentrations are read in place with a grid
+ * decomposition different from the one used to write them.
+ */
+BOOST_AUTO_TEST_CASE(checkRestartRead)
+{
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+	const int nGridPointsPerRank = 3;
+	const int nValues = 5;
+
+	// The value l of grid point x, only the even ones are written
+	auto value = [nValues](int x, int l) { return 1.0 + x * nValues + l; };
+
+	// Write both layouts in two time steps
+	const std::string testFileName = "test_restart.h5";
+	{
+		int baseX = commRank * nGridPointsPerRank;
+		XFile::TimestepGroup::DenseConcsType myDenseConcs(
+			nGridPointsPerRank * nValues, 0.0);
+		XFile::TimestepGroup::Concs1DType myConcs(nGridPointsPerRank);
+		for (int i = 0; i < nGridPointsPerRank; i++) {
+			for (int l = 0; l < nValues; l += 2) {
+				myDenseConcs[i * nValues + l] = value(baseX + i, l);
+				myConcs[i].emplace_back(l, value(baseX + i, l));
+			}
+		}
+
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto denseGroup = concGroup->addTimestepGroup(0, 0, 0.1, 0.0, 0.1);
+		denseGroup->writeDenseConcentrations(
+			testFile, baseX, nGridPointsPerRank, nValues, myDenseConcs);
+		auto raggedGroup = concGroup->addTimestepGroup(0, 1, 0.2, 0.1, 0.1);
+		raggedGroup->writeConcentrations(testFile, baseX, myConcs);
+	}
+
+	// Read back with the slabs in the reverse order and the first rank
+	// owning one more grid point than the others
+	int numX = nGridPointsPerRank;
+	int baseX = (commSize - 1 - commRank) * nGridPointsPerRank;
+	if (commSize > 1) {
+		if (commRank == 0)
+			numX++;
+		else if (commRank == 1)
+			numX--;
+		if (commRank == 0)
+			baseX--;
+	}
+
+	XFile testFile(
+		testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+	auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+	BOOST_REQUIRE(concGroup);
+	for (auto step : {0, 1}) {
+		auto tsGroup = concGroup->getTimestepGroup(0, step);
+		BOOST_REQUIRE(tsGroup);
+
+		// The values that are not in the file keep their initial value
+		// with the ragged layout
+		const double initial = -1.0;
+		std::vector<double> concs(numX * nValues, initial);
+		tsGroup->readConcentrations(
+			testFile, baseX, numX, 0, nValues, concs.data());
+		for (int i = 0; i < numX; i++) {
+			for (int l = 0; l < nValues; l++) {
+				double expected = value(baseX + i, l);
+				if (l % 2 == 1)
+					expected = (step == 0) ? 0.0 : initial;
+				BOOST_REQUIRE_EQUAL(concs[i * nValues + l], expected);
+			}
+		}
+	}
+}
+
+/**
+ * Method checking that a network written once in a shared file can be
+ * linked from other files, read through the link, and embedded back.
+ */
+BOOST_AUTO_TEST_CASE(checkNetworkLink)
+{
+	// Create the option to create a network
+	xolotl::options::Options opts;
+	// Create a good parameter file
+	std::string parameterFile = "param_link.txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "netParam=8 0 0 1 0" << std::endl;
+	paramFile.close();
+
+	// Create a fake command line to read the options
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	opts.readParams(cl.argc, cl.argv);
+
+	std::remove(parameterFile.c_str());
+
+	// Create the network
+	using NetworkType = xolotl::core::network::PSIReactionNetwork<
+		xolotl::core::network::PSIFullSpeciesList>;
+	NetworkType::AmountType maxV = opts.getMaxV();
+	NetworkType::AmountType maxI = opts.getMaxI();
+	NetworkType::AmountType maxHe = opts.getMaxImpurity();
+	NetworkType::AmountType maxD = opts.getMaxD();
+	NetworkType::AmountType maxT = opts.getMaxT();
+	NetworkType network({maxHe, maxD, maxT, maxV, maxI}, 1, opts);
+	int networkSize = network.getNumClusters();
+
+	// Like the monitors, only one process deals with the network
+	int commRank = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	if (commRank != 0)
+		return;
+
+	// The shared file is only written once
+	auto sharedPath = XFile::NetworkGroup::writeSharedFile(".", network);
+	BOOST_REQUIRE(fs::exists(sharedPath));
+	BOOST_REQUIRE_EQUAL(
+		XFile::NetworkGroup::writeSharedFile(".", network), sharedPath);
+
+	// Link two files to it
+	const std::vector<std::string> fileNames{
+		"test_link_a.h5", "test_link_b.h5"};
+	for (auto const& fileName : fileNames) {
+		XFile sharedFile(
+			sharedPath, MPI_COMM_SELF, XFile::AccessMode::OpenReadOnly);
+		auto sharedGroup = sharedFile.getGroup<XFile::NetworkGroup>();
+		BOOST_REQUIRE(sharedGroup);
+		BOOST_REQUIRE_EQUAL(sharedGroup->readHash(),
+			XFile::NetworkGroup::computeHash(network));
+
+		XFile file(fileName, 1, MPI_COMM_SELF);
+		sharedGroup->linkTo(file);
+	}
+
+	// Read the network through the link, then embed it in the second file
+	for (auto const& fileName : fileNames) {
+		XFile file(fileName, MPI_COMM_SELF, XFile::AccessMode::OpenReadWrite);
+		{
+			auto networkGroup = file.getGroup<XFile::NetworkGroup>();
+			BOOST_REQUIRE(networkGroup);
+			BOOST_REQUIRE_EQUAL(networkGroup->readNetworkSize(), networkSize);
+			XFile::ClusterGroup clusterGroup(*networkGroup, networkSize - 1);
+			double formationEnergy = 0.0, migrationEnergy = 0.0,
+				   diffusionFactor = 0.0;
+			clusterGroup.readCluster(
+				formationEnergy, migrationEnergy, diffusionFactor);
+			BOOST_REQUIRE_EQUAL(
+				network.getClusterCommon(networkSize - 1).getFormationEnergy(),
+				formationEnergy);
+		}
+
+		if (fileName == fileNames.back()) {
+			BOOST_REQUIRE(XFile::NetworkGroup::embed(file));
+			BOOST_REQUIRE(not XFile::NetworkGroup::embed(file));
+			auto networkGroup = file.getGroup<XFile::NetworkGroup>();
+			BOOST_REQUIRE(networkGroup);
+			BOOST_REQUIRE_EQUAL(networkGroup->readNetworkSize(), networkSize);
+		}
+	}
+
+	// Only the linked network lives in the shared file
+	for (auto const& fileName : fileNames) {
+		XFile file(fileName, MPI_COMM_SELF, XFile::AccessMode::OpenReadOnly);
+		auto networkGroup = file.getGroup<XFile::NetworkGroup>();
+		BOOST_REQUIRE(networkGroup);
+		BOOST_REQUIRE_EQUAL(networkGroup->isSharedFile(network),
+			fileName == fileNames.front());
+	}
+
+	// A shared file without the network is written again
+	{
+		XFile bogusFile(sharedPath, 1, MPI_COMM_SELF);
+	}
+	BOOST_REQUIRE_EQUAL(
+		XFile::NetworkGroup::writeSharedFile(".", network), sharedPath);
+	{
+		XFile sharedFile(
+			sharedPath, MPI_COMM_SELF, XFile::AccessMode::OpenReadOnly);
+		auto sharedGroup = sharedFile.getGroup<XFile::NetworkGroup>();
+		BOOST_REQUIRE(sharedGroup);
+		BOOST_REQUIRE(sharedGroup->isSharedFile(network));
+	}
+}
+
+/**
+ * Method checking the buffered writing of the time series in text files and
+ * in the HDF5 file.
+ */
+BOOST_AUTO_TEST_CASE(checkTimeSeries)
+{
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+	// Text files, each process writes its own
+	const std::string textFileName =
+		"test_series_" + std::to_string(commRank) + ".txt";
+	auto readLines = [&textFileName]() {
+		std::ifstream file(textFileName);
+		std::vector<std::string> lines;
+		std::string line;
+		while (std::getline(file, line)) {
+			lines.push_back(line);
+		}
+		return lines;
+	};
+	{
+		TimeSeriesWriter::Policy policy;
+		policy.maxRows = 2;
+		policy.maxSeconds = 1.0e6;
+		TimeSeriesWriter writer(policy);
+		writer.addSeries(textFileName, {"step", "time", "value"}, true, 6, 1);
+		BOOST_REQUIRE(writer.hasSeries(textFileName));
+		BOOST_REQUIRE_EQUAL(readLines().size(), 1);
+
+		// The rows are written by pairs
+		writer.addRow(textFileName, {1000000.0, 0.5, 1.0 / 3.0});
+		BOOST_REQUIRE_EQUAL(readLines().size(), 1);
+		writer.addRow(textFileName, {1000001.0, 1.5, 2.0});
+		BOOST_REQUIRE_EQUAL(readLines().size(), 3);
+		writer.addRow(textFileName, {1000002.0, 2.5, 3.0});
+		BOOST_REQUIRE_EQUAL(readLines().size(), 3);
+	}
+	// The rest is written when the writer is done
+	auto lines = readLines();
+	BOOST_REQUIRE_EQUAL(lines.size(), 4);
+	BOOST_REQUIRE_EQUAL(lines[0], "#step time value");
+	BOOST_REQUIRE_EQUAL(lines[1], "1000000 0.5 0.333333");
+	BOOST_REQUIRE_EQUAL(lines[3], "1000002 2.5 3");
+
+	// Appending to the file
+	{
+		TimeSeriesWriter writer;
+		writer.addSeries(textFileName, {"step", "time", "value"}, false, 6, 1);
+		writer.addRow(textFileName, {1000003.0, 3.5, 4.0});
+		writer.flush();
+		lines = readLines();
+		BOOST_REQUIRE_EQUAL(lines.size(), 5);
+		BOOST_REQUIRE_EQUAL(lines[4], "1000003 3.5 4");
+	}
+	std::remove(textFileName.c_str());
+
+	// HDF5 file, every process adds (rank + 1) rows, the last one too short
+	const std::string testFileName = "test_series.h5";
+	{
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+	}
+	const int nBatches = 2;
+	{
+		TimeSeriesWriter::Policy policy;
+		policy.format = TimeSeriesWriter::Format::hdf5;
+		TimeSeriesWriter writer(policy);
+		writer.addSeries("series.txt", {"time", "rank", "value"}, true);
+		for (int batch = 0; batch < nBatches; batch++) {
+			for (int r = 0; r <= commRank; r++) {
+				if (r == commRank)
+					writer.addRow("series.txt", {(double)batch, (double)r});
+				else
+					writer.addRow("series.txt",
+						{(double)batch, (double)commRank, (double)r});
+			}
+			auto rows = writer.takeRows();
+
+			XFile testFile(
+				testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadWrite);
+			rows.write(testFile);
+		}
+	}
+	// No text file in that case
+	BOOST_REQUIRE(not fs::exists("series.txt"));
+
+	// Read the file to check the rows, in the order of the processes
+	{
+		XFile testFile(
+			testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+		auto seriesGroup = testFile.getGroup<XFile::TimeSeriesGroup>();
+		BOOST_REQUIRE(seriesGroup);
+		BOOST_REQUIRE(seriesGroup->hasSeries("series"));
+		auto columns = seriesGroup->readColumns("series");
+		BOOST_REQUIRE_EQUAL(columns.size(), 3);
+		BOOST_REQUIRE_EQUAL(columns[2], "value");
+
+		auto rows = seriesGroup->readRows("series");
+		int rowsPerBatch = commSize * (commSize + 1) / 2;
+		BOOST_REQUIRE_EQUAL(rows.size(), nBatches * rowsPerBatch);
+		int n = 0;
+		for (int batch = 0; batch < nBatches; batch++) {
+			for (int rank = 0; rank < commSize; rank++) {
+				for (int r = 0; r <= rank; r++, n++) {
+					BOOST_REQUIRE_EQUAL(rows[n].size(), 3);
+					BOOST_REQUIRE_EQUAL(rows[n][0], (double)batch);
+					if (r == rank) {
+						BOOST_REQUIRE_EQUAL(rows[n][1], (double)r);
+						BOOST_REQUIRE(std::isnan(rows[n][2]));
+					}
+					else {
+						BOOST_REQUIRE_EQUAL(rows[n][1], (double)rank);
+						BOOST_REQUIRE_EQUAL(rows[n][2], (double)r);
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Method checking that the rows written by several processes to the same
+ * text series all end up in the file.
+ */
+BOOST_AUTO_TEST_CASE(checkSharedTimeSeries)
+{
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+	// Like the monitors, the master process starts the file
+	const std::string textFileName = "test_series_shared.txt";
+	{
+		TimeSeriesWriter writer;
+		writer.addSeries(textFileName, {"time", "rank"}, commRank == 0, 6, 1);
+		MPI_Barrier(MPI_COMM_WORLD);
+
+		// The other processes write first, the master process last
+		for (int rank = commSize - 1; rank >= 0; rank--) {
+			if (rank == commRank) {
+				writer.addRow(textFileName, {(double)rank, (double)rank});
+				writer.flush();
+			}
+			MPI_Barrier(MPI_COMM_WORLD);
+		}
+	}
+
+	// Every row is there, in the order in which it was written
+	std::ifstream file(textFileName);
+	std::vector<std::string> lines;
+	std::string line;
+	while (std::getline(file, line)) {
+		lines.push_back(line);
+	}
+	BOOST_REQUIRE_EQUAL(lines.size(), commSize + 1);
+	BOOST_REQUIRE_EQUAL(lines[0], "#time rank");
+	for (int rank = 0; rank < commSize; rank++) {
+		BOOST_REQUIRE_EQUAL(lines[commSize - rank],
+			std::to_string(rank) + " " + std::to_string(rank));
+	}
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if (commRank == 0)
+		std::remove(textFileName.c_str());
+}
+
+/**
+ * Method checking the dense concentrations of 2D and 3D grids, read with a
+ * grid decomposition different from the one used to write them.
+ */
+BOOST_AUTO_TEST_CASE(checkDenseGridConcentrations)
+{
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+	const int nX = 2 * commSize, nY = 2 * commSize;
+	const int nValues = 3;
+
+	// The value l of grid point (x, y, z)
+	auto value = [=](int x, int y, int z, int l) {
+		return 1.0 + ((z * nY + y) * nX + x) * nValues + l;
+	};
+
+	// A 2D grid in the first time step, a 3D one in the second
+	const std::string testFileName = "test_dense_grid.h5";
+	const std::array<int, 2> nZs{1, 2};
+	{
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		for (auto step : {0, 1}) {
+			// Each process writes a slab along y
+			int nZ = nZs[step];
+			int baseY = commRank * 2;
+			XFile::TimestepGroup::DenseConcsType myConcs;
+			for (int z = 0; z < nZ; z++)
+				for (int y = baseY; y < baseY + 2; y++)
+					for (int x = 0; x < nX; x++)
+						for (int l = 0; l < nValues; l++)
+							myConcs.push_back(value(x, y, z, l));
+
+			auto tsGroup =
+				concGroup->addTimestepGroup(0, step, 0.1 * step, 0.0, 0.1);
+			tsGroup->writeDenseConcentrations(
+				testFile, 0, nX, baseY, 2, 0, nZ, nValues, myConcs);
+			BOOST_REQUIRE(tsGroup->hasDenseGridConcentrations());
+			BOOST_REQUIRE(!tsGroup->hasDenseConcentrations());
+		}
+	}
+
+	// Read back with each process owning a slab along x, with one more
+	// value than in the file that must stay untouched
+	XFile testFile(
+		testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+	auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+	BOOST_REQUIRE(concGroup);
+	for (auto step : {0, 1}) {
+		auto tsGroup = concGroup->getTimestepGroup(0, step);
+		BOOST_REQUIRE(tsGroup);
+		BOOST_REQUIRE(tsGroup->hasDenseGridConcentrations());
+
+		int nZ = nZs[step];
+		int baseX = commRank * 2;
+		const double initial = -1.0;
+		std::vector<double> concs(nZ * nY * 2 * (nValues + 1), initial);
+		tsGroup->readConcentrations(
+			testFile, baseX, 2, 0, nY, 0, nZ, nValues + 1, concs.data());
+		std::size_t n = 0;
+		for (int z = 0; z < nZ; z++)
+			for (int y = 0; y < nY; y++)
+				for (int x = baseX; x < baseX + 2; x++) {
+					for (int l = 0; l < nValues; l++)
+						BOOST_REQUIRE_EQUAL(concs[n++], value(x, y, z, l));
+					BOOST_REQUIRE_EQUAL(concs[n++], initial);
+				}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
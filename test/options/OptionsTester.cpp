@@ -125,6 +125,9 @@ BOOST_AUTO_TEST_CASE(goodParamFile)
 		<< "fissionYield=0.3" << std::endl
 		<< "heVRatio=5.0" << std::endl
 		<< "migrationThreshold=1.0" << std::endl
+		<< "tempUpdateTolerance=0.5" << std::endl
+		<< "rateTable=300 1500 0.5" << std::endl
+		<< "checkpointThread=true" << std::endl
 		<< "fluxDepthProfileFilePath=path/to/the/flux/profile/file.txt"
 		<< std::endl;
 	goodParamFile.close();
@@ -229,6 +232,21 @@ BOOST_AUTO_TEST_CASE(goodParamFile)
 	// Check the migration threshold option
 	BOOST_REQUIRE_EQUAL(opts.getMigrationThreshold(), 1.0);
 
+	// Check the temperature update options
+	BOOST_REQUIRE_EQUAL(opts.getTempUpdate(), "local");
+	BOOST_REQUIRE_EQUAL(opts.getTempUpdateTolerance(), 0.5);
+	BOOST_REQUIRE_EQUAL(opts.getTempUpdateRelTolerance(), 0.0);
+
+	// Check the rate table option
+	auto rateTable = opts.getRateTable();
+	BOOST_REQUIRE_EQUAL(rateTable.size(), 3);
+	BOOST_REQUIRE_EQUAL(rateTable[0], 300.0);
+	BOOST_REQUIRE_EQUAL(rateTable[1], 1500.0);
+	BOOST_REQUIRE_EQUAL(rateTable[2], 0.5);
+
+	// Check the background checkpoint option
+	BOOST_REQUIRE_EQUAL(opts.useCheckpointThread(), true);
+
 	// Check the network filename
 	BOOST_REQUIRE_EQUAL(opts.getFluxDepthProfileFilePath(),
 		"path/to/the/flux/profile/file.txt");
@@ -318,6 +336,106 @@ BOOST_AUTO_TEST_CASE(wrongPerfHandler)
 	std::remove(tempFile.c_str());
 }
 
+BOOST_AUTO_TEST_CASE(wrongRateStorage)
+{
+	Options opts;
+
+	// Create a parameter file with a wrong rate storage name
+	std::ofstream paramFile("param_rate_wrong.txt");
+	paramFile << "rateStorage=bogus" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_rate_wrong.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing a wrong rate
+	// storage option
+	const char* argv[] = {"./xolotl", fname};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), bpo::invalid_option_value);
+
+	// Remove the created file
+	std::string tempFile = "param_rate_wrong.txt";
+	std::remove(tempFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(wrongFluxAccumulation)
+{
+	Options opts;
+
+	// Create a parameter file with a wrong flux accumulation name
+	std::ofstream paramFile("param_flux_acc_wrong.txt");
+	paramFile << "fluxAccumulation=bogus" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_flux_acc_wrong.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing a wrong flux
+	// accumulation option
+	const char* argv[] = {"./xolotl", fname};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), bpo::invalid_option_value);
+
+	// Remove the created file
+	std::string tempFile = "param_flux_acc_wrong.txt";
+	std::remove(tempFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(wrongTempUpdate)
+{
+	Options opts;
+
+	// Create a parameter file with a wrong temperature update name
+	std::ofstream paramFile("param_temp_update_wrong.txt");
+	paramFile << "tempUpdate=bogus" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_temp_update_wrong.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing a wrong
+	// temperature update option
+	const char* argv[] = {"./xolotl", fname};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), bpo::invalid_option_value);
+
+	// Remove the created file
+	std::string tempFile = "param_temp_update_wrong.txt";
+	std::remove(tempFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(wrongRateTable)
+{
+	Options opts;
+
+	// Create a parameter file with a rate table missing its step
+	std::ofstream paramFile("param_rate_table_wrong.txt");
+	paramFile << "rateTable=300 1500" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_rate_table_wrong.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing a wrong
+	// rate table option
+	const char* argv[] = {"./xolotl", fname};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), bpo::invalid_option_value);
+
+	// Remove the created file
+	std::string tempFile = "param_rate_table_wrong.txt";
+	std::remove(tempFile.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(wrongVizHandler)
 {
 	Options opts;
@@ -0,0 +1,110 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <boost/test/framework.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <xolotl/solver/handler/TemperatureChangeTracker.h>
+#include <xolotl/test/MPITestUtils.h>
+
+using namespace std;
+using namespace xolotl;
+using namespace solver;
+using namespace handler;
+
+// Initialize MPI before running any tests; finalize it running all tests.
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+/**
+ * This suite is responsible for testing the TemperatureChangeTracker.
+ */
+BOOST_AUTO_TEST_SUITE(TemperatureChangeTracker_testSuite)
+
+/**
+ * Method checking that the first update always goes through.
+ */
+BOOST_AUTO_TEST_CASE(firstUpdate)
+{
+	TemperatureChangeTracker tracker(1000.0, 1.0, false);
+	BOOST_REQUIRE(!tracker.hasChanged());
+
+	// The network temperature was never set
+	double networkTemp = 0.0;
+	BOOST_REQUIRE(tracker.update(networkTemp, 0.5, 3));
+	BOOST_REQUIRE_EQUAL(networkTemp, 0.5);
+	BOOST_REQUIRE(tracker.hasChanged());
+	BOOST_REQUIRE_EQUAL(tracker.getChangedIds().size(), 1);
+	BOOST_REQUIRE_EQUAL(tracker.getChangedIds()[0], 3);
+
+	// The next one uses the tolerances
+	tracker.clear();
+	BOOST_REQUIRE(!tracker.update(networkTemp, 900.0, 3));
+	BOOST_REQUIRE_EQUAL(networkTemp, 0.5);
+	BOOST_REQUIRE(!tracker.hasChanged());
+}
+
+/**
+ * Method checking that the larger of the absolute and relative tolerances
+ * is used.
+ */
+BOOST_AUTO_TEST_CASE(tolerances)
+{
+	// The absolute tolerance wins: max(2.0, 0.001 * 1000.0) = 2.0
+	TemperatureChangeTracker tracker(2.0, 0.001, false);
+	double networkTemp = 1000.0;
+	BOOST_REQUIRE(!tracker.update(networkTemp, 1001.5, 0));
+	BOOST_REQUIRE(!tracker.update(networkTemp, 998.0, 0));
+	BOOST_REQUIRE_EQUAL(networkTemp, 1000.0);
+	BOOST_REQUIRE(tracker.update(networkTemp, 1002.5, 0));
+	BOOST_REQUIRE_EQUAL(networkTemp, 1002.5);
+
+	// The relative tolerance wins: max(2.0, 0.01 * 1000.0) = 10.0
+	tracker.setPolicy(2.0, 0.01, false);
+	tracker.clear();
+	networkTemp = 1000.0;
+	BOOST_REQUIRE(!tracker.update(networkTemp, 1009.0, 0));
+	BOOST_REQUIRE(!tracker.update(networkTemp, 991.0, 0));
+	BOOST_REQUIRE_EQUAL(networkTemp, 1000.0);
+	BOOST_REQUIRE(tracker.update(networkTemp, 989.0, 1));
+	BOOST_REQUIRE_EQUAL(networkTemp, 989.0);
+
+	// A slow drift is compared to the last update, not the last value
+	tracker.clear();
+	networkTemp = 1000.0;
+	BOOST_REQUIRE(!tracker.update(networkTemp, 1006.0, 2));
+	BOOST_REQUIRE(tracker.update(networkTemp, 1012.0, 2));
+	BOOST_REQUIRE_EQUAL(networkTemp, 1012.0);
+	BOOST_REQUIRE_EQUAL(tracker.getChangedIds().size(), 1);
+	BOOST_REQUIRE_EQUAL(tracker.getChangedIds()[0], 2);
+}
+
+/**
+ * Method checking that all the processes agree on a collective update as
+ * soon as one of them sees a change.
+ */
+BOOST_AUTO_TEST_CASE(collectiveDecision)
+{
+	// Determine where we are in the MPI world.
+	int commRank = test::getMPIRank();
+
+	// Nobody changed
+	TemperatureChangeTracker tracker(0.1, 0.0, false);
+	double networkTemp = 1000.0;
+	tracker.update(networkTemp, 1000.0, 0);
+	BOOST_REQUIRE(!tracker.needsUpdate(false));
+	BOOST_REQUIRE(!tracker.needsUpdate(true));
+
+	// Only the first process changed
+	tracker.update(networkTemp, commRank == 0 ? 1001.0 : 1000.0, 0);
+	BOOST_REQUIRE_EQUAL(tracker.hasChanged(), commRank == 0);
+	BOOST_REQUIRE_EQUAL(tracker.needsUpdate(false), commRank == 0);
+	BOOST_REQUIRE(tracker.needsUpdate(true));
+
+	// The global policy always agrees
+	tracker.setPolicy(0.1, 0.0, true);
+	BOOST_REQUIRE(tracker.needsUpdate(false));
+	tracker.clear();
+	BOOST_REQUIRE(!tracker.needsUpdate(false));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
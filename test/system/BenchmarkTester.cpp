@@ -34,6 +34,30 @@ BOOST_AUTO_TEST_CASE(NE_1)
 	SystemTestCase{"benchmark_NE_1"}.withTimer().run();
 }
 
+BOOST_AUTO_TEST_CASE(NE_1_type)
+{
+	if (getMPICommSize() > 1) {
+		return;
+	}
+	// Same as NE_1 with one reaction kernel per reaction type
+	SystemTestCase{"benchmark_NE_1_type"}
+		.sameOutputAs("benchmark_NE_1")
+		.withTimer()
+		.run();
+}
+
+BOOST_AUTO_TEST_CASE(NE_1_gather)
+{
+	if (getMPICommSize() > 1) {
+		return;
+	}
+	// Same as NE_1 with the fluxes gathered without atomics
+	SystemTestCase{"benchmark_NE_1_gather"}
+		.sameOutputAs("benchmark_NE_1")
+		.withTimer()
+		.run();
+}
+
 BOOST_AUTO_TEST_CASE(NE_2)
 {
 	if (getMPICommSize() > 1) {
@@ -79,6 +103,32 @@ BOOST_AUTO_TEST_CASE(PSI_1)
 	SystemTestCase{"benchmark_PSI_1"}.tolerance(1.0e-5).withTimer().run();
 }
 
+BOOST_AUTO_TEST_CASE(PSI_1_type)
+{
+	if (getMPICommSize() > 100) {
+		return;
+	}
+	// Same as PSI_1 with one reaction kernel per reaction type
+	SystemTestCase{"benchmark_PSI_1_type"}
+		.sameOutputAs("benchmark_PSI_1")
+		.tolerance(1.0e-5)
+		.withTimer()
+		.run();
+}
+
+BOOST_AUTO_TEST_CASE(PSI_1_gather)
+{
+	if (getMPICommSize() > 100) {
+		return;
+	}
+	// Same as PSI_1 with the fluxes gathered without atomics
+	SystemTestCase{"benchmark_PSI_1_gather"}
+		.sameOutputAs("benchmark_PSI_1")
+		.tolerance(1.0e-5)
+		.withTimer()
+		.run();
+}
+
 BOOST_AUTO_TEST_CASE(PSI_2)
 {
 	if (getMPICommSize() > 1) {
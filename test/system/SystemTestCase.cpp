@@ -263,7 +263,8 @@ bool SystemTestCase::_timeAll = false;
 SystemTestCase::SystemTestCase(
 	const std::string& caseName, const std::string& outputFileName) :
 	_caseName(caseName),
-	_outputFileName(outputFileName)
+	_outputFileName(outputFileName),
+	_expectedCaseName(caseName)
 {
 	if (_timeAll) {
 		_enableTimer = true;
@@ -328,12 +329,12 @@ SystemTestCase::run() const
 	if (getMPIRank() == 0) {
 		if (_approve) {
 			xolotl::fs::copy_file("./" + _outputFileName,
-				_dataDir + "/output/" + _caseName + ".txt",
+				_dataDir + "/output/" + _expectedCaseName + ".txt",
 				xolotl::fs::copy_options::overwrite_existing);
 		}
 		else {
 			checkOutput("./" + _outputFileName,
-				_dataDir + "/output/" + _caseName + ".txt");
+				_dataDir + "/output/" + _expectedCaseName + ".txt");
 		}
 	}
 }
@@ -41,6 +41,17 @@ public:
 		return *this;
 	}
 
+	/**
+	 * Compare against the expected output of another case (for variants of
+	 * a case that must give the same results)
+	 */
+	SystemTestCase&
+	sameOutputAs(const std::string& caseName)
+	{
+		_expectedCaseName = caseName;
+		return *this;
+	}
+
 	void
 	run() const;
 
@@ -66,6 +77,7 @@ private:
 
 	const std::string _caseName;
 	const std::string _outputFileName;
+	std::string _expectedCaseName;
 
 	double _tolerance{defaultTolerance};
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include <string>
 
@@ -32,7 +33,13 @@ main(int argc, char* argv[])
 		bool shouldRun = true;
 		bpo::options_description desc("Supported options");
 		desc.add_options()("help", "show this help message")(
-			"infile", bpo::value<std::string>(), "input file name");
+			"infile", bpo::value<std::string>(), "input file name")("layout",
+			bpo::value<std::string>()->default_value("ragged"),
+			"layout of the converted concentrations: ragged (index, value "
+			"pairs) or dense (chunked and compressed grid point x value "
+			"array)")("embed-network",
+			"replace a network group linked from another file by a copy, "
+			"instead of converting the concentrations");
 
 		bpo::variables_map opts;
 		bpo::store(bpo::parse_command_line(argc, argv, desc), opts);
@@ -50,6 +57,26 @@ main(int argc, char* argv[])
 			ret = 1;
 		}
 
+		auto layout = opts["layout"].as<std::string>();
+		if (layout != "ragged" and layout != "dense") {
+			std::cerr << "layout must be ragged or dense" << std::endl;
+			shouldRun = false;
+			ret = 1;
+		}
+
+		if (shouldRun and opts.count("embed-network")) {
+			// Copy the network in place of the link.
+			xolotl::io::XFile xfile(opts["infile"].as<std::string>(),
+				MPI_COMM_WORLD, xolotl::io::XFile::AccessMode::OpenReadWrite);
+			if (xolotl::io::XFile::NetworkGroup::embed(xfile)) {
+				std::cout << "Embedded the linked network" << std::endl;
+			}
+			else {
+				std::cout << "The network is not a link" << std::endl;
+			}
+			shouldRun = false;
+		}
+
 		if (shouldRun) {
 			std::string fname = opts["infile"].as<std::string>();
 
@@ -75,29 +102,69 @@ main(int argc, char* argv[])
 			xolotl::io::HDF5File::Attribute<int> nxAttr(*tsGroup, "nx");
 			auto nx = nxAttr.get();
 
-			// Convert the last written timestep's concentrations to
-			// the new representation.
+			// Read the last written timestep's concentrations from
+			// whichever representation it has.
 			xolotl::io::XFile::TimestepGroup::Concs1DType allConcs(nx);
-			for (auto x = 0; x < nx; ++x) {
-				// Read the concentrations for the current position.
-				std::ostringstream dsNameStr;
-				dsNameStr << "position_" << x << "-1_-1";
-				std::string dsName = dsNameStr.str();
-				std::cout << "Reading conc data for gridpoint " << x
-						  << " from dataset " << dsName << std::endl;
-				auto oldData = tsGroup->readGridPoint(x);
-				auto nConcs = oldData.size();
-
-				// Store into our ragged 2D representation.
-				for (auto i = 0; i < nConcs; ++i) {
-					auto l = oldData[i][0];
-					auto conc = oldData[i][1];
-					allConcs[x].emplace_back(l, conc);
+			bool dense = (layout == "dense");
+			if (tsGroup->hasDenseConcentrations()) {
+				if (dense) {
+					throw std::runtime_error(
+						"Concentrations already use the dense layout.");
+				}
+				std::cout << "Reading dense conc data" << std::endl;
+				allConcs = tsGroup->readConcentrations(xfile, 0, nx);
+			}
+			else if (tsGroup->hasRaggedConcentrations()) {
+				if (not dense) {
+					throw std::runtime_error(
+						"Concentrations already use the ragged layout.");
+				}
+				std::cout << "Reading ragged conc data" << std::endl;
+				allConcs = tsGroup->readConcentrations(xfile, 0, nx);
+			}
+			else {
+				for (auto x = 0; x < nx; ++x) {
+					// Read the concentrations for the current position.
+					std::ostringstream dsNameStr;
+					dsNameStr << "position_" << x << "-1_-1";
+					std::string dsName = dsNameStr.str();
+					std::cout << "Reading conc data for gridpoint " << x
+							  << " from dataset " << dsName << std::endl;
+					auto oldData = tsGroup->readGridPoint(x);
+					auto nConcs = oldData.size();
+
+					// Store into our ragged 2D representation.
+					for (auto i = 0; i < nConcs; ++i) {
+						auto l = oldData[i][0];
+						auto conc = oldData[i][1];
+						allConcs[x].emplace_back(l, conc);
+					}
 				}
 			}
 
 			// Write the dataset to the file.
-			tsGroup->writeConcentrations(xfile, 0, allConcs);
+			if (dense) {
+				// The temperature is the last value of each grid point.
+				int numValues = 1;
+				for (auto const& concs : allConcs) {
+					for (auto const& [l, conc] : concs) {
+						numValues = std::max(numValues, l + 1);
+					}
+				}
+
+				xolotl::io::XFile::TimestepGroup::DenseConcsType denseConcs(
+					(std::size_t)nx * numValues, 0.0);
+				for (auto x = 0; x < nx; ++x) {
+					for (auto const& [l, conc] : allConcs[x]) {
+						denseConcs[(std::size_t)x * numValues + l] = conc;
+					}
+				}
+				tsGroup->writeDenseConcentrations(
+					xfile, 0, nx, numValues, denseConcs);
+			}
+			else {
+				tsGroup->writeConcentrations(xfile, 0, allConcs);
+			}
 		}
 	}
 	catch (std::exception& e) {
@@ -2,6 +2,9 @@
 #define ADVECTIONHANDLER_H
 
 // Includes
+#include <cstdint>
+#include <vector>
+
 #include <xolotl/core/Constants.h>
 #include <xolotl/core/advection/IAdvectionHandler.h>
 
@@ -32,6 +35,17 @@ protected:
 	//! The number of dimensions of the problem
 	int dimension;
 
+	//! Cluster-major copy of 3 * A * D / (K * T) for the advecting clusters
+	//! at each point of the network grid (same notation as computeAdvection)
+	mutable std::vector<double> advectionCoefs;
+
+	//! The network version of the diffusion coefficients used for them
+	mutable std::uint64_t advectionCoefsVersion{0};
+
+	//! Buffers used by applyLineStencil and the derived classes
+	mutable std::vector<double> stencilWeights, gradWeights, lineConcs,
+		lineFluxes;
+
 public:
 	//! The Constructor
 	AdvectionHandler() : location(0.0), dimension(0)
@@ -108,6 +122,52 @@ public:
 	{
 		return location;
 	}
+
+protected:
+	/**
+	 * Get 3 * A * D / (K * T) for the advecting clusters, cluster-major,
+	 * computing it again only if the diffusion coefficients changed since the
+	 * last call.
+	 */
+	const double*
+	getAdvectionCoefficients(network::IReactionNetwork& network) const;
+
+	/**
+	 * Apply to n points of a line of the grid in the x direction the
+	 * advection term of each advecting cluster
+	 *
+	 * c(ix + 1) * sum_s [w_s * C_s] + [c(ix + 2) - c(ix + 1)] * g * C_0
+	 *
+	 * where c = 3 * A * D / (K * T), C_s is the concentration at the s-th
+	 * point of the stencil (the first one being the middle point), w_s its
+	 * weight and g the gradient weight, both given for each point. The
+	 * concentrations of a cluster are first gathered in contiguous buffers
+	 * so that the loops computing the fluxes can be vectorized.
+	 *
+	 * @param stencilLines The line of each point of the stencil, indexed by
+	 * the position on the x grid
+	 * @param stencilShifts The shift in the x direction of each point of the
+	 * stencil
+	 * @param nStencil The number of points in the stencil
+	 * @param weights The weights of the stencil points, nStencil arrays of n
+	 * values
+	 * @param grads The gradient weights (nullptr if there is no such term)
+	 * @param mask The mask of the middle line for the first advecting
+	 * cluster, indexed by ix + 1 + shift (nullptr if there is no mask)
+	 * @param maskStride The distance between the masks of two clusters
+	 * @param updatedConcLine The line of updated concentrations
+	 * @param pointMask Not zero for the points where the advection is
+	 * computed
+	 * @param xs The position on the x grid of ix = 0
+	 * @param ix0 The position ix of the first point
+	 * @param n The number of points
+	 */
+	void
+	applyLineStencil(network::IReactionNetwork& network,
+		double** const* stencilLines, const int* stencilShifts, int nStencil,
+		const double* weights, const double* grads, const std::uint8_t* mask,
+		std::size_t maskStride, double** updatedConcLine,
+		const std::uint8_t* pointMask, int xs, int ix0, int n) const;
 };
 // end class AdvectionHandler
 
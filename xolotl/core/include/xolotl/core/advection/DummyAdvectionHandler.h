@@ -72,6 +72,20 @@ public:
 		return;
 	}
 
+	/**
+	 * \see IAdvectionHandler.h
+	 */
+	void
+	computeAdvectionLine(network::IReactionNetwork& network,
+		const plsm::SpaceVector<double, 3>& linePos, const double* xPositions,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double hy = 0.0, int iy = 0, double hz = 0.0, int iz = 0) const override
+	{
+		// Doesn't do anything
+		return;
+	}
+
 	/**
 	 * \see IAdvectionHandler.h
 	 */
@@ -3,6 +3,7 @@
 
 // Includes
 #include <array>
+#include <cstdint>
 #include <memory>
 
 #include <plsm/SpaceVector.h>
@@ -106,6 +107,43 @@ public:
 		double* updatedConcOffset, double hxLeft, double hxRight, int ix,
 		double hy = 0.0, int iy = 0, double hz = 0.0, int iz = 0) const = 0;
 
+	/**
+	 * Compute the flux due to the advection for all the helium clusters on a
+	 * whole line of the locally owned grid in the x direction. It gives the
+	 * same result as calling computeAdvection on each point of the line
+	 * where pointMask is not zero, but the geometric factors are computed
+	 * once per point and the clusters are visited in the outer loop so that
+	 * the inner loop on the grid points can be vectorized.
+	 *
+	 * @param network The network
+	 * @param linePos The position of the line on the grid (only the y and z
+	 * positions are used)
+	 * @param xPositions The x position of each point of the line
+	 * @param concLines The lines of concentrations, indexed by the position
+	 * on the x grid (ghost points included), for the middle line then the
+	 * bottom/top/front/back ones
+	 * @param updatedConcLine The line of updated concentrations
+	 * @param hxLeft The step sizes on the left side of each point of the
+	 * line in the x direction
+	 * @param hxRight The step sizes on the right side of each point of the
+	 * line in the x direction
+	 * @param pointMask Not zero for the points of the line where the
+	 * advection is computed
+	 * @param xs The beginning of the grid on this process, first point of
+	 * the line
+	 * @param xm The number of points in the line
+	 * @param hy The step size in the y direction
+	 * @param iy The position of the line on the y grid
+	 * @param hz The step size in the z direction
+	 * @param iz The position of the line on the z grid
+	 */
+	virtual void
+	computeAdvectionLine(network::IReactionNetwork& network,
+		const plsm::SpaceVector<double, 3>& linePos, const double* xPositions,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double hy = 0.0, int iy = 0, double hz = 0.0, int iz = 0) const = 0;
+
 	/**
 	 * Compute the partial derivatives due to the advection of all the helium
 	 * clusters given the space parameters and the position. This method is
@@ -18,9 +18,41 @@ namespace advection
  */
 class SurfaceAdvectionHandler : public AdvectionHandler
 {
-private:
-	//! The vector to know which clusters are moving where
-	std::vector<std::vector<std::vector<std::vector<bool>>>> advectionGrid;
+protected:
+	/**
+	 * Cluster-major mask of the grid points where each advecting cluster is
+	 * moving: the value for the c-th advecting cluster at the (i, j, k) point
+	 * is advectionGrid[c * nGridPoints + getGridPointIndex(i, j, k)].
+	 */
+	std::vector<std::uint8_t> advectionGrid;
+
+	//! The number of points of the advection grid in the x and y directions
+	int gridNx{0}, gridNy{0};
+
+	//! The number of points of the advection grid
+	std::size_t nGridPoints{0};
+
+	/**
+	 * Get the index of the (i, j, k) point in the advection grid of a
+	 * cluster.
+	 */
+	std::size_t
+	getGridPointIndex(int i, int j, int k) const
+	{
+		return ((std::size_t)k * gridNy + j) * gridNx + i;
+	}
+
+	/**
+	 * Compute the advection on n points of a line starting at ix0.
+	 *
+	 * \see AdvectionHandler::applyLineStencil
+	 */
+	void
+	computeLineAdvection(network::IReactionNetwork& network,
+		const double* xPositions, double*** concLines,
+		double** updatedConcLine, const double* hxLeft, const double* hxRight,
+		const std::uint8_t* pointMask, int xs, int ix0, int n, int iy,
+		int iz) const;
 
 public:
 	//! The Constructor
@@ -63,6 +95,17 @@ public:
 		double hy = 0.0, int iy = 0, double hz = 0.0,
 		int iz = 0) const override;
 
+	/**
+	 * \see IAdvectionHandler.h
+	 */
+	void
+	computeAdvectionLine(network::IReactionNetwork& network,
+		const plsm::SpaceVector<double, 3>& linePos, const double* xPositions,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double hy = 0.0, int iy = 0, double hz = 0.0,
+		int iz = 0) const override;
+
 	/**
 	 * Compute the partials due to the advection of all the helium clusters
 	 * given the space parameter hx and the position. This method is called by
@@ -64,6 +64,17 @@ public:
 		double hy = 0.0, int iy = 0, double hz = 0.0,
 		int iz = 0) const override;
 
+	/**
+	 * \see IAdvectionHandler.h
+	 */
+	void
+	computeAdvectionLine(network::IReactionNetwork& network,
+		const plsm::SpaceVector<double, 3>& linePos, const double* xPositions,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double hy = 0.0, int iy = 0, double hz = 0.0,
+		int iz = 0) const override;
+
 	/**
 	 * \see IAdvectionHandler.h
 	 */
@@ -95,6 +106,18 @@ public:
 		// Return true if pos[2] is equal to location
 		return fabs(location - pos[2]) < 0.001;
 	}
+
+private:
+	/**
+	 * Compute the advection on n points of a line starting at ix0.
+	 *
+	 * \see AdvectionHandler::applyLineStencil
+	 */
+	void
+	computeLineAdvection(network::IReactionNetwork& network,
+		const plsm::SpaceVector<double, 3>& linePos, double*** concLines,
+		double** updatedConcLine, const std::uint8_t* pointMask, int xs,
+		int ix0, int n, double hz) const;
 };
 // end class ZGBAdvectionHandler
 
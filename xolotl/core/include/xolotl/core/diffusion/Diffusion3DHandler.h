@@ -16,10 +16,6 @@ namespace diffusion
  */
 class Diffusion3DHandler : public DiffusionHandler
 {
-private:
-	//! The vector to know which clusters are diffusing where
-	std::vector<std::vector<std::vector<std::vector<bool>>>> diffusionGrid;
-
 public:
 	//! The Constructor
 	Diffusion3DHandler(double threshold) : DiffusionHandler(threshold)
@@ -61,6 +57,16 @@ public:
 		double sy = 0.0, int iy = 0, double sz = 0.0,
 		int iz = 0) const override;
 
+	/**
+	 * \see IDiffusionHandler.h
+	 */
+	void
+	computeDiffusionLine(network::IReactionNetwork& network,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double sy = 0.0, int iy = 0, double sz = 0.0,
+		int iz = 0) const override;
+
 	/**
 	 * Compute the partials due to the diffusion of all the diffusing clusters
 	 * given the space parameters. This method is called by the RHSJacobian from
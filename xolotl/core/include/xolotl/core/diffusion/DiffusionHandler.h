@@ -2,6 +2,9 @@
 #define DIFFUSIONHANDLER_H
 
 // Includes
+#include <cstdint>
+#include <vector>
+
 #include <xolotl/core/diffusion/IDiffusionHandler.h>
 #include <xolotl/util/MathUtils.h>
 
@@ -25,6 +28,30 @@ protected:
 	//! Migration energy threshold
 	double migrationThreshold;
 
+	/**
+	 * Cluster-major mask of the grid points (ghosts included) where each
+	 * diffusing cluster is diffusing: the value for the d-th diffusing
+	 * cluster at the point (i, j, k) is
+	 * diffusionGrid[d * nGridPoints + getGridPointIndex(i, j, k)].
+	 */
+	std::vector<std::uint8_t> diffusionGrid;
+
+	//! The number of points of the diffusion grid in each direction
+	int gridNx{0}, gridNy{1}, gridNz{1};
+
+	//! The number of points of the diffusion grid
+	std::size_t nGridPoints{0};
+
+	//! Cluster-major copy of the diffusion coefficients of the diffusing
+	//! clusters at each point of the network grid
+	mutable std::vector<double> diffusionCoefs;
+
+	//! The network version of the copied diffusion coefficients
+	mutable std::uint64_t diffusionCoefsVersion{0};
+
+	//! Buffers used by computeLineDiffusion
+	mutable std::vector<double> stencilFactors, lineConcs, lineFluxes;
+
 public:
 	//! The Constructor
 	DiffusionHandler(double threshold) : migrationThreshold(threshold)
@@ -49,8 +76,9 @@ public:
 	initializeOFill(network::IReactionNetwork& network,
 		network::IReactionNetwork::SparseFillMap& ofillMap) override
 	{
-		// Clear the index vector
+		// Clear the index vector and the copied coefficients
 		diffusingClusters.clear();
+		diffusionCoefs.clear();
 
 		// Consider each cluster
 		for (std::size_t i = 0; i < network.getNumClusters(); i++) {
@@ -95,6 +123,66 @@ public:
 	{
 		return diffusingClusters;
 	}
+
+protected:
+	/**
+	 * Allocate the diffusion grid with the given number of points (ghosts
+	 * included) in each direction, setting it to true everywhere.
+	 */
+	void
+	allocateDiffusionGrid(int nx, int ny = 1, int nz = 1)
+	{
+		gridNx = nx;
+		gridNy = ny;
+		gridNz = nz;
+		nGridPoints = (std::size_t)nx * ny * nz;
+		diffusionGrid.assign(diffusingClusters.size() * nGridPoints, 1);
+	}
+
+	/**
+	 * Get the index of the (i, j, k) point (ghosts included) in the
+	 * diffusion grid of a cluster.
+	 */
+	std::size_t
+	getGridPointIndex(int i, int j = 0, int k = 0) const
+	{
+		return ((std::size_t)k * gridNy + j) * gridNx + i;
+	}
+
+	/**
+	 * Set the diffusion grid to false for the given advecting clusters at
+	 * the (i, j, k) point.
+	 */
+	void
+	removeAdvectingClusters(
+		const std::vector<IdType>& advecClusters, int i, int j = 0, int k = 0);
+
+	/**
+	 * Get the diffusion coefficients of the diffusing clusters, cluster-major,
+	 * copying them from the network only if they changed since the last call.
+	 */
+	const double*
+	getDiffusionCoefficients(network::IReactionNetwork& network) const;
+
+	/**
+	 * Apply the stencil to a line of the grid in the x direction for each
+	 * diffusing cluster. The concentrations of a cluster on the line are
+	 * first gathered in a contiguous buffer, already masked by the diffusion
+	 * grid, so that the loop computing the fluxes only reads contiguous
+	 * arrays and can be vectorized.
+	 *
+	 * @param nTransverse The number of pairs of neighbor lines (0, 1, or 2)
+	 * @param maskRows The indices in the diffusion grid of the first point
+	 * of the middle line, then of each neighbor line
+	 * @param s The space parameters of each pair of neighbor lines
+	 *
+	 * \see IDiffusionHandler.h for the other parameters
+	 */
+	void
+	computeLineDiffusion(network::IReactionNetwork& network,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		int nTransverse, const std::size_t* maskRows, const double* s) const;
 };
 // end class DiffusionHandler
 
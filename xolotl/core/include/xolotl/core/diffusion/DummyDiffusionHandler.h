@@ -81,6 +81,24 @@ public:
 		return;
 	}
 
+	/**
+	 * Compute the flux due to the diffusion for all the cluster that are
+	 * diffusing on a line of the grid.
+	 *
+	 * Here it won't do anything because it is a dummy class.
+	 *
+	 * \see IDiffusionHandler.h
+	 */
+	void
+	computeDiffusionLine(network::IReactionNetwork& network,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double sy = 0.0, int iy = 0, double sz = 0.0,
+		int iz = 0) const override
+	{
+		return;
+	}
+
 	/**
 	 * Compute the partials due to the diffusion of all the diffusing clusters
 	 * given the space parameters. This method is called by the RHSJacobian from
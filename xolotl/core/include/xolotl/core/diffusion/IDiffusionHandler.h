@@ -2,6 +2,7 @@
 #define IDIFFUSIONHANDLER_H
 
 // Includes
+#include <cstdint>
 #include <memory>
 
 #include <xolotl/config.h>
@@ -90,6 +91,41 @@ public:
 		double* updatedConcOffset, double hxLeft, double hxRight, int ix,
 		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) const = 0;
 
+	/**
+	 * Compute the flux due to the diffusion for all the clusters that are
+	 * diffusing on a whole line of the locally owned grid in the x direction
+	 * (the whole locally owned grid in 1D). It gives the same result as
+	 * calling computeDiffusion on each point of the line where pointMask is
+	 * not zero, but the clusters are visited in the outer loop so that the
+	 * inner loop on the grid points can be vectorized.
+	 *
+	 * @param network The network
+	 * @param concLines The lines of concentrations, indexed by the position
+	 * on the x grid (ghost points included), for the middle line then the
+	 * bottom/top/front/back ones
+	 * @param updatedConcLine The line of updated concentrations
+	 * @param hxLeft The step sizes on the left side of each point of the
+	 * line in the x direction
+	 * @param hxRight The step sizes on the right side of each point of the
+	 * line in the x direction
+	 * @param pointMask Not zero for the points of the line where the
+	 * diffusion is computed
+	 * @param xs The beginning of the grid on this process, first point of
+	 * the line
+	 * @param xm The number of points in the line
+	 * @param sy The space parameter, depending on the grid step size in the y
+	 * direction
+	 * @param iy The position of the line on the y grid
+	 * @param sz The space parameter, depending on the grid step size in the z
+	 * direction
+	 * @param iz The position of the line on the z grid
+	 */
+	virtual void
+	computeDiffusionLine(network::IReactionNetwork& network,
+		double*** concLines, double** updatedConcLine, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) const = 0;
+
 	/**
 	 * Compute the partials due to the diffusion of all the diffusing clusters
 	 * given the space parameters. This method is called by the RHSJacobian from
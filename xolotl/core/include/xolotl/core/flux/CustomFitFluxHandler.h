@@ -36,6 +36,11 @@ private:
 	 */
 	std::vector<double> normFactors;
 
+	/**
+	 * The incident flux profiles for a unit amplitude and reduction factor.
+	 */
+	std::vector<std::vector<double>> fluxProfiles;
+
 	/**
 	 * File path for custom profiles
 	 */
@@ -53,7 +58,7 @@ private:
 			return 0.0;
 
 		// Compute the polynomial fit
-		auto params = fitParams[i];
+		const auto& params = fitParams[i];
 		double value = params[0] + params[1] * x + params[2] * pow(x, 2.0) +
 			params[3] * pow(x, 3.0) + params[4] * pow(x, 4.0) +
 			params[5] * pow(x, 5.0) + params[6] * pow(x, 6.0) +
@@ -98,6 +103,7 @@ public:
 		totalDepths.clear();
 		reductionFactors.clear();
 		normFactors.clear();
+		fluxProfiles.clear();
 
 		// Set the grid
 		xGrid = grid;
@@ -199,6 +205,7 @@ public:
 					// arbitrary amplitude
 					normFactors.push_back(0.0);
 					incidentFluxVec.push_back(std::vector<double>());
+					fluxProfiles.push_back(std::vector<double>());
 					// Loop on the x grid points skipping the first after the
 					// surface position and last because of the boundary
 					// conditions
@@ -212,37 +219,10 @@ public:
 							FitFunction(x, index) * (xGrid[i + 1] - xGrid[i]);
 					}
 
-					// Factor the incident flux will be multiplied by to get
-					// the wanted intensity
-					double fluxNormalized = 0.0;
-					if (normFactors[index] > 0.0) {
-						fluxNormalized = fluxAmplitude *
-							reductionFactors[index] / normFactors[index];
-					}
-
-					// Clear the flux vector
-					incidentFluxVec[index].clear();
-					// The first value corresponding to the surface position
-					// should always be 0.0
-					incidentFluxVec[index].push_back(0.0);
-
-					// Starts at i = surfacePos + 1 because the first value was
-					// already put in the vector
-					for (int i = surfacePos + 1; i < xGrid.size() - 3; i++) {
-						// Get the x position
-						auto x = (xGrid[i] + xGrid[i + 1]) / 2.0 -
-							xGrid[surfacePos + 1];
-
-						// Compute the flux value
-						double incidentFlux =
-							fluxNormalized * FitFunction(x, index);
-						// Add it to the vector
-						incidentFluxVec[index].push_back(incidentFlux);
-					}
-
-					// The last value should always be 0.0 because of boundary
-					// conditions
-					incidentFluxVec[index].push_back(0.0);
+					// Compute the profile and scale it with the amplitude
+					computeFluxProfile(index, surfacePos);
+					incidentFluxVec[index].resize(fluxProfiles[index].size());
+					scaleFluxProfile(index);
 				}
 
 				// Read the next line
@@ -252,6 +232,8 @@ public:
 				index++;
 			}
 
+			profileSurfacePos = surfacePos;
+
 			// Prints both incident vectors in a file
 			if (procId == 0 && incidentFluxVec.size() > 0) {
 				std::ofstream outputFile;
@@ -283,10 +265,15 @@ public:
 	computeIncidentFlux(
 		double currentTime, double* updatedConcOffset, int xi, int surfacePos)
 	{
-		// Recompute the flux vector if a time profile is used
+		// Recompute the flux vector if a time profile is used and the time
+		// changed, or if the surface differs from the one of the profile
+		// (each line of a 2D/3D grid has its own)
 		if (useTimeProfile) {
-			fluxAmplitude = getProfileAmplitude(currentTime);
-			recomputeFluxHandler(surfacePos);
+			bool timeChanged = updateProfileAmplitude(currentTime);
+			if ((timeChanged || surfacePos != profileSurfacePos) &&
+				xGrid.size() > 0) {
+				recomputeFluxHandler(surfacePos);
+			}
 		}
 
 		if (xGrid.size() == 0) {
@@ -316,25 +303,15 @@ public:
 	{
 		// Loop on the different types of clusters
 		for (int index = 0; index < fluxIndices.size(); index++) {
-			// Factor the incident flux will be multiplied by
-			double fluxNormalized = 0.0;
-			if (normFactors[index] > 0.0)
-				fluxNormalized = fluxAmplitude * reductionFactors[index] /
-					normFactors[index];
-
-			// Starts a i = surfacePos + 1 because the first values were already
-			// put in the vector
-			for (int i = surfacePos + 1; i < xGrid.size() - 3; i++) {
-				// Get the x position
-				auto x =
-					(xGrid[i] + xGrid[i + 1]) / 2.0 - xGrid[surfacePos + 1];
-
-				// Compute the flux value
-				double incidentFlux = fluxNormalized * FitFunction(x, index);
-				// Add it to the vector
-				incidentFluxVec[index][i - surfacePos] = incidentFlux;
+			// The profile only has to be computed again if the surface moved
+			if (surfacePos != profileSurfacePos) {
+				computeFluxProfile(index, surfacePos);
+				incidentFluxVec[index].resize(fluxProfiles[index].size());
 			}
+
+			scaleFluxProfile(index);
 		}
+		profileSurfacePos = surfacePos;
 
 		// Gets the process ID
 		int procId;
@@ -361,6 +338,58 @@ public:
 		return;
 	}
 
+	/**
+	 * Compute the profile of the given cluster type for a unit amplitude
+	 * and reduction factor.
+	 *
+	 * @param index The index of the cluster type
+	 * @param surfacePos The current position of the surface
+	 */
+	void
+	computeFluxProfile(int index, int surfacePos)
+	{
+		// Factor the fit function will be multiplied by
+		double unitNormalized = 0.0;
+		if (normFactors[index] > 0.0)
+			unitNormalized = 1.0 / normFactors[index];
+
+		auto& profile = fluxProfiles[index];
+		profile.clear();
+		// The first value corresponding to the surface position should
+		// always be 0.0
+		profile.push_back(0.0);
+
+		// Starts at i = surfacePos + 1 because the first value was already
+		// put in the vector
+		for (int i = surfacePos + 1; i < xGrid.size() - 3; i++) {
+			// Get the x position
+			auto x = (xGrid[i] + xGrid[i + 1]) / 2.0 - xGrid[surfacePos + 1];
+
+			// Compute the profile value
+			profile.push_back(unitNormalized * FitFunction(x, index));
+		}
+
+		// The last value should always be 0.0 because of boundary conditions
+		profile.push_back(0.0);
+	}
+
+	/**
+	 * Set the incident flux of the given cluster type from its profile,
+	 * the amplitude, and the reduction factor.
+	 *
+	 * @param index The index of the cluster type
+	 */
+	void
+	scaleFluxProfile(int index)
+	{
+		double factor = fluxAmplitude * reductionFactors[index];
+		const auto& profile = fluxProfiles[index];
+		auto& fluxVec = incidentFluxVec[index];
+		for (std::size_t i = 0; i < profile.size(); i++) {
+			fluxVec[i] = factor * profile[i];
+		}
+	}
+
 	std::vector<double>
 	getInstantFlux(double time) const
 	{
@@ -76,6 +76,28 @@ protected:
 	 */
 	std::vector<double> amplitudes;
 
+	/**
+	 * The incident flux profile for a unit amplitude, incidentFluxVec[0] is
+	 * this profile times fluxAmplitude.
+	 */
+	std::vector<double> fluxProfile;
+
+	/**
+	 * The surface position used to compute fluxProfile.
+	 */
+	int profileSurfacePos;
+
+	/**
+	 * The last time at which the time profile was evaluated.
+	 */
+	double profileTime;
+
+	/**
+	 * The index k of the last time profile interval used,
+	 * time[k] <= currentTime <= time[k + 1].
+	 */
+	mutable std::size_t profileInterval;
+
 	/**
 	 * Function that calculates the flux at a given position x (in nm).
 	 * It needs to be implemented by the daughter classes.
@@ -99,9 +121,31 @@ protected:
 	double
 	getProfileAmplitude(double currentTime) const;
 
+	/**
+	 * This method sets the flux amplitude from the time profile at the
+	 * given time. It doesn't do anything if it was already called with the
+	 * same time, which is the case for all the grid points of a RHS
+	 * evaluation but the first one.
+	 *
+	 * @param currentTime The time
+	 * @return True if the amplitude was evaluated again
+	 */
+	bool
+	updateProfileAmplitude(double currentTime);
+
+	/**
+	 * This method computes the incident flux profile for a unit amplitude.
+	 *
+	 * @param surfacePos The current position of the surface
+	 */
+	void
+	computeFluxProfile(int surfacePos);
+
 	/**
 	 * This method recomputes the values of the incident flux vector when
-	 * conditions changed in the simulation.
+	 * conditions changed in the simulation. The profile is only computed
+	 * again if the surface moved, otherwise it is scaled by the new
+	 * amplitude.
 	 *
 	 * @param surfacePos The current position of the surface
 	 */
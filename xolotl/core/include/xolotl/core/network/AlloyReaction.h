@@ -23,6 +23,10 @@ public:
 	KOKKOS_INLINE_FUNCTION
 	double
 	getRateForProduction(IndexType gridIndex);
+
+	KOKKOS_INLINE_FUNCTION
+	void
+	computeRateConstants();
 };
 
 class AlloyDissociationReaction :
@@ -38,6 +42,10 @@ public:
 	double
 	getRateForProduction(IndexType gridIndex);
 
+	KOKKOS_INLINE_FUNCTION
+	void
+	computeRateConstants();
+
 	KOKKOS_INLINE_FUNCTION
 	double
 	computeBindingEnergy(double time = 0.0);
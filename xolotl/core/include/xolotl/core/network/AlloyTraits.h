@@ -77,6 +77,9 @@ struct ReactionNetworkTraits<AlloyReactionNetwork>
 
 	static constexpr std::size_t numSpecies = 6;
 
+	//! Cached rate terms: the binding energy then the capture factor
+	static constexpr std::size_t numRateConstants = 2;
+
 	using ProductionReactionType = AlloyProductionReaction;
 	using DissociationReactionType = AlloyDissociationReaction;
 	using SinkReactionType = AlloySinkReaction;
@@ -4,6 +4,7 @@
 #include <unordered_map>
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_DualView.hpp>
 
 #include <xolotl/core/network/Cluster.h>
 #include <xolotl/core/network/SpeciesId.h>
@@ -31,6 +32,13 @@ public:
 	using OwnedConcentrationsView = Kokkos::View<double*>;
 	using FluxesView = Kokkos::View<double*, Kokkos::MemoryUnmanaged>;
 	using OwnedFluxesView = Kokkos::View<double*>;
+	using ConcentrationsBatchView =
+		Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::MemoryUnmanaged>;
+	using FluxesBatchView =
+		Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::MemoryUnmanaged>;
+	using PartialsBatchView =
+		Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::MemoryUnmanaged>;
+	using GridIndicesView = Kokkos::DualView<IndexType*>;
 	using RatesView = Kokkos::View<double**>;
 	using ConnectivitiesView = Kokkos::View<bool**>;
 	using SubMapView = Kokkos::View<AmountType*, Kokkos::MemoryUnmanaged>;
@@ -293,6 +301,16 @@ public:
 	setTemperatures(const std::vector<double>& gridTemperatures,
 		const std::vector<double>& gridDepths) = 0;
 
+	/**
+	 * @brief Same as above but only the diffusion coefficients and rates
+	 * at the given grid indices are updated, the other grid points are
+	 * expected to keep their previous temperature.
+	 */
+	virtual void
+	setTemperatures(const std::vector<double>& gridTemperatures,
+		const std::vector<double>& gridDepths,
+		const std::vector<IndexType>& changedGridIndices) = 0;
+
 	/**
 	 * @brief To update time dependent rates.
 	 */
@@ -311,6 +329,32 @@ public:
 	virtual ClusterCommon<plsm::HostMemSpace>
 	getClusterCommon(IndexType clusterId) = 0;
 
+	/**
+	 * @brief Copies the diffusion coefficients of the given clusters at every
+	 * grid point to coefs, cluster-major: coefs[i * gridSize + gridIndex]
+	 * is the coefficient of clusterIds[i].
+	 *
+	 * Unlike getClusterCommon, this does not synchronize the whole cluster
+	 * data on host.
+	 */
+	virtual void
+	getDiffusionCoefficients(
+		const std::vector<IdType>& clusterIds, std::vector<double>& coefs) = 0;
+
+	/**
+	 * @brief Returns a counter incremented every time the diffusion
+	 * coefficients are updated, to know when a copy of them is outdated.
+	 */
+	virtual std::uint64_t
+	getDiffusionCoefficientsVersion() const noexcept = 0;
+
+	/**
+	 * @brief Copies the temperature at each grid point to temperatures (they
+	 * are updated along with the diffusion coefficients).
+	 */
+	virtual void
+	getTemperatures(std::vector<double>& temperatures) = 0;
+
 	virtual ClusterCommon<plsm::HostMemSpace>
 	getSingleVacancy() = 0;
 
@@ -373,6 +417,20 @@ public:
 		IndexType gridIndex = 0, double surfaceDepth = 0.0,
 		double spacing = 0.0) = 0;
 
+	/**
+	 * @brief Updates the fluxes view with the rates from all the
+	 * reactions at a batch of grid points, in a single kernel launch.
+	 *
+	 * Row b of the concentrations and fluxes views holds the data for the
+	 * grid point gridIndices(b), rows with an invalid grid index are skipped.
+	 * The depths and spacings are given per row.
+	 */
+	virtual void
+	computeAllFluxes(ConcentrationsBatchView concentrations,
+		FluxesBatchView fluxes, const GridIndicesView& gridIndices,
+		const std::vector<double>& surfaceDepths,
+		const std::vector<double>& spacings) = 0;
+
 	/**
 	 * @brief Updates the values view with the rates from all the
 	 * reactions at this grid point, they are used by the RHS Jacobian.
@@ -382,6 +440,19 @@ public:
 		Kokkos::View<double*> values, IndexType gridIndex = 0,
 		double surfaceDepth = 0.0, double spacing = 0.0) = 0;
 
+	/**
+	 * @brief Updates the values view with the partial derivatives from all
+	 * the reactions at a batch of grid points, in a single kernel launch.
+	 *
+	 * Row b of the values view holds the partials for the grid point
+	 * gridIndices(b), rows with an invalid grid index are left at zero.
+	 */
+	virtual void
+	computeAllPartials(ConcentrationsBatchView concentrations,
+		PartialsBatchView values, const GridIndicesView& gridIndices,
+		const std::vector<double>& surfaceDepths,
+		const std::vector<double>& spacings) = 0;
+
 	/**
 	 * @brief Updates the rates view with the rates from all the
 	 * reactions at this grid point, this is for multiple instances use.
@@ -43,6 +43,9 @@ public:
 	using IndexType = typename Superclass::IndexType;
 	using ConcentrationsView = typename Superclass::ConcentrationsView;
 	using FluxesView = typename Superclass::FluxesView;
+	using ConcentrationsBatchView =
+		typename Superclass::ConcentrationsBatchView;
+	using GridIndicesView = typename Superclass::GridIndicesView;
 
 	using Superclass::Superclass;
 
@@ -93,19 +96,52 @@ public:
 	updateExtraClusterData(const std::vector<double>& gridTemps,
 		const std::vector<double>& gridDepths);
 
+	/**
+	 * @brief Updates the trap-mutation table entries of a grid point, only
+	 * copying them to the device when its depth or spacing changed
+	 */
 	void
-	selectTrapMutationReactions(double surfaceDepth, double spacing);
+	selectTrapMutationReactions(
+		IndexType gridIndex, double surfaceDepth, double spacing);
+
+	/**
+	 * @brief Same for all the valid rows of a batch, with a single copy to
+	 * the device
+	 */
+	void
+	selectTrapMutationReactions(const GridIndicesView& gridIndices,
+		const std::vector<double>& surfaceDepths,
+		const std::vector<double>& spacings);
+
+	/**
+	 * @brief The trap-mutation data is stored per grid index, so rows
+	 * sharing one (2D/3D batches) are processed one by one
+	 */
+	bool
+	requiresPointwisePreProcess(const GridIndicesView& gridIndices) const;
 
 	void
 	computeFluxesPreProcess(ConcentrationsView concentrations,
 		FluxesView fluxes, IndexType gridIndex, double surfaceDepth,
 		double spacing);
 
+	void
+	computeFluxesBatchPreProcess(ConcentrationsBatchView concentrations,
+		const GridIndicesView& gridIndices,
+		const std::vector<double>& surfaceDepths,
+		const std::vector<double>& spacings);
+
 	void
 	computePartialsPreProcess(ConcentrationsView concentrations,
 		Kokkos::View<double*> values, IndexType gridIndex, double surfaceDepth,
 		double spacing);
 
+	void
+	computePartialsBatchPreProcess(ConcentrationsBatchView concentrations,
+		const GridIndicesView& gridIndices,
+		const std::vector<double>& surfaceDepths,
+		const std::vector<double>& spacings);
+
 	double
 	getTotalTrappedHeliumConcentration(
 		ConcentrationsView concs, AmountType minSize = 0) override
@@ -124,6 +160,10 @@ public:
 	void
 	updateReactionRates(double time = 0.0);
 
+	void
+	updateReactionRates(
+		Kokkos::View<const IndexType*> gridIndices, double time = 0.0);
+
 	void
 	updateTrapMutationDisappearingRate(double totalTrappedHeliumConc) override;
 
@@ -131,7 +171,29 @@ public:
 	updateDesorptionLeftSideRate(
 		ConcentrationsView concentrations, IndexType gridIndex);
 
+	void
+	updateDesorptionLeftSideRates(ConcentrationsBatchView concentrations,
+		const GridIndicesView& gridIndices);
+
 private:
+	void
+	updateTrapMutationRates();
+
+	/**
+	 * @brief Reallocates the trap-mutation grid point tables if the grid
+	 * size changed
+	 */
+	void
+	checkTrapMutationGridSize();
+
+	/**
+	 * @brief Fills the host table entries of a grid point from its depth and
+	 * spacing, returns whether they were out of date
+	 */
+	bool
+	fillTrapMutationTable(
+		IndexType gridIndex, double surfaceDepth, double spacing);
+
 	double
 	checkLatticeParameter(double latticeParameter);
 
@@ -153,6 +215,19 @@ private:
 
 private:
 	std::unique_ptr<detail::TrapMutationHandler> _tmHandler;
+
+	//! The desorption cluster, kept on the host for the left side rate
+	IndexType _desorptionId{Superclass::invalidIndex()};
+
+	//! Host copy of the trap-mutation table, 7 entries per grid point
+	Kokkos::View<bool*, Kokkos::HostSpace> _tmEnabledHost;
+
+	//! Depth and spacing each grid point of the table was filled for
+	std::vector<double> _tmSurfaceDepths;
+	std::vector<double> _tmSpacings;
+
+	//! Left side rate of the desorption cluster for each row of a batch
+	Kokkos::View<double*> _desorpRowRates;
 };
 
 namespace detail
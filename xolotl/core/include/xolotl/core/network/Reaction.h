@@ -9,8 +9,11 @@
 #include <xolotl/core/network/IReactionNetwork.h>
 #include <xolotl/core/network/ReactionNetworkTraits.h>
 #include <xolotl/core/network/SpeciesEnumSequence.h>
+#include <xolotl/core/network/detail/ClusterReactionMap.h>
 #include <xolotl/core/network/detail/ClusterSet.h>
+#include <xolotl/core/network/detail/FluxGatherMap.h>
 #include <xolotl/core/network/detail/ReactionData.h>
+#include <xolotl/core/network/detail/TemperatureLattice.h>
 #include <xolotl/util/Array.h>
 
 namespace xolotl
@@ -57,6 +60,12 @@ public:
 		plsm::Region<plsm::DifferenceType<typename Region::ScalarType>,
 			Props::numSpeciesNoI>;
 
+	//! Whether the flux contributions can be written to slots of a buffer
+	static constexpr bool hasFluxSlots = false;
+
+	//! Whether the rate only depends on the temperature and can be tabulated
+	static constexpr bool hasTabulatedRate = false;
+
 	Reaction() = default;
 
 	KOKKOS_INLINE_FUNCTION
@@ -71,11 +80,58 @@ public:
 	void
 	updateRates(double time = 0.0)
 	{
-		for (IndexType i = 0; i < _rate.extent(0); ++i) {
-			_rate(i) = asDerived()->computeRate(i, time);
+		for (IndexType s = 0; s < _rate.getNumberOfSlots(); ++s) {
+			_rate.slot(s) =
+				asDerived()->computeRate(_rate.getSlotGridIndex(s), time);
+		}
+	}
+
+	/**
+	 * @brief Updates the rate at a single grid point.
+	 */
+	KOKKOS_INLINE_FUNCTION
+	void
+	updateRate(IndexType gridIndex, double time = 0.0)
+	{
+		_rate(gridIndex) = asDerived()->computeRate(gridIndex, time);
+	}
+
+	/**
+	 * @brief Fills the row of this reaction in the rate table, the cluster
+	 * data having one grid point per lattice temperature.
+	 */
+	KOKKOS_INLINE_FUNCTION
+	void
+	tabulateRates(Kokkos::View<double**> table)
+	{
+		for (IndexType k = 0; k < table.extent(1); ++k) {
+			table(_reactionId, k) = asDerived()->computeRate(k);
 		}
 	}
 
+	/**
+	 * @brief Updates the rates by interpolating the rate table, computing
+	 * them only at the temperatures outside of the lattice.
+	 */
+	KOKKOS_INLINE_FUNCTION
+	void
+	updateRates(const detail::TemperatureLattice& lattice,
+		Kokkos::View<const double**> table, double time = 0.0)
+	{
+		for (IndexType s = 0; s < _rate.getNumberOfSlots(); ++s) {
+			_rate.slot(s) = getTabulatedRate(
+				_rate.getSlotGridIndex(s), lattice, table, time);
+		}
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	void
+	updateRate(IndexType gridIndex, const detail::TemperatureLattice& lattice,
+		Kokkos::View<const double**> table, double time = 0.0)
+	{
+		_rate(gridIndex) = getTabulatedRate(gridIndex, lattice, table, time);
+	}
+
 	/**
 	 * @brief Computes the contribution to the connectivity
 	 * (which cluster interacts with which one).
@@ -99,6 +155,13 @@ public:
 		asDerived()->computeReducedConnectivity(connectivity);
 	}
 
+	KOKKOS_INLINE_FUNCTION
+	IndexType
+	getId() const noexcept
+	{
+		return _reactionId;
+	}
+
 	KOKKOS_INLINE_FUNCTION
 	void
 	contributeFlux(ConcentrationsView concentrations, FluxesView fluxes,
@@ -107,6 +170,48 @@ public:
 		asDerived()->computeFlux(concentrations, fluxes, gridIndex);
 	}
 
+	/**
+	 * @brief Computes the flux contributions into the slots of the buffer
+	 * starting at slotBegin if the reaction has flux slots, directly into
+	 * the fluxes otherwise.
+	 *
+	 * @see detail::FluxGatherMap
+	 */
+	KOKKOS_INLINE_FUNCTION
+	void
+	contributeFlux(ConcentrationsView concentrations, FluxesView fluxes,
+		FluxesView slotBuffer, IndexType slotBegin, IndexType gridIndex)
+	{
+		if constexpr (TDerived::hasFluxSlots) {
+			detail::SlotFluxAccumulator acc{slotBuffer, slotBegin};
+			asDerived()->accumulateFlux(concentrations, acc, gridIndex);
+		}
+		else {
+			asDerived()->computeFlux(concentrations, fluxes, gridIndex);
+		}
+	}
+
+	/**
+	 * @brief Records the cluster targeted by each flux slot starting at
+	 * slotBegin (only counts them if targets is empty).
+	 *
+	 * @return The number of flux slots of the reaction
+	 */
+	KOKKOS_INLINE_FUNCTION
+	IndexType
+	recordFluxTargets(ConcentrationsView concentrations,
+		Kokkos::View<IndexType*> targets, IndexType slotBegin)
+	{
+		if constexpr (TDerived::hasFluxSlots) {
+			detail::FluxTargetRecorder recorder{targets, slotBegin};
+			asDerived()->accumulateFlux(concentrations, recorder, 0);
+			return recorder.slot - slotBegin;
+		}
+		else {
+			return 0;
+		}
+	}
+
 	/**
 	 * @brief Computes the contribution to the Jacobian.
 	 */
@@ -162,6 +267,24 @@ public:
 			concentrations, clusterId, gridIndex);
 	}
 
+	/**
+	 * @brief Records the clusters for which the reaction contributes to the
+	 * left side rate, starting at entryBegin (only counts them if clusters
+	 * is empty).
+	 *
+	 * @return The number of such clusters
+	 * @see detail::ClusterReactionMap
+	 */
+	KOKKOS_INLINE_FUNCTION
+	IndexType
+	recordLeftSideClusters(
+		Kokkos::View<IndexType*> clusters, IndexType entryBegin)
+	{
+		detail::LeftSideClusterRecorder recorder{clusters, entryBegin};
+		asDerived()->mapLeftSideClusters(recorder);
+		return recorder.entry - entryBegin;
+	}
+
 	KOKKOS_INLINE_FUNCTION
 	void
 	defineJacobianEntries(Connectivity connectivity)
@@ -182,6 +305,7 @@ protected:
 	initialize()
 	{
 		asDerived()->computeCoefficients();
+		asDerived()->computeRateConstants();
 		updateRates();
 	}
 
@@ -220,6 +344,38 @@ protected:
 		connectivity.add(rowId, columnId);
 	}
 
+	/**
+	 * @brief No left side rate contribution by default.
+	 */
+	template <typename TRecorder>
+	KOKKOS_INLINE_FUNCTION
+	void
+	mapLeftSideClusters(TRecorder&)
+	{
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	double
+	getTabulatedRate(IndexType gridIndex,
+		const detail::TemperatureLattice& lattice,
+		Kokkos::View<const double**> table, double time)
+	{
+		double temp = _clusterData->temperature(gridIndex);
+		if (lattice.contains(temp)) {
+			return lattice.interpolate(table, _reactionId, temp);
+		}
+		return asDerived()->computeRate(gridIndex, time);
+	}
+
+	/**
+	 * @brief No temperature independent rate terms to cache by default.
+	 */
+	KOKKOS_INLINE_FUNCTION
+	void
+	computeRateConstants()
+	{
+	}
+
 protected:
 	const ClusterData* _clusterData;
 
@@ -229,6 +385,11 @@ protected:
 	using RateSubView = decltype(std::declval<ReactionDataRef>().getRates(0));
 	RateSubView _rate;
 
+	//! Temperature independent terms of the rate
+	using RateConstantsSubView =
+		decltype(std::declval<ReactionDataRef>().getRateConstants(0));
+	RateConstantsSubView _rateConstants;
+
 	//! Reaction widths
 	using WidthSubView = decltype(std::declval<ReactionDataRef>().getWidths(0));
 	WidthSubView _widths;
@@ -269,6 +430,10 @@ public:
 	using ClusterData = typename Superclass::ClusterData;
 	using ReflectedRegion = typename Superclass::ReflectedRegion;
 
+	static constexpr bool hasFluxSlots = true;
+
+	static constexpr bool hasTabulatedRate = true;
+
 	ProductionReaction() = default;
 
 	KOKKOS_INLINE_FUNCTION
@@ -312,6 +477,12 @@ private:
 	computeFlux(ConcentrationsView concentrations, FluxesView fluxes,
 		IndexType gridIndex);
 
+	template <typename TAccumulator>
+	KOKKOS_INLINE_FUNCTION
+	void
+	accumulateFlux(ConcentrationsView concentrations, TAccumulator& acc,
+		IndexType gridIndex);
+
 	KOKKOS_INLINE_FUNCTION
 	void
 	computePartialDerivatives(ConcentrationsView concentrations,
@@ -337,6 +508,11 @@ private:
 	computeLeftSideRate(ConcentrationsView concentrations, IndexType clusterId,
 		IndexType gridIndex);
 
+	template <typename TRecorder>
+	KOKKOS_INLINE_FUNCTION
+	void
+	mapLeftSideClusters(TRecorder& recorder);
+
 	KOKKOS_INLINE_FUNCTION
 	void
 	mapJacobianEntries(Connectivity connectivity);
@@ -385,6 +561,10 @@ public:
 	using ClusterData = typename Superclass::ClusterData;
 	using ReflectedRegion = typename Superclass::ReflectedRegion;
 
+	static constexpr bool hasFluxSlots = true;
+
+	static constexpr bool hasTabulatedRate = true;
+
 	DissociationReaction() = default;
 
 	KOKKOS_INLINE_FUNCTION
@@ -427,6 +607,12 @@ private:
 	computeFlux(ConcentrationsView concentrations, FluxesView fluxes,
 		IndexType gridIndex);
 
+	template <typename TAccumulator>
+	KOKKOS_INLINE_FUNCTION
+	void
+	accumulateFlux(ConcentrationsView concentrations, TAccumulator& acc,
+		IndexType gridIndex);
+
 	KOKKOS_INLINE_FUNCTION
 	void
 	computePartialDerivatives(ConcentrationsView concentrations,
@@ -452,11 +638,27 @@ private:
 	computeLeftSideRate(ConcentrationsView concentrations, IndexType clusterId,
 		IndexType gridIndex);
 
+	template <typename TRecorder>
+	KOKKOS_INLINE_FUNCTION
+	void
+	mapLeftSideClusters(TRecorder& recorder);
+
 	KOKKOS_INLINE_FUNCTION
 	void
 	mapJacobianEntries(Connectivity connectivity);
 
 protected:
+	/**
+	 * @brief Caches the binding energy, which must not depend on the
+	 * temperature (nor on the time)
+	 */
+	KOKKOS_INLINE_FUNCTION
+	void
+	computeRateConstants();
+
+	//! Position of the binding energy in the rate constants
+	static constexpr IndexType bindingEnergyIndex = 0;
+
 	IndexType _reactant;
 	double _reactantVolume;
 	static constexpr auto invalidIndex = Superclass::invalidIndex;
@@ -16,7 +16,11 @@
 #include <xolotl/core/network/IReactionNetwork.h>
 #include <xolotl/core/network/Reaction.h>
 #include <xolotl/core/network/SpeciesEnumSequence.h>
+#include <xolotl/core/network/detail/ClusterReactionMap.h>
+#include <xolotl/core/network/detail/FluxGatherMap.h>
+#include <xolotl/core/network/detail/NetworkCache.h>
 #include <xolotl/core/network/detail/ReactionCollection.h>
+#include <xolotl/core/network/detail/TemperatureLattice.h>
 #include <xolotl/options/IOptions.h>
 #include <xolotl/options/Options.h>
 
@@ -77,6 +81,11 @@ public:
 	using Ival = typename Region::IntervalType;
 	using ConcentrationsView = typename IReactionNetwork::ConcentrationsView;
 	using FluxesView = typename IReactionNetwork::FluxesView;
+	using ConcentrationsBatchView =
+		typename IReactionNetwork::ConcentrationsBatchView;
+	using FluxesBatchView = typename IReactionNetwork::FluxesBatchView;
+	using PartialsBatchView = typename IReactionNetwork::PartialsBatchView;
+	using GridIndicesView = typename IReactionNetwork::GridIndicesView;
 	using RatesView = typename IReactionNetwork::RatesView;
 	using ConnectivitiesView = typename IReactionNetwork::ConnectivitiesView;
 	using SubMapView = typename IReactionNetwork::SubMapView;
@@ -234,6 +243,11 @@ public:
 	setTemperatures(const std::vector<double>& gridTemperatures,
 		const std::vector<double>& gridDepths) override;
 
+	void
+	setTemperatures(const std::vector<double>& gridTemperatures,
+		const std::vector<double>& gridDepths,
+		const std::vector<IndexType>& changedGridIndices) override;
+
 	void
 	setTime(double time) override;
 
@@ -243,18 +257,35 @@ public:
 	void
 	syncClusterDataOnHost() override;
 
+	/**
+	 * @brief Drops the host copy of the cluster data, to be rebuilt on next
+	 * use. Only needed when the layout of the data changes, use
+	 * invalidateDataMirrorFields() when only values change.
+	 */
 	void
 	invalidateDataMirror()
 	{
-		_subpavingMirror.reset();
 		_clusterDataMirror.reset();
+		_staleMirrorFields = 0;
+	}
+
+	/**
+	 * @brief Marks some fields (detail::ClusterDataFields) of the host copy
+	 * of the cluster data as out of date. Only these are copied again on
+	 * next use.
+	 */
+	void
+	invalidateDataMirrorFields(unsigned fields) noexcept
+	{
+		_staleMirrorFields |= fields;
 	}
 
 	const SubpavingMirror&
 	getSubpavingMirror()
 	{
+		// The tiles never change once the network is built
 		if (!_subpavingMirror.has_value()) {
-			syncClusterDataOnHost();
+			_subpavingMirror = _subpaving.makeMirrorCopy();
 		}
 		return *_subpavingMirror;
 	}
@@ -265,6 +296,11 @@ public:
 		if (!_clusterDataMirror.has_value()) {
 			syncClusterDataOnHost();
 		}
+		else if (_staleMirrorFields != 0) {
+			_clusterDataMirror->deepCopyFields(
+				_clusterData.h_view(), _staleMirrorFields);
+			_staleMirrorFields = 0;
+		}
 		return *_clusterDataMirror;
 	}
 
@@ -322,6 +358,19 @@ public:
 		return getClusterDataMirror().getClusterCommon(clusterId);
 	}
 
+	void
+	getDiffusionCoefficients(const std::vector<IdType>& clusterIds,
+		std::vector<double>& coefs) override;
+
+	std::uint64_t
+	getDiffusionCoefficientsVersion() const noexcept override
+	{
+		return _diffusionCoefficientsVersion;
+	}
+
+	void
+	getTemperatures(std::vector<double>& temperatures) override;
+
 	ClusterCommon<plsm::HostMemSpace>
 	getSingleVacancy() override;
 
@@ -402,6 +451,35 @@ public:
 		IndexType gridIndex = 0, double surfaceDepth = 0.0,
 		double spacing = 0.0) final;
 
+	/**
+	 * @brief Whether the derived network needs per grid point
+	 * preprocessing before the fluxes of the given rows can be computed, in
+	 * which case the batched flux computation falls back to one launch per
+	 * grid point
+	 */
+	bool
+	requiresPointwisePreProcess(const GridIndicesView&) const noexcept
+	{
+		return false;
+	}
+
+	/**
+	 * @brief Preprocessing of all the rows of a batch at once, when
+	 * requiresPointwisePreProcess() is false
+	 */
+	void
+	computeFluxesBatchPreProcess(ConcentrationsBatchView,
+		const GridIndicesView&, const std::vector<double>&,
+		const std::vector<double>&)
+	{
+	}
+
+	void
+	computeAllFluxes(ConcentrationsBatchView concentrations,
+		FluxesBatchView fluxes, const GridIndicesView& gridIndices,
+		const std::vector<double>& surfaceDepths,
+		const std::vector<double>& spacings) final;
+
 	template <typename TReaction>
 	void
 	computeFluxes(ConcentrationsView concentrations, FluxesView fluxes,
@@ -429,6 +507,19 @@ public:
 		Kokkos::View<double*> values, IndexType gridIndex = 0,
 		double surfaceDepth = 0.0, double spacing = 0.0) override;
 
+	void
+	computePartialsBatchPreProcess(ConcentrationsBatchView,
+		const GridIndicesView&, const std::vector<double>&,
+		const std::vector<double>&)
+	{
+	}
+
+	void
+	computeAllPartials(ConcentrationsBatchView concentrations,
+		PartialsBatchView values, const GridIndicesView& gridIndices,
+		const std::vector<double>& surfaceDepths,
+		const std::vector<double>& spacings) final;
+
 	void
 	computeConstantRatesPreProcess(
 		ConcentrationsView, IndexType, double, double)
@@ -485,6 +576,15 @@ public:
 	getLeftSideRate(ConcentrationsView concentrations, IndexType clusterId,
 		IndexType gridIndex) override;
 
+	/**
+	 * @brief Batched version of getLeftSideRate(), with the rate of row b in
+	 * rates(b) (zero for the rows with an invalid grid index)
+	 */
+	void
+	getLeftSideRates(ConcentrationsBatchView concentrations,
+		IndexType clusterId, Kokkos::View<const IndexType*> gridIndices,
+		Kokkos::View<double*> rates);
+
 	IndexType
 	getDiagonalFill(SparseFillMap& fillMap) override;
 
@@ -625,6 +725,10 @@ public:
 	void
 	updateReactionRates(double time = 0.0);
 
+	void
+	updateReactionRates(
+		Kokkos::View<const IndexType*> gridIndices, double time = 0.0);
+
 	void
 	updateOutgoingDiffFluxes(double* gridPointSolution, double factor,
 		std::vector<IndexType> diffusingIds, std::vector<double>& fluxes,
@@ -655,9 +759,47 @@ private:
 	void
 	defineReactions(Connectivity& connectivity);
 
+	/**
+	 * @brief Sums the flux slots written by the reactions into the fluxes
+	 * of the nRows rows starting at rowBegin (skipping the rows with an
+	 * invalid grid index if gridIndices is not empty). Row b of the slot
+	 * buffer holds the slots of row rowBegin + b.
+	 */
+	void
+	gatherFluxes(FluxesBatchView fluxes,
+		Kokkos::View<const IndexType*> gridIndices, IndexType rowBegin,
+		IndexType nRows);
+
+	/**
+	 * @brief Number of rows of slots that fit in the slot buffer budget
+	 * (at least one).
+	 */
+	IndexType
+	getMaxFluxSlotRows() const;
+
+	void
+	growFluxSlotBuffer(IndexType nRows);
+
 	void
 	updateDiffusionCoefficients();
 
+	void
+	updateDiffusionCoefficients(Kokkos::View<const IndexType*> gridIndices);
+
+	/**
+	 * @brief Gives the same rate slot to all the grid points that share
+	 * the same temperature.
+	 */
+	void
+	updateRateSlots(const std::vector<double>& gridTemps);
+
+	/**
+	 * @brief Tabulates the diffusion coefficients and the rates on the
+	 * temperature lattice of the rate table.
+	 */
+	void
+	buildRateTables();
+
 	KOKKOS_INLINE_FUNCTION
 	double
 	getTemperature(IndexType gridIndex) const noexcept
@@ -672,11 +814,45 @@ private:
 private:
 	std::optional<SubpavingMirror> _subpavingMirror;
 	std::optional<ClusterDataMirror> _clusterDataMirror;
+	//! The fields of the cluster data mirror that are out of date
+	unsigned _staleMirrorFields{0};
 
 	detail::ReactionNetworkWorker<TImpl> _worker;
 
 	SparseFillMap _connectivityMap;
 
+	//! Whether the grid points with the same temperature share their rates
+	bool _shareRatesByTemperature{false};
+
+	//! Whether the reactions are processed with one kernel per reaction type
+	bool _dispatchReactionsByType{false};
+
+	//! Whether the fluxes are gathered from per-reaction slots
+	bool _gatherFluxes{false};
+	detail::FluxGatherMap _fluxGatherMap;
+	//! One row of slots per grid point of a batch, the batches are split
+	//! so that it stays under maxFluxSlotBufferSize bytes
+	Kokkos::View<double**, Kokkos::LayoutRight> _fluxSlotBuffer;
+	static constexpr std::uint64_t maxFluxSlotBufferSize = 256 * 1024 * 1024;
+
+	//! The reactions contributing to the left side rate of each cluster
+	detail::ClusterReactionMap _leftSideReactionMap;
+
+	//! Temperature lattice of the rate tables (disabled by default)
+	detail::TemperatureLattice _rateTableLattice;
+	//! Diffusion coefficients on the lattice, one row per cluster
+	Kokkos::View<double**> _diffusionTable;
+	//! Rates on the lattice, one row per reaction
+	Kokkos::View<double**> _rateTable;
+
+	//! Incremented every time the diffusion coefficients are updated
+	std::uint64_t _diffusionCoefficientsVersion{0};
+
+	//! Directory of the network construction cache (empty if disabled)
+	std::string _networkCacheDirectory;
+	//! The material, the start of the network name in the cache
+	std::string _networkCacheName;
+
 	std::vector<BelongingView> isInSub;
 	std::vector<OwnedSubMapView> backMap;
 
@@ -718,12 +894,38 @@ struct ReactionNetworkWorker
 	void
 	updateDiffusionCoefficients();
 
+	void
+	updateDiffusionCoefficients(Kokkos::View<const IndexType*> gridIndices);
+
 	void
 	defineMomentIds();
 
 	void
 	defineReactions(Connectivity& connectivity);
 
+	/**
+	 * @brief Reads the reactions and connectivity from the network cache.
+	 *
+	 * @return False if the cache does not hold this network
+	 */
+	bool
+	readReactions(const detail::NetworkCache& cache, Connectivity& connectivity);
+
+	/**
+	 * @brief Name of the network in the cache, the same with every build.
+	 */
+	std::string
+	getNetworkCacheName();
+
+	std::uint64_t
+	getNetworkCacheKey();
+
+	void
+	defineFluxGatherMap();
+
+	void
+	defineLeftSideReactionMap();
+
 	IndexType
 	getDiagonalFill(typename Network::SparseFillMap& fillMap);
 
@@ -153,6 +153,27 @@ struct ReactionTypeListHelper<TNetwork,
 template <typename TNetwork>
 using ReactionTypeList = typename ReactionTypeListHelper<TNetwork>::Type;
 
+/**
+ * By default, the reactions keep a single temperature independent term of
+ * their rate (the binding energy of the dissociations)
+ */
+template <typename TNetwork, typename = std::void_t<>>
+struct NumberOfRateConstants : std::integral_constant<std::size_t, 1>
+{
+};
+
+/**
+ * If ReactionNetworkTraits provides a numRateConstants member, then use that
+ * See NumberOfRateConstants
+ */
+template <typename TNetwork>
+struct NumberOfRateConstants<TNetwork,
+	std::void_t<decltype(ReactionNetworkTraits<TNetwork>::numRateConstants)>> :
+	std::integral_constant<std::size_t,
+		ReactionNetworkTraits<TNetwork>::numRateConstants>
+{
+};
+
 template <typename TPoint, typename TSpecies>
 using Composition = plsm::EnumIndexed<TPoint, TSpecies>;
 
@@ -104,7 +104,7 @@ private:
 
 	KOKKOS_INLINE_FUNCTION
 	bool
-	getEnabled() const;
+	getEnabled(IndexType gridIndex) const;
 
 	KOKKOS_INLINE_FUNCTION
 	void
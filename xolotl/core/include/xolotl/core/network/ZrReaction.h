@@ -19,11 +19,18 @@ public:
 	using Superclass =
 		ProductionReaction<ZrReactionNetwork, ZrProductionReaction>;
 
+	//! The anisotropy ratio depends on the grid point
+	static constexpr bool hasTabulatedRate = false;
+
 	using Superclass::Superclass;
 
 	KOKKOS_INLINE_FUNCTION
 	double
 	getRateForProduction(IndexType gridIndex);
+
+	KOKKOS_INLINE_FUNCTION
+	void
+	computeRateConstants();
 };
 
 class ZrDissociationReaction :
@@ -33,12 +40,19 @@ public:
 	using Superclass =
 		DissociationReaction<ZrReactionNetwork, ZrDissociationReaction>;
 
+	//! The anisotropy ratio depends on the grid point
+	static constexpr bool hasTabulatedRate = false;
+
 	using Superclass::Superclass;
 
 	KOKKOS_INLINE_FUNCTION
 	double
 	getRateForProduction(IndexType gridIndex);
 
+	KOKKOS_INLINE_FUNCTION
+	void
+	computeRateConstants();
+
 	KOKKOS_INLINE_FUNCTION
 	double
 	computeBindingEnergy(double time = 0.0);
@@ -77,6 +77,10 @@ struct ReactionNetworkTraits<ZrReactionNetwork>
 
 	static constexpr std::size_t numSpecies = 3;
 
+	//! Cached rate terms: the binding energy then the capture efficiency
+	//! coefficients
+	static constexpr std::size_t numRateConstants = 4;
+
 	using ProductionReactionType = ZrProductionReaction;
 	using DissociationReactionType = ZrDissociationReaction;
 	using SinkReactionType = ZrSinkReaction;
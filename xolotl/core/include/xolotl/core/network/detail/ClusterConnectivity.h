@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include <Kokkos_Core.hpp>
 
 #include <xolotl/core/network/ReactionNetworkTraits.h>
@@ -17,6 +19,9 @@ namespace detail
  * cluster interacts with which, needed to define the sparse
  * Jacobian. Relies on Kokkos Compressed Row Storage array.
  *
+ * Once filled, the entries of each row are sorted (see sortRows()) so the
+ * position of an entry is found with a binary search.
+ *
  * @tparam TMemSpace The memory layout type
  */
 template <typename TMemSpace = plsm::DefaultMemSpace>
@@ -68,6 +73,25 @@ public:
 		return getPosition(rowId, columnId, *this);
 	}
 
+	/**
+	 * @brief Sorts the column ids of each row, needed before looking up
+	 * positions.
+	 */
+	void
+	sortRows()
+	{
+		auto hRowMap = create_mirror_view(this->row_map);
+		deep_copy(hRowMap, this->row_map);
+		auto hEntries = create_mirror_view(this->entries);
+		deep_copy(hEntries, this->entries);
+		auto nRows = hRowMap.extent(0) - 1;
+		for (IndexType i = 0; i < nRows; ++i) {
+			std::sort(hEntries.data() + hRowMap(i),
+				hEntries.data() + hRowMap(i + 1));
+		}
+		deep_copy(this->entries, hEntries);
+	}
+
 	std::uint64_t
 	getDeviceMemorySize() const noexcept
 	{
@@ -84,11 +108,20 @@ private:
 	IndexType
 	getPosition(IndexType rowId, IndexType columnId, const Crs& crs) const
 	{
-		for (auto pos = crs.row_map(rowId); pos < crs.row_map(rowId + 1);
-			 ++pos) {
-			if (crs.entries(pos) == columnId) {
-				return pos;
+		// Binary search in the sorted row
+		IndexType first = crs.row_map(rowId);
+		IndexType last = crs.row_map(rowId + 1);
+		while (first < last) {
+			auto mid = first + (last - first) / 2;
+			if (crs.entries(mid) < columnId) {
+				first = mid + 1;
 			}
+			else {
+				last = mid;
+			}
+		}
+		if (first < crs.row_map(rowId + 1) && crs.entries(first) == columnId) {
+			return first;
 		}
 		return invalidNetworkIndex;
 	}
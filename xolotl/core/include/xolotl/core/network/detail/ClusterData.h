@@ -44,6 +44,18 @@ struct UnmanagedHelper
 template <typename TView>
 using Unmanaged = typename UnmanagedHelper<TView>::Type;
 
+/**
+ * @brief Parts of the cluster data that change during the solve, as bit flags,
+ * so that they can be copied to the host mirror on their own.
+ */
+enum ClusterDataFields : unsigned
+{
+	CLUSTER_DATA_PARAMETERS = 1u << 0,
+	CLUSTER_DATA_TEMPERATURE = 1u << 1,
+	CLUSTER_DATA_DIFFUSION_COEFFICIENT = 1u << 2,
+	CLUSTER_DATA_EXTRA = 1u << 3
+};
+
 template <typename TNetwork, typename MemSpace>
 struct ClusterDataExtra
 {
@@ -115,6 +127,14 @@ struct ClusterDataCommon
 	void
 	deepCopy(const TClusterDataCommon& data);
 
+	/**
+	 * @brief Copies only the given fields (ClusterDataFields) from data of
+	 * the same sizes.
+	 */
+	template <typename TClusterDataCommon>
+	void
+	deepCopyFields(const TClusterDataCommon& data, unsigned fields);
+
 	std::uint64_t
 	getDeviceMemorySize() const noexcept;
 
@@ -362,6 +382,10 @@ public:
 	void
 	deepCopy(const TClusterData& data);
 
+	template <typename TClusterData>
+	void
+	deepCopyFields(const TClusterData& data, unsigned fields);
+
 	std::uint64_t
 	getDeviceMemorySize() const noexcept;
 
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include <xolotl/core/network/ReactionNetworkTraits.h>
+
+namespace xolotl
+{
+namespace core
+{
+namespace network
+{
+namespace detail
+{
+/**
+ * @brief Records the clusters on the left side of a reaction (or only counts
+ * them if no cluster view is given)
+ */
+struct LeftSideClusterRecorder
+{
+	using IndexType = ReactionNetworkIndexType;
+
+	Kokkos::View<IndexType*> clusters;
+	IndexType entry;
+
+	KOKKOS_INLINE_FUNCTION
+	void
+	operator()(IndexType clusterId)
+	{
+		if (clusters.extent(0) > 0) {
+			clusters(entry) = clusterId;
+		}
+		++entry;
+	}
+};
+
+/**
+ * @brief Cluster-major (CSR) map of the reactions having each cluster on
+ * their left side
+ *
+ * Per-cluster quantities such as the left side rate then only visit the
+ * reactions of that cluster instead of all of them.
+ */
+struct ClusterReactionMap
+{
+	using IndexType = ReactionNetworkIndexType;
+
+	ClusterReactionMap() = default;
+
+	/**
+	 * @brief Builds the cluster-major map
+	 *
+	 * @param entryOffsets First entry of each reaction (with the total number
+	 * of entries as last entry)
+	 * @param clusters Cluster of each entry
+	 * @param numClusters Number of rows in the map
+	 */
+	ClusterReactionMap(Kokkos::View<IndexType*> entryOffsets,
+		Kokkos::View<IndexType*> clusters, IndexType numClusters) :
+		rowMap("Cluster Reaction Row Map", numClusters + 1),
+		reactionIds("Cluster Reaction Ids", clusters.extent(0))
+	{
+		auto hOffsets = create_mirror_view(entryOffsets);
+		deep_copy(hOffsets, entryOffsets);
+		auto hClusters = create_mirror_view(clusters);
+		deep_copy(hClusters, clusters);
+
+		// Counting sort of the reactions by cluster
+		hRowMap = create_mirror_view(rowMap);
+		std::vector<IndexType> counts(numClusters, 0);
+		for (IndexType e = 0; e < hClusters.extent(0); ++e) {
+			++counts[hClusters(e)];
+		}
+		hRowMap(0) = 0;
+		for (IndexType i = 0; i < numClusters; ++i) {
+			hRowMap(i + 1) = hRowMap(i) + counts[i];
+		}
+		auto hReactionIds = create_mirror_view(reactionIds);
+		for (IndexType i = 0; i < numClusters; ++i) {
+			counts[i] = hRowMap(i);
+		}
+		auto nReactions = hOffsets.extent(0) - 1;
+		for (IndexType r = 0; r < nReactions; ++r) {
+			for (auto e = hOffsets(r); e < hOffsets(r + 1); ++e) {
+				hReactionIds(counts[hClusters(e)]++) = r;
+			}
+		}
+		deep_copy(rowMap, hRowMap);
+		deep_copy(reactionIds, hReactionIds);
+	}
+
+	bool
+	isInitialized() const noexcept
+	{
+		return rowMap.extent(0) > 0;
+	}
+
+	std::uint64_t
+	getDeviceMemorySize() const noexcept
+	{
+		std::uint64_t ret = 0;
+		ret += rowMap.required_allocation_size(rowMap.size());
+		ret += reactionIds.required_allocation_size(reactionIds.size());
+		return ret;
+	}
+
+	//! First entry of each cluster in the reaction ids view
+	Kokkos::View<IndexType*> rowMap;
+	//! Host copy of the row map, to size the per-cluster launches
+	Kokkos::View<IndexType*>::HostMirror hRowMap;
+	//! Reactions having each cluster on their left side
+	Kokkos::View<IndexType*> reactionIds;
+};
+} // namespace detail
+} // namespace network
+} // namespace core
+} // namespace xolotl
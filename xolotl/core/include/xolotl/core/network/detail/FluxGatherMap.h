@@ -0,0 +1,159 @@
+#pragma once
+
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include <xolotl/core/network/ReactionNetworkTraits.h>
+
+namespace xolotl
+{
+namespace core
+{
+namespace network
+{
+namespace detail
+{
+/**
+ * @brief Adds the flux contributions of a reaction directly to the fluxes
+ */
+struct AtomicFluxAccumulator
+{
+	using IndexType = ReactionNetworkIndexType;
+
+	Kokkos::View<double*, Kokkos::MemoryUnmanaged> fluxes;
+
+	KOKKOS_INLINE_FUNCTION
+	void
+	operator()(IndexType clusterId, double value) const
+	{
+		Kokkos::atomic_add(&fluxes[clusterId], value);
+	}
+};
+
+/**
+ * @brief Writes the flux contributions of a reaction, in the order they are
+ * computed, to the consecutive slots of the reaction in the flux buffer
+ */
+struct SlotFluxAccumulator
+{
+	using IndexType = ReactionNetworkIndexType;
+
+	Kokkos::View<double*, Kokkos::MemoryUnmanaged> buffer;
+	IndexType slot;
+
+	KOKKOS_INLINE_FUNCTION
+	void
+	operator()(IndexType, double value)
+	{
+		buffer[slot++] = value;
+	}
+};
+
+/**
+ * @brief Records the cluster targeted by each flux contribution of a reaction
+ * (or only counts the contributions if no target view is given)
+ */
+struct FluxTargetRecorder
+{
+	using IndexType = ReactionNetworkIndexType;
+
+	Kokkos::View<IndexType*> targets;
+	IndexType slot;
+
+	KOKKOS_INLINE_FUNCTION
+	void
+	operator()(IndexType clusterId, double)
+	{
+		if (targets.extent(0) > 0) {
+			targets(slot) = clusterId;
+		}
+		++slot;
+	}
+};
+
+/**
+ * @brief Cluster-major map of the flux slots written by the reactions
+ *
+ * Each reaction supporting it writes its flux contributions to its own slots
+ * of a buffer instead of adding them atomically to the fluxes. The slots are
+ * then summed for each cluster, with one thread per cluster, so no atomic
+ * operation is needed.
+ */
+struct FluxGatherMap
+{
+	using IndexType = ReactionNetworkIndexType;
+
+	FluxGatherMap() = default;
+
+	/**
+	 * @brief Builds the cluster-major map
+	 *
+	 * @param slotOffsets First slot of each reaction (with the total number
+	 * of slots as last entry)
+	 * @param targets Cluster targeted by each slot
+	 * @param numClusters Number of rows in the map
+	 */
+	FluxGatherMap(Kokkos::View<IndexType*> slotOffsets,
+		Kokkos::View<IndexType*> targets, IndexType numClusters) :
+		slotOffsets(slotOffsets),
+		rowMap("Flux Gather Row Map", numClusters + 1),
+		slots("Flux Gather Slots", targets.extent(0))
+	{
+		auto hTargets = create_mirror_view(targets);
+		deep_copy(hTargets, targets);
+
+		// Counting sort of the slots by target cluster
+		auto hRowMap = create_mirror_view(rowMap);
+		std::vector<IndexType> counts(numClusters, 0);
+		for (IndexType s = 0; s < hTargets.extent(0); ++s) {
+			++counts[hTargets(s)];
+		}
+		hRowMap(0) = 0;
+		for (IndexType i = 0; i < numClusters; ++i) {
+			hRowMap(i + 1) = hRowMap(i) + counts[i];
+		}
+		auto hSlots = create_mirror_view(slots);
+		for (IndexType i = 0; i < numClusters; ++i) {
+			counts[i] = hRowMap(i);
+		}
+		for (IndexType s = 0; s < hTargets.extent(0); ++s) {
+			hSlots(counts[hTargets(s)]++) = s;
+		}
+		deep_copy(rowMap, hRowMap);
+		deep_copy(slots, hSlots);
+	}
+
+	bool
+	isInitialized() const noexcept
+	{
+		return slotOffsets.extent(0) > 0;
+	}
+
+	IndexType
+	getNumberOfSlots() const noexcept
+	{
+		return slots.extent(0);
+	}
+
+	std::uint64_t
+	getDeviceMemorySize() const noexcept
+	{
+		std::uint64_t ret = 0;
+		ret += slotOffsets.required_allocation_size(slotOffsets.size());
+		ret += rowMap.required_allocation_size(rowMap.size());
+		ret += slots.required_allocation_size(slots.size());
+		return ret;
+	}
+
+	//! First slot of each reaction
+	Kokkos::View<IndexType*> slotOffsets;
+	//! First entry of each cluster in the slots view
+	Kokkos::View<IndexType*> rowMap;
+	//! Slots contributing to each cluster
+	Kokkos::View<IndexType*> slots;
+};
+} // namespace detail
+} // namespace network
+} // namespace core
+} // namespace xolotl
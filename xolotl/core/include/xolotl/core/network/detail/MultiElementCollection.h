@@ -2,6 +2,8 @@
 
 #include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
 
@@ -523,6 +525,7 @@ class MultiElementCollection
 public:
 	using IndexType = ::xolotl::IdType;
 	using ChainType = ElementSetMixinChain<sizeof...(TElems), TElems...>;
+	using ExecutionSpace = Kokkos::DefaultExecutionSpace;
 
 	/**
 	 * @brief Default construct to empty collection
@@ -584,6 +587,29 @@ public:
 		_numElems = _chain.getNumberOfElements();
 	}
 
+	/**
+	 * @brief Choose whether forEach() and forEachBatch() launch a single
+	 * kernel over the whole collection (the element type is then resolved for
+	 * each element) or one kernel per element type
+	 *
+	 * In the latter case, each kernel is launched asynchronously on its own
+	 * execution space instance and a single fence is issued at the end.
+	 */
+	void
+	setDispatchByType(bool byType)
+	{
+		_dispatchByType = byType;
+		if (_dispatchByType) {
+			initializeTypeSpaces();
+		}
+	}
+
+	bool
+	getDispatchByType() const noexcept
+	{
+		return _dispatchByType;
+	}
+
 	/**
 	 * @brief Perform a Kokkos parallel_for on all the elements in the
 	 * collection
@@ -596,6 +622,11 @@ public:
 	void
 	forEach(const F& func)
 	{
+		if (_dispatchByType) {
+			forEachTyped("", func);
+			return;
+		}
+
 		auto chain = _chain;
 		Kokkos::parallel_for(
 			_numElems,
@@ -606,12 +637,94 @@ public:
 	void
 	forEach(const std::string& label, const F& func)
 	{
+		if (_dispatchByType) {
+			forEachTyped(label, func);
+			return;
+		}
+
 		auto chain = _chain;
 		Kokkos::parallel_for(
 			label, _numElems,
 			DEVICE_LAMBDA(const IndexType i) { chain.apply(func, i); });
 	}
 
+	/**
+	 * @brief Wrap a batched callable so it can be applied through the chain
+	 * with the batch index bound
+	 */
+	template <typename F>
+	struct BatchApplyFunctor
+	{
+		F func;
+		IndexType b;
+
+		template <typename TElem>
+		KOKKOS_INLINE_FUNCTION
+		void
+		operator()(TElem&& elem) const
+		{
+			func(elem, b);
+		}
+	};
+
+	/**
+	 * @brief Perform a single Kokkos parallel_for on all the elements in the
+	 * collection for each of the given number of batch entries (typically
+	 * grid points)
+	 *
+	 * The callable should be of the form `void f(ElemType&& elem, IndexType b)`
+	 * and templated on the type of the element parameter.
+	 */
+	template <typename F>
+	void
+	forEachBatch(const std::string& label, IndexType batchSize, const F& func)
+	{
+		if (_dispatchByType) {
+			forEachBatchTyped(label, batchSize, func);
+			return;
+		}
+
+		using Range2D = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
+		auto chain = _chain;
+		Kokkos::parallel_for(label,
+			Range2D({0, 0}, {batchSize, static_cast<IndexType>(_numElems)}),
+			DEVICE_LAMBDA(const IndexType b, const IndexType i) {
+				chain.apply(BatchApplyFunctor<F>{func, b}, i);
+			});
+	}
+
+	/**
+	 * @brief Perform one Kokkos parallel_for per element type, each on its own
+	 * execution space instance, and fence once all of them are launched
+	 *
+	 * Same callable requirements as forEach().
+	 */
+	template <typename F>
+	void
+	forEachTyped(const std::string& label, const F& func)
+	{
+		initializeTypeSpaces();
+		launchTyped(
+			label, func, std::make_index_sequence<numElementTypes>{});
+		Kokkos::fence();
+	}
+
+	/**
+	 * @brief Batched version of forEachTyped()
+	 *
+	 * Same callable requirements as forEachBatch().
+	 */
+	template <typename F>
+	void
+	forEachBatchTyped(
+		const std::string& label, IndexType batchSize, const F& func)
+	{
+		initializeTypeSpaces();
+		launchBatchTyped(label, batchSize, func,
+			std::make_index_sequence<numElementTypes>{});
+		Kokkos::fence();
+	}
+
 	/**
 	 * @brief Perform a Kokkos parallel_for on all the elements of a single type
 	 */
@@ -687,6 +800,94 @@ public:
 			label, _numElems, ReduceFunctor<F, T>{_chain, func}, out);
 	}
 
+	template <typename F, typename T>
+	struct ReduceOverFunctor
+	{
+		ChainType chain;
+		Kokkos::View<const IndexType*> ids;
+		F func;
+
+		DEVICE_FUNCTION
+		void
+		operator()(const IndexType k, T& local) const
+		{
+			chain.reduce(func, ids(k), local);
+		}
+	};
+
+	/**
+	 * @brief Perform a Kokkos parallel_reduce on the elements whose indices
+	 * are listed in ids between begin and end
+	 *
+	 * Same callable requirements as reduce().
+	 */
+	template <typename F, typename T>
+	void
+	reduceOver(const std::string& label, Kokkos::View<const IndexType*> ids,
+		IndexType begin, IndexType end, const F& func, T& out)
+	{
+		Kokkos::parallel_reduce(label, Kokkos::RangePolicy<>(begin, end),
+			ReduceOverFunctor<F, T>{_chain, ids, func}, out);
+	}
+
+	/**
+	 * @brief Wrap a batched reduction callable so it can be applied through
+	 * the chain with the batch index bound
+	 */
+	template <typename F>
+	struct BatchReduceFunctor
+	{
+		F func;
+		IndexType b;
+
+		template <typename TElem, typename T>
+		KOKKOS_INLINE_FUNCTION
+		void
+		operator()(TElem&& elem, T& local) const
+		{
+			func(elem, b, local);
+		}
+	};
+
+	template <typename F, typename T>
+	struct ReduceOverBatchFunctor
+	{
+		ChainType chain;
+		Kokkos::View<const IndexType*> ids;
+		IndexType begin;
+		IndexType end;
+		F func;
+		Kokkos::View<T*> out;
+
+		DEVICE_FUNCTION
+		void
+		operator()(const IndexType b) const
+		{
+			T local{};
+			for (IndexType k = begin; k < end; ++k) {
+				chain.reduce(BatchReduceFunctor<F>{func, b}, ids(k), local);
+			}
+			out(b) = local;
+		}
+	};
+
+	/**
+	 * @brief Same as reduceOver() for each of the given number of batch
+	 * entries, one thread per entry, with the result of entry b in out(b)
+	 *
+	 * The callable should be of the form
+	 * `void f(ElemType&& elem, IndexType b, T& local)`.
+	 */
+	template <typename F, typename T>
+	void
+	reduceOverBatch(const std::string& label,
+		Kokkos::View<const IndexType*> ids, IndexType begin, IndexType end,
+		IndexType batchSize, const F& func, Kokkos::View<T*> out)
+	{
+		Kokkos::parallel_for(label, batchSize,
+			ReduceOverBatchFunctor<F, T>{_chain, ids, begin, end, func, out});
+	}
+
 	template <typename TElem, typename F, typename T>
 	struct ReduceOnFunctor
 	{
@@ -743,9 +944,88 @@ public:
 		return ret;
 	}
 
+private:
+	template <std::size_t... Is>
+	static std::vector<ExecutionSpace>
+	partitionExecutionSpace(std::index_sequence<Is...>)
+	{
+		// Host backends would split their threads between the instances
+		if constexpr (std::is_same_v<ExecutionSpace::memory_space,
+						  Kokkos::HostSpace>) {
+			return std::vector<ExecutionSpace>(numElementTypes);
+		}
+		else {
+			auto spaces = Kokkos::Experimental::partition_space(
+				ExecutionSpace{}, ((void)Is, 1)...);
+			return std::vector<ExecutionSpace>(spaces.begin(), spaces.end());
+		}
+	}
+
+	void
+	initializeTypeSpaces()
+	{
+		if (_typeSpaces.empty()) {
+			_typeSpaces = partitionExecutionSpace(
+				std::make_index_sequence<numElementTypes>{});
+		}
+	}
+
+	template <std::size_t I, typename F>
+	void
+	launchOnType(const std::string& label, const F& func)
+	{
+		using TElem = std::tuple_element_t<I, std::tuple<TElems...>>;
+		auto view = getView<TElem>();
+		if (view.size() == 0) {
+			return;
+		}
+		Kokkos::parallel_for(label,
+			Kokkos::RangePolicy<ExecutionSpace>(
+				_typeSpaces[I], 0, view.size()),
+			DEVICE_LAMBDA(const IndexType i) { func(view[i]); });
+	}
+
+	template <typename F, std::size_t... Is>
+	void
+	launchTyped(
+		const std::string& label, const F& func, std::index_sequence<Is...>)
+	{
+		(launchOnType<Is>(label, func), ...);
+	}
+
+	template <std::size_t I, typename F>
+	void
+	launchBatchOnType(
+		const std::string& label, IndexType batchSize, const F& func)
+	{
+		using TElem = std::tuple_element_t<I, std::tuple<TElems...>>;
+		using Range2D =
+			Kokkos::MDRangePolicy<ExecutionSpace, Kokkos::Rank<2>>;
+		auto view = getView<TElem>();
+		if (view.size() == 0 || batchSize == 0) {
+			return;
+		}
+		Kokkos::parallel_for(label,
+			Range2D(_typeSpaces[I], {0, 0},
+				{batchSize, static_cast<IndexType>(view.size())}),
+			DEVICE_LAMBDA(const IndexType b, const IndexType i) {
+				func(view[i], b);
+			});
+	}
+
+	template <typename F, std::size_t... Is>
+	void
+	launchBatchTyped(const std::string& label, IndexType batchSize,
+		const F& func, std::index_sequence<Is...>)
+	{
+		(launchBatchOnType<Is>(label, batchSize, func), ...);
+	}
+
 private:
 	ChainType _chain;
 	std::size_t _numElems{};
+	bool _dispatchByType{false};
+	std::vector<ExecutionSpace> _typeSpaces;
 };
 
 template <typename... TElems>
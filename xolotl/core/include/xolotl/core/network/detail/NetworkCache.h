@@ -0,0 +1,265 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include <xolotl/core/network/ReactionNetworkTraits.h>
+#include <xolotl/core/network/detail/ClusterConnectivity.h>
+#include <xolotl/core/network/detail/ClusterSet.h>
+#include <xolotl/util/Filesystem.h>
+
+namespace xolotl
+{
+namespace core
+{
+namespace network
+{
+namespace detail
+{
+/**
+ * @brief 64-bit FNV-1a hash of everything the reaction generation depends
+ * on, used to name and validate the network cache files.
+ */
+class NetworkCacheKey
+{
+public:
+	void
+	add(const void* data, std::size_t size) noexcept
+	{
+		auto bytes = static_cast<const unsigned char*>(data);
+		for (std::size_t i = 0; i < size; ++i) {
+			_hash ^= bytes[i];
+			_hash *= 1099511628211ULL;
+		}
+	}
+
+	template <typename T>
+	void
+	add(const T& value) noexcept
+	{
+		add(&value, sizeof(T));
+	}
+
+	void
+	add(const std::string& value) noexcept
+	{
+		add(value.data(), value.size());
+	}
+
+	std::uint64_t
+	get() const noexcept
+	{
+		return _hash;
+	}
+
+private:
+	std::uint64_t _hash{14695981039346656037ULL};
+};
+
+/**
+ * @brief Binary file holding the generated reactions of a network (number of
+ * reactions of each type and their cluster sets) and its connectivity.
+ *
+ * A network identical to the one that wrote the file (same name and key),
+ * built with the same cache format version, reloads them instead of
+ * generating the reactions again.
+ */
+class NetworkCache
+{
+public:
+	using IndexType = ReactionNetworkIndexType;
+	using ClusterSetView = Kokkos::View<ClusterSet*>;
+	using Connectivity = ClusterConnectivity<>;
+	using RowMapValueType = typename Connectivity::row_map_type::value_type;
+
+	//! Version of the cached content, to be increased whenever the reaction
+	//! generation, the ClusterSet layout or the file layout change so that
+	//! the files of older builds are not reused
+	static constexpr std::uint64_t formatVersion = 2;
+
+	/**
+	 * @param directory The directory of the cache files
+	 * @param name The name of the network (material and species), which
+	 * does not depend on the build
+	 * @param key The hash of everything the reactions depend on
+	 */
+	NetworkCache(const std::string& directory, const std::string& name,
+		std::uint64_t key) :
+		_name(name),
+		_key(key)
+	{
+		std::ostringstream name;
+		name << "network_" << std::hex << key << ".bin";
+		_path = fs::path(directory) / name.str();
+	}
+
+	const fs::path&
+	getPath() const noexcept
+	{
+		return _path;
+	}
+
+	/**
+	 * @brief Reads the cached reactions and connectivity.
+	 *
+	 * @return False if there is no valid cache file for this network,
+	 * written with this format version
+	 */
+	bool
+	read(std::vector<IndexType>& counts, ClusterSetView& clusterSets,
+		Connectivity& connectivity) const
+	{
+		std::ifstream ifs(_path, std::ios::binary);
+		if (!ifs) {
+			return false;
+		}
+
+		std::uint64_t magic = 0, version = 0, key = 0;
+		readValue(ifs, magic);
+		readValue(ifs, version);
+		readValue(ifs, key);
+		if (!ifs || magic != fileMagic || version != formatVersion ||
+			key != _key) {
+			return false;
+		}
+		auto name = readView<char>(ifs, "Network Name");
+		if (!ifs || std::string(name.data(), name.extent(0)) != _name) {
+			return false;
+		}
+
+		std::uint64_t nTypes = 0;
+		readValue(ifs, nTypes);
+		if (!ifs || nTypes != counts.size()) {
+			return false;
+		}
+		readArray(ifs, counts.data(), counts.size());
+
+		auto hSets = readView<ClusterSet>(ifs, "Cluster Sets");
+		auto hRowMap = readView<RowMapValueType>(ifs, "Connectivity Row Map");
+		auto hEntries = readView<IndexType>(ifs, "Connectivity Entries");
+		if (!ifs) {
+			return false;
+		}
+
+		clusterSets = Kokkos::create_mirror_view_and_copy(
+			typename ClusterSetView::memory_space{}, hSets);
+		connectivity.row_map = Kokkos::create_mirror_view_and_copy(
+			typename Connectivity::row_map_type::memory_space{}, hRowMap);
+		connectivity.entries = Kokkos::create_mirror_view_and_copy(
+			typename Connectivity::entries_type::memory_space{}, hEntries);
+		return true;
+	}
+
+	/**
+	 * @brief Writes the reactions and connectivity.
+	 *
+	 * The file is written under a temporary name and then renamed so
+	 * concurrent writers (several ranks) never leave a partial file behind.
+	 */
+	void
+	write(const std::vector<IndexType>& counts, ClusterSetView clusterSets,
+		const Connectivity& connectivity) const
+	{
+		std::error_code ec;
+		fs::create_directories(_path.parent_path(), ec);
+
+		auto tmpPath = _path;
+		tmpPath += ".tmp" + std::to_string(std::random_device{}());
+		{
+			std::ofstream ofs(tmpPath, std::ios::binary);
+			if (!ofs) {
+				return;
+			}
+			writeValue(ofs, fileMagic);
+			writeValue(ofs, formatVersion);
+			writeValue(ofs, _key);
+			writeValue(ofs, static_cast<std::uint64_t>(_name.size()));
+			writeArray(ofs, _name.data(), _name.size());
+			writeValue(ofs, static_cast<std::uint64_t>(counts.size()));
+			writeArray(ofs, counts.data(), counts.size());
+			writeView(ofs, clusterSets);
+			writeView(ofs, connectivity.row_map);
+			writeView(ofs, connectivity.entries);
+			if (!ofs) {
+				ofs.close();
+				fs::remove(tmpPath, ec);
+				return;
+			}
+		}
+		fs::rename(tmpPath, _path, ec);
+		if (ec) {
+			fs::remove(tmpPath, ec);
+		}
+	}
+
+private:
+	static constexpr std::uint64_t fileMagic = 0x58434e54574b4e31ULL;
+
+	template <typename T>
+	static void
+	readValue(std::istream& is, T& value)
+	{
+		is.read(reinterpret_cast<char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	static void
+	readArray(std::istream& is, T* data, std::size_t size)
+	{
+		is.read(reinterpret_cast<char*>(data), sizeof(T) * size);
+	}
+
+	template <typename T>
+	static Kokkos::View<T*, Kokkos::HostSpace>
+	readView(std::istream& is, const std::string& label)
+	{
+		std::uint64_t size = 0;
+		readValue(is, size);
+		if (!is) {
+			return {};
+		}
+		Kokkos::View<T*, Kokkos::HostSpace> ret(
+			Kokkos::ViewAllocateWithoutInitializing(label), size);
+		readArray(is, ret.data(), size);
+		return ret;
+	}
+
+	template <typename T>
+	static void
+	writeValue(std::ostream& os, const T& value)
+	{
+		os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template <typename T>
+	static void
+	writeArray(std::ostream& os, const T* data, std::size_t size)
+	{
+		os.write(reinterpret_cast<const char*>(data), sizeof(T) * size);
+	}
+
+	template <typename TView>
+	static void
+	writeView(std::ostream& os, const TView& view)
+	{
+		auto hView = Kokkos::create_mirror_view_and_copy(
+			Kokkos::HostSpace{}, view);
+		writeValue(os, static_cast<std::uint64_t>(hView.extent(0)));
+		writeArray(os, hView.data(), hView.extent(0));
+	}
+
+private:
+	fs::path _path;
+	std::string _name;
+	std::uint64_t _key;
+};
+} // namespace detail
+} // namespace network
+} // namespace core
+} // namespace xolotl
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
 
@@ -14,6 +16,7 @@
 #include <xolotl/core/network/detail/ClusterSet.h>
 #include <xolotl/core/network/detail/MultiElementCollection.h>
 #include <xolotl/core/network/detail/ReactionData.h>
+#include <xolotl/core/network/detail/TemperatureLattice.h>
 
 namespace xolotl
 {
@@ -63,12 +66,30 @@ public:
 			});
 	}
 
+	/**
+	 * @brief Allocates (without constructing them) the given number of
+	 * reactions of each type, in the order of the reaction types.
+	 */
+	static ReactionCollection
+	allocate(IndexType gridSize, const std::vector<IndexType>& numReactions)
+	{
+		return allocate(gridSize, numReactions,
+			std::make_index_sequence<numReactionTypes>{});
+	}
+
 	void
 	setGridSize(IndexType gridSize)
 	{
 		_data.setGridSize(gridSize);
 	}
 
+	bool
+	setRateSlots(const std::vector<IndexType>& gridToSlot,
+		const std::vector<IndexType>& slotToGrid)
+	{
+		return _data.setRateSlots(gridToSlot, slotToGrid);
+	}
+
 	void
 	setConnectivity(const ClusterConnectivity<>& connectivity)
 	{
@@ -93,6 +114,17 @@ public:
 		return _data.numReactions;
 	}
 
+	std::vector<IndexType>
+	getNumberOfReactionsByType() const
+	{
+		auto ids = _reactions.getElementBeginIndices();
+		std::vector<IndexType> ret(numReactionTypes);
+		for (std::size_t t = 0; t < numReactionTypes; ++t) {
+			ret[t] = ids[t + 1] - ids[t];
+		}
+		return ret;
+	}
+
 	template <typename TReaction>
 	Kokkos::View<TReaction*>
 	getView() const
@@ -148,6 +180,74 @@ public:
 		Kokkos::fence();
 	}
 
+	void
+	updateRates(Kokkos::View<const IndexType*> gridIndices, double time = 0.0)
+	{
+		forEachBatch("ReactionNetwork::updateReactionRates",
+			gridIndices.size(), DEVICE_LAMBDA(auto&& reaction, IndexType b) {
+				reaction.updateRate(gridIndices(b), time);
+			});
+		Kokkos::fence();
+	}
+
+	/**
+	 * @brief Fills the rows of the rate table for the reactions whose rate
+	 * can be tabulated (the reactions having to be updated with the cluster
+	 * data of the temperature lattice first).
+	 */
+	void
+	tabulateRates(Kokkos::View<double**> table)
+	{
+		forEach(
+			"ReactionCollection::tabulateRates",
+			DEVICE_LAMBDA(auto&& reaction) {
+				using ReactionType =
+					std::remove_reference_t<decltype(reaction)>;
+				if constexpr (ReactionType::hasTabulatedRate) {
+					reaction.tabulateRates(table);
+				}
+			});
+		Kokkos::fence();
+	}
+
+	void
+	updateRates(const TemperatureLattice& lattice,
+		Kokkos::View<const double**> table, double time = 0.0)
+	{
+		forEach(
+			"ReactionNetwork::updateReactionRates",
+			DEVICE_LAMBDA(auto&& reaction) {
+				using ReactionType =
+					std::remove_reference_t<decltype(reaction)>;
+				if constexpr (ReactionType::hasTabulatedRate) {
+					reaction.updateRates(lattice, table, time);
+				}
+				else {
+					reaction.updateRates(time);
+				}
+			});
+		Kokkos::fence();
+	}
+
+	void
+	updateRates(Kokkos::View<const IndexType*> gridIndices,
+		const TemperatureLattice& lattice, Kokkos::View<const double**> table,
+		double time = 0.0)
+	{
+		forEachBatch("ReactionNetwork::updateReactionRates",
+			gridIndices.size(), DEVICE_LAMBDA(auto&& reaction, IndexType b) {
+				using ReactionType =
+					std::remove_reference_t<decltype(reaction)>;
+				if constexpr (ReactionType::hasTabulatedRate) {
+					reaction.updateRate(gridIndices(b), lattice, table, time);
+				}
+				else {
+					reaction.updateRate(gridIndices(b), time);
+				}
+			});
+		Kokkos::fence();
+	}
+
 	double
 	getLargestRate() const
 	{
@@ -169,6 +269,12 @@ public:
 		return largestRate;
 	}
 
+	void
+	setDispatchByType(bool byType)
+	{
+		_reactions.setDispatchByType(byType);
+	}
+
 	template <typename F>
 	void
 	forEach(const F& func)
@@ -183,6 +289,13 @@ public:
 		_reactions.forEach(label, func);
 	}
 
+	template <typename F>
+	void
+	forEachBatch(const std::string& label, IndexType batchSize, const F& func)
+	{
+		_reactions.forEachBatch(label, batchSize, func);
+	}
+
 	template <typename TReaction, typename F>
 	void
 	forEachOn(const F& func)
@@ -211,6 +324,24 @@ public:
 		_reactions.reduce(label, func, out);
 	}
 
+	template <typename F, typename T>
+	void
+	reduceOver(const std::string& label, Kokkos::View<const IndexType*> ids,
+		IndexType begin, IndexType end, const F& func, T& out)
+	{
+		_reactions.reduceOver(label, ids, begin, end, func, out);
+	}
+
+	template <typename F, typename T>
+	void
+	reduceOverBatch(const std::string& label,
+		Kokkos::View<const IndexType*> ids, IndexType begin, IndexType end,
+		IndexType batchSize, const F& func, Kokkos::View<T*> out)
+	{
+		_reactions.reduceOverBatch(
+			label, ids, begin, end, batchSize, func, out);
+	}
+
 	template <typename TReaction, typename F, typename T>
 	void
 	reduceOn(const F& func, T& out)
@@ -225,6 +356,17 @@ public:
 		_reactions.template reduceOn<TReaction>(label, func, out);
 	}
 
+private:
+	template <std::size_t... Is>
+	static ReactionCollection
+	allocate(IndexType gridSize, const std::vector<IndexType>& numReactions,
+		std::index_sequence<Is...>)
+	{
+		return ReactionCollection(gridSize,
+			Kokkos::View<std::tuple_element_t<Is, ReactionTypes>*>(
+				"Reactions", numReactions[Is])...);
+	}
+
 private:
 	MultiElementCollection<ReactionTypes> _reactions;
 	ReactionData<NetworkType> _data;
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include <Kokkos_Core.hpp>
 
 #include <xolotl/core/network/ReactionNetworkTraits.h>
@@ -16,6 +18,79 @@ using CoefficientsView = Kokkos::View<double*****>;
 using CoefficientsViewUnmanaged =
 	Kokkos::View<double*****, Kokkos::MemoryUnmanaged>;
 
+/**
+ * @brief Gives access to the rates of one reaction by grid index.
+ *
+ * The rates are stored by slot. By default there is one slot per grid point
+ * and the grid index is the slot, but grid points sharing the same
+ * temperature can also share the same slot, the grid index is then mapped to
+ * its slot.
+ */
+struct ReactionRates
+{
+	using IndexType = ReactionNetworkIndexType;
+	using RowView =
+		Kokkos::View<double*, Kokkos::LayoutStride, Kokkos::MemoryUnmanaged>;
+	using IndexView = Kokkos::View<IndexType*, Kokkos::MemoryUnmanaged>;
+
+	ReactionRates() = default;
+
+	KOKKOS_INLINE_FUNCTION
+	ReactionRates(const RowView& rateRow, const IndexView& slots,
+		const IndexView& grids, bool shared) :
+		row(rateRow),
+		gridSlots(slots),
+		slotGrids(grids),
+		sharedSlots(shared)
+	{
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	double&
+	operator()(IndexType gridIndex) const
+	{
+		return sharedSlots ? row(gridSlots(gridIndex)) : row(gridIndex);
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	double&
+	operator[](IndexType gridIndex) const
+	{
+		return (*this)(gridIndex);
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	IndexType
+	getNumberOfSlots() const
+	{
+		return row.extent(0);
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	double&
+	slot(IndexType slotId) const
+	{
+		return row(slotId);
+	}
+
+	/**
+	 * @brief Grid index to use to compute the rate of the given slot
+	 */
+	KOKKOS_INLINE_FUNCTION
+	IndexType
+	getSlotGridIndex(IndexType slotId) const
+	{
+		return slotGrids(slotId);
+	}
+
+	RowView row;
+	IndexView gridSlots;
+	IndexView slotGrids;
+	//! Whether grid points may share slots, the grid index is the slot
+	//! otherwise
+	bool sharedSlots{false};
+};
+
 /**
  * @brief Stores all the information needed for a reaction
  * (overlap widths, rates, position in the collection, grouping
@@ -36,15 +111,20 @@ struct ReactionData
 	static constexpr std::size_t numSpeciesNoI =
 		NetworkType::getNumberOfSpeciesNoI();
 
+	static constexpr std::size_t numRateConstants =
+		NumberOfRateConstants<NetworkType>::value;
+
 	ReactionData() = default;
 
 	ReactionData(IndexType nReactions, IndexType gridSize,
 		const Kokkos::Array<IndexType, numReactionTypes + 1>& rBeginIds) :
 		numReactions(nReactions),
 		widths("Reaction Widths", numReactions, numSpeciesNoI),
-		rates("Reaction Rates", numReactions, gridSize),
+		rateConstants(
+			"Reaction Rate Constants", numReactions, numRateConstants),
 		reactionBeginIndices(rBeginIds)
 	{
+		setGridSize(gridSize);
 	}
 
 	std::uint64_t
@@ -54,7 +134,12 @@ struct ReactionData
 		ret += sizeof(reactionBeginIndices);
 		ret +=
 			widths.required_allocation_size(widths.extent(0), widths.extent(1));
+		ret += rateConstants.required_allocation_size(
+			rateConstants.extent(0), rateConstants.extent(1));
 		ret += rates.required_allocation_size(rates.extent(0), rates.extent(1));
+		ret += rateSlots.required_allocation_size(rateSlots.extent(0));
+		ret += slotGridIndices.required_allocation_size(
+			slotGridIndices.extent(0));
 
 		for (std::size_t r = 0; r < numReactionTypes; ++r) {
 			ret += coeffs[r].required_allocation_size(coeffs[r].extent(0),
@@ -65,16 +150,80 @@ struct ReactionData
 		return ret;
 	}
 
+	/**
+	 * @brief Allocates the rates with one slot per grid point
+	 */
 	void
 	setGridSize(IndexType gridSize)
 	{
+		sharedSlots = false;
 		rates =
 			Kokkos::View<double**>("Reaction Rates", numReactions, gridSize);
+		rateSlots = Kokkos::View<IndexType*>("Rate Slots", gridSize);
+		slotGridIndices =
+			Kokkos::View<IndexType*>("Rate Slot Grid Indices", gridSize);
+		auto slots = rateSlots;
+		auto grids = slotGridIndices;
+		Kokkos::parallel_for(
+			"ReactionData::setGridSize", gridSize,
+			KOKKOS_LAMBDA(const IndexType i) {
+				slots(i) = i;
+				grids(i) = i;
+			});
+		Kokkos::fence();
+	}
+
+	/**
+	 * @brief Sets the map from grid points to rate slots, reallocating the
+	 * rates if the number of slots changed.
+	 *
+	 * @param gridToSlot The slot of each grid point
+	 * @param slotToGrid The grid point used to compute each slot
+	 * @return Whether any view was reallocated or the slots just started
+	 * to be shared (the reactions have to update their copies)
+	 */
+	bool
+	setRateSlots(const std::vector<IndexType>& gridToSlot,
+		const std::vector<IndexType>& slotToGrid)
+	{
+		bool reallocated = not sharedSlots;
+		sharedSlots = true;
+		if (rates.extent(1) != slotToGrid.size()) {
+			rates = Kokkos::View<double**>(
+				"Reaction Rates", numReactions, slotToGrid.size());
+			slotGridIndices = Kokkos::View<IndexType*>(
+				"Rate Slot Grid Indices", slotToGrid.size());
+			reallocated = true;
+		}
+		if (rateSlots.extent(0) != gridToSlot.size()) {
+			rateSlots = Kokkos::View<IndexType*>("Rate Slots", gridToSlot.size());
+			reallocated = true;
+		}
+
+		using HostUnmanaged = Kokkos::View<const IndexType*, Kokkos::HostSpace,
+			Kokkos::MemoryUnmanaged>;
+		Kokkos::deep_copy(
+			rateSlots, HostUnmanaged(gridToSlot.data(), gridToSlot.size()));
+		Kokkos::deep_copy(slotGridIndices,
+			HostUnmanaged(slotToGrid.data(), slotToGrid.size()));
+
+		return reallocated;
 	}
 
 	IndexType numReactions{};
 	Kokkos::View<double**> widths;
+	//! Temperature independent terms of the rate of each reaction (binding
+	//! energy, capture geometry), computed once with the reaction
+	Kokkos::View<double**> rateConstants;
+	//! Rates for each reaction and each rate slot
 	Kokkos::View<double**> rates;
+	//! Rate slot of each grid point
+	Kokkos::View<IndexType*> rateSlots;
+	//! Grid point used to compute the rates of each slot
+	Kokkos::View<IndexType*> slotGridIndices;
+	//! Whether the rate slots are shared between grid points, the rates are
+	//! read without the rate slots otherwise
+	bool sharedSlots{false};
 	Kokkos::Array<IndexType, numReactionTypes + 1> reactionBeginIndices;
 	Kokkos::Array<CoefficientsView, numReactionTypes> coeffs;
 };
@@ -94,7 +243,11 @@ struct ReactionDataRef
 	KOKKOS_INLINE_FUNCTION
 	ReactionDataRef(const ReactionData<NetworkType>& data) :
 		widths(data.widths),
+		rateConstants(data.rateConstants),
 		rates(data.rates),
+		rateSlots(data.rateSlots),
+		slotGridIndices(data.slotGridIndices),
+		sharedSlots(data.sharedSlots),
 		reactionBeginIndices(data.reactionBeginIndices)
 	{
 		for (std::size_t r = 0; r < numReactionTypes; ++r) {
@@ -124,15 +277,27 @@ struct ReactionDataRef
 		return Kokkos::subview(widths, reactionId, Kokkos::ALL);
 	}
 
+	KOKKOS_INLINE_FUNCTION
+	auto
+	getRateConstants(IndexType reactionId)
+	{
+		return Kokkos::subview(rateConstants, reactionId, Kokkos::ALL);
+	}
+
 	KOKKOS_INLINE_FUNCTION
 	auto
 	getRates(IndexType reactionId)
 	{
-		return Kokkos::subview(rates, reactionId, Kokkos::ALL);
+		return ReactionRates(Kokkos::subview(rates, reactionId, Kokkos::ALL),
+			rateSlots, slotGridIndices, sharedSlots);
 	}
 
 	Kokkos::View<double**, Kokkos::MemoryUnmanaged> widths;
+	Kokkos::View<double**, Kokkos::MemoryUnmanaged> rateConstants;
 	Kokkos::View<double**, Kokkos::MemoryUnmanaged> rates;
+	Kokkos::View<IndexType*, Kokkos::MemoryUnmanaged> rateSlots;
+	Kokkos::View<IndexType*, Kokkos::MemoryUnmanaged> slotGridIndices;
+	bool sharedSlots{false};
 	Kokkos::Array<IndexType, numReactionTypes + 1> reactionBeginIndices;
 	Kokkos::Array<CoefficientsViewUnmanaged, numReactionTypes> coeffs;
 };
@@ -55,6 +55,11 @@ public:
 
 	ReactionGeneratorBase(const TNetwork& network);
 
+	/**
+	 * @brief Generates the reactions from the pairs of clusters that can
+	 * react, with at least one of the pair in the candidate list (see
+	 * getCandidateClusterIds()).
+	 */
 	ReactionCollection<NetworkType>
 	generateReactions();
 
@@ -137,6 +142,12 @@ public:
 		return _connectivity;
 	}
 
+	ClusterSetView
+	getClusterSets() const
+	{
+		return _allClusterSets;
+	}
+
 protected:
 	TDerived*
 	asDerived()
@@ -144,6 +155,22 @@ protected:
 		return static_cast<TDerived*>(this);
 	}
 
+	/**
+	 * @brief Lists the clusters that a reacting pair must include: the
+	 * mobile ones, or all of them if constant reactions are defined.
+	 */
+	IndexView
+	getCandidateClusterIds() const;
+
+	/**
+	 * @brief Calls the derived generator on each pair (i <= j) with at
+	 * least one cluster in candidateIds.
+	 */
+	template <typename TTag>
+	void
+	generateOnCandidatePairs(
+		const std::string& label, IndexView candidateIds, TTag tag);
+
 protected:
 	Subpaving _subpaving;
 	ClusterData _clusterData;
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cmath>
+
+#include <Kokkos_Core.hpp>
+
+#include <xolotl/core/network/ReactionNetworkTraits.h>
+
+namespace xolotl
+{
+namespace core
+{
+namespace network
+{
+namespace detail
+{
+/**
+ * @brief Uniform temperature lattice on which the temperature dependent
+ * quantities (diffusion coefficients and rates) are tabulated, then linearly
+ * interpolated
+ *
+ * The interpolation error of a tabulated f(T) is bounded by
+ * step^2 * max|f''| / 8 over each cell.
+ */
+struct TemperatureLattice
+{
+	using IndexType = ReactionNetworkIndexType;
+
+	TemperatureLattice() = default;
+
+	/**
+	 * @brief Builds the lattice covering [minTemp, maxTemp] (the last
+	 * temperature may go above maxTemp to keep the step)
+	 */
+	TemperatureLattice(double minTemp, double maxTemp, double step_) :
+		minTemperature(minTemp),
+		step(step_),
+		size(static_cast<IndexType>(std::ceil((maxTemp - minTemp) / step_)) + 1)
+	{
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	bool
+	isEnabled() const noexcept
+	{
+		return size > 1;
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	double
+	getTemperature(IndexType k) const noexcept
+	{
+		return minTemperature + k * step;
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	bool
+	contains(double temp) const noexcept
+	{
+		return temp >= minTemperature && temp <= getTemperature(size - 1);
+	}
+
+	/**
+	 * @brief Interpolates the given row of a table (one column per lattice
+	 * temperature) at a temperature contained in the lattice
+	 */
+	template <typename TTable>
+	KOKKOS_INLINE_FUNCTION
+	double
+	interpolate(const TTable& table, IndexType row, double temp) const
+	{
+		double x = (temp - minTemperature) / step;
+		auto k = static_cast<IndexType>(x);
+		if (k > size - 2) {
+			k = size - 2;
+		}
+		double w = x - k;
+		return (1.0 - w) * table(row, k) + w * table(row, k + 1);
+	}
+
+	double minTemperature{};
+	double step{};
+	IndexType size{};
+};
+} // namespace detail
+} // namespace network
+} // namespace core
+} // namespace xolotl
@@ -46,6 +46,7 @@ template <typename TClusterDataParent>
 struct TrapMutationClusterData
 {
 	using AmountType = typename TClusterDataParent::AmountType;
+	using IndexType = typename TClusterDataParent::IndexType;
 	template <typename TData>
 	using View = typename TClusterDataParent::template View<TData>;
 
@@ -72,14 +73,29 @@ struct TrapMutationClusterData
 	getDeviceMemorySize() const noexcept;
 
 	void
-	initialize();
+	initialize(IndexType gridSize);
+
+	/**
+	 * @brief Reallocates the grid point tables (their content is lost)
+	 */
+	void
+	setGridSize(IndexType gridSize);
+
+	KOKKOS_INLINE_FUNCTION
+	bool
+	isEnabled(IndexType gridIndex, AmountType heAmount) const
+	{
+		return tmEnabled(gridIndex * 7 + heAmount - 1);
+	}
 
 	View<Desorption> desorption;
-	View<double> currentDesorpLeftSideRate;
+	//! Left side rate of the desorption cluster at each grid point
+	View<double*> currentDesorpLeftSideRate;
 	View<double> currentDisappearingRate;
 	View<double[7]> tmDepths;
 	View<AmountType[7]> tmVSizes;
-	View<bool[7]> tmEnabled;
+	//! Whether each helium size can trap-mutate, 7 entries per grid point
+	View<bool*> tmEnabled;
 };
 } // namespace detail
 } // namespace network
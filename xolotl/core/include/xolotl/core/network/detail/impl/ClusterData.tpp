@@ -65,6 +65,24 @@ ClusterDataCommon<MemSpace>::deepCopy(const TClusterDataCommon& data)
 	deep_copy(diffusionCoefficient, data.diffusionCoefficient);
 }
 
+template <typename MemSpace>
+template <typename TClusterDataCommon>
+inline void
+ClusterDataCommon<MemSpace>::deepCopyFields(
+	const TClusterDataCommon& data, unsigned fields)
+{
+	if (fields & CLUSTER_DATA_PARAMETERS) {
+		deep_copy(_floatVals, data._floatVals);
+		deep_copy(_boolVals, data._boolVals);
+	}
+	if (fields & CLUSTER_DATA_TEMPERATURE) {
+		deep_copy(temperature, data.temperature);
+	}
+	if (fields & CLUSTER_DATA_DIFFUSION_COEFFICIENT) {
+		deep_copy(diffusionCoefficient, data.diffusionCoefficient);
+	}
+}
+
 template <typename MemSpace>
 inline std::uint64_t
 ClusterDataCommon<MemSpace>::getDeviceMemorySize() const noexcept
@@ -128,6 +146,19 @@ ClusterData<TNetwork, MemSpace>::deepCopy(const TClusterData& data)
 	extraData.deepCopy(data.extraData);
 }
 
+template <typename TNetwork, typename MemSpace>
+template <typename TClusterData>
+inline void
+ClusterData<TNetwork, MemSpace>::deepCopyFields(
+	const TClusterData& data, unsigned fields)
+{
+	Superclass::deepCopyFields(data, fields);
+
+	if (fields & CLUSTER_DATA_EXTRA) {
+		extraData.deepCopy(data.extraData);
+	}
+}
+
 template <typename TNetwork, typename MemSpace>
 inline std::uint64_t
 ClusterData<TNetwork, MemSpace>::getDeviceMemorySize() const noexcept
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <numeric>
+#include <vector>
+
 namespace xolotl
 {
 namespace core
@@ -27,33 +30,17 @@ template <typename TNetwork, typename TDerived>
 ReactionCollection<TNetwork>
 ReactionGeneratorBase<TNetwork, TDerived>::generateReactions()
 {
-	auto numClusters = _clusterData.numClusters;
-	auto generator = *(this->asDerived());
-	using Range2D = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
-	auto range2d = Range2D({0, 0}, {numClusters, numClusters});
-	Kokkos::parallel_for(
-		"ReactionGeneratorBase::generateReactions::count", range2d,
-		KOKKOS_LAMBDA(IndexType i, IndexType j) {
-			if (j < i) {
-				return;
-			}
-			generator(i, j, Count{});
-		});
-	Kokkos::fence();
+	auto candidateIds = getCandidateClusterIds();
+
+	generateOnCandidatePairs(
+		"ReactionGeneratorBase::generateReactions::count", candidateIds,
+		Count{});
 
 	setupCrs();
 
-	generator = *(this->asDerived());
-
-	Kokkos::parallel_for(
-		"ReactionGeneratorBase::generateReactions::construct", range2d,
-		KOKKOS_LAMBDA(IndexType i, IndexType j) {
-			if (j < i) {
-				return;
-			}
-			generator(i, j, Construct{});
-		});
-	Kokkos::fence();
+	generateOnCandidatePairs(
+		"ReactionGeneratorBase::generateReactions::construct", candidateIds,
+		Construct{});
 
 	// TODO: Should this be done in the ReactionCollection constructor?
 	//      - Constructing all reactions
@@ -68,6 +55,74 @@ ReactionGeneratorBase<TNetwork, TDerived>::generateReactions()
 	return reactionCollection;
 }
 
+template <typename TNetwork, typename TDerived>
+typename ReactionGeneratorBase<TNetwork, TDerived>::IndexView
+ReactionGeneratorBase<TNetwork, TDerived>::getCandidateClusterIds() const
+{
+	auto numClusters = _clusterData.numClusters;
+	std::vector<IndexType> ids;
+	if (_constantConns.extent(0) > 0) {
+		// Constant reactions can connect any pair of clusters
+		ids.resize(numClusters);
+		std::iota(ids.begin(), ids.end(), 0);
+	}
+	else {
+		// Otherwise at least one of the reactants has to diffuse
+		auto diffusionFactor =
+			create_mirror_view(_clusterData.diffusionFactor);
+		deep_copy(diffusionFactor, _clusterData.diffusionFactor);
+		for (IndexType i = 0; i < numClusters; ++i) {
+			if (diffusionFactor(i) != 0.0) {
+				ids.push_back(i);
+			}
+		}
+	}
+
+	auto candidateIds = IndexView(
+		Kokkos::ViewAllocateWithoutInitializing("Candidate Cluster Ids"),
+		ids.size());
+	auto hCandidateIds = create_mirror_view(candidateIds);
+	for (std::size_t m = 0; m < ids.size(); ++m) {
+		hCandidateIds(m) = ids[m];
+	}
+	deep_copy(candidateIds, hCandidateIds);
+	return candidateIds;
+}
+
+template <typename TNetwork, typename TDerived>
+template <typename TTag>
+void
+ReactionGeneratorBase<TNetwork, TDerived>::generateOnCandidatePairs(
+	const std::string& label, IndexView candidateIds, TTag tag)
+{
+	auto numClusters = _clusterData.numClusters;
+	auto numCandidates = candidateIds.extent(0);
+	auto isCandidate = IndexView("Is Candidate", numClusters);
+	Kokkos::parallel_for(
+		label + "::flag", numCandidates, KOKKOS_LAMBDA(IndexType m) {
+			isCandidate(candidateIds(m)) = 1;
+		});
+
+	auto generator = *(this->asDerived());
+	using Range2D = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
+	Kokkos::parallel_for(label,
+		Range2D({0, 0}, {numCandidates, numClusters}),
+		KOKKOS_LAMBDA(IndexType m, IndexType k) {
+			auto i = candidateIds(m);
+			if (k < i) {
+				// A pair of candidates is visited from its smallest id
+				if (isCandidate(k)) {
+					return;
+				}
+				generator(k, i, tag);
+			}
+			else {
+				generator(i, k, tag);
+			}
+		});
+	Kokkos::fence();
+}
+
 template <typename TNetwork, typename TDerived>
 typename TNetwork::IndexType
 ReactionGeneratorBase<TNetwork, TDerived>::getRowMapAndTotalReactionCount()
@@ -272,6 +327,8 @@ ReactionGeneratorBase<TNetwork, TDerived>::generateConnectivity(
 			return ret;
 		});
 	nEntries = connectivity.entries.extent(0);
+	// Sorted rows give logarithmic position lookups
+	connectivity.sortRows();
 
 	_connectivity = connectivity;
 	reactionCollection.setConnectivity(_connectivity);
@@ -18,7 +18,9 @@ TrapMutationClusterData<TClusterDataParent>::deepCopy(
 		return;
 	}
 
-	if (!desorption.is_allocated()) {
+	// The grid point tables are reallocated with the grid size
+	if (!desorption.is_allocated() ||
+		tmEnabled.extent(0) != from.tmEnabled.extent(0)) {
 		desorption = create_mirror_view(from.desorption);
 		currentDesorpLeftSideRate =
 			create_mirror_view(from.currentDesorpLeftSideRate);
@@ -45,22 +47,20 @@ TrapMutationClusterData<TClusterDataParent>::getDeviceMemorySize()
 	std::uint64_t ret = 0;
 
 	ret += desorption.required_allocation_size();
-	ret += currentDesorpLeftSideRate.required_allocation_size();
+	ret += currentDesorpLeftSideRate.required_allocation_size(
+		currentDesorpLeftSideRate.size());
 	ret += currentDisappearingRate.required_allocation_size();
 	ret += tmDepths.required_allocation_size();
 	ret += tmVSizes.required_allocation_size();
-	ret += tmEnabled.required_allocation_size();
+	ret += tmEnabled.required_allocation_size(tmEnabled.size());
 
 	return ret;
 }
 
 template <typename TClusterDataParent>
 inline void
-TrapMutationClusterData<TClusterDataParent>::initialize()
+TrapMutationClusterData<TClusterDataParent>::initialize(IndexType gridSize)
 {
-	currentDesorpLeftSideRate =
-		View<double>("Current Desorption Left Side Rate");
-
 	currentDisappearingRate =
 		View<double>("Current Trap Mutation Disappearing Rate");
 	auto mirror = create_mirror_view(currentDisappearingRate);
@@ -71,7 +71,18 @@ TrapMutationClusterData<TClusterDataParent>::initialize()
 	tmDepths = View<double[7]>("Trap-mutation depths");
 	tmVSizes = View<AmountType[7]>("Trap-mutation vacancy sizes");
 
-	tmEnabled = View<bool[7]>("Trap-mutation enabled helium sizes");
+	setGridSize(gridSize);
+}
+
+template <typename TClusterDataParent>
+inline void
+TrapMutationClusterData<TClusterDataParent>::setGridSize(IndexType gridSize)
+{
+	currentDesorpLeftSideRate =
+		View<double*>("Current Desorption Left Side Rate", gridSize);
+
+	tmEnabled =
+		View<bool*>("Trap-mutation enabled helium sizes", gridSize * 7);
 }
 } // namespace detail
 } // namespace network
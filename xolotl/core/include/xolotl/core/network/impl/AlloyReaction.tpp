@@ -11,11 +11,19 @@ namespace network
 {
 namespace alloy
 {
+//! Position of the capture factor in the rate constants (after the binding
+//! energy of the dissociations)
+constexpr std::size_t captureIndex = 1;
+
+/**
+ * @brief Computes the temperature independent part of the rate between two
+ * clusters, the rate being this factor times (dc0 + dc1).
+ */
 template <typename TRegion>
 KOKKOS_INLINE_FUNCTION
 double
-getRate(const TRegion& pairCl0Reg, const TRegion& pairCl1Reg, const double r0,
-	const double r1, const double dc0, const double dc1)
+getCaptureFactor(const TRegion& pairCl0Reg, const TRegion& pairCl1Reg,
+	const double r0, const double r1)
 {
 	constexpr double pi = ::xolotl::core::pi;
 	constexpr double rCore = ::xolotl::core::alloyCoreRadius;
@@ -30,7 +38,7 @@ getRate(const TRegion& pairCl0Reg, const TRegion& pairCl1Reg, const double r0,
 
 	// Simple case
 	if (cl0IsSphere && cl1IsSphere) {
-		return zs * (dc0 + dc1);
+		return zs;
 	}
 
 	double p = 0.0, zl = 0.0;
@@ -43,20 +51,31 @@ getRate(const TRegion& pairCl0Reg, const TRegion& pairCl1Reg, const double r0,
 		zl = 4.0 * pow(pi, 2.0) * r0 / log(1.0 + 8.0 * r0 / (r1 + rCore));
 	}
 
-	double k_plus = (dc0 + dc1) * (p * zs + (1.0 - p) * zl);
 	double bias = 1.0;
 	if (pairCl0Reg.getOrigin().isOnAxis(Species::I) ||
 		pairCl1Reg.getOrigin().isOnAxis(Species::I)) {
 		bias = 1.2;
 	}
 
-	return k_plus * bias;
+	return (p * zs + (1.0 - p) * zl) * bias;
 }
 } // namespace alloy
 
 KOKKOS_INLINE_FUNCTION
 double
 AlloyProductionReaction::getRateForProduction(IndexType gridIndex)
+{
+	double dc0 = this->_clusterData->getCluster(_reactants[0])
+					 .getDiffusionCoefficient(gridIndex);
+	double dc1 = this->_clusterData->getCluster(_reactants[1])
+					 .getDiffusionCoefficient(gridIndex);
+
+	return this->_rateConstants(alloy::captureIndex) * (dc0 + dc1);
+}
+
+KOKKOS_INLINE_FUNCTION
+void
+AlloyProductionReaction::computeRateConstants()
 {
 	auto cl0 = this->_clusterData->getCluster(_reactants[0]);
 	auto cl1 = this->_clusterData->getCluster(_reactants[1]);
@@ -64,26 +83,37 @@ AlloyProductionReaction::getRateForProduction(IndexType gridIndex)
 	double r0 = cl0.getReactionRadius();
 	double r1 = cl1.getReactionRadius();
 
-	double dc0 = cl0.getDiffusionCoefficient(gridIndex);
-	double dc1 = cl1.getDiffusionCoefficient(gridIndex);
-
-	return alloy::getRate(cl0.getRegion(), cl1.getRegion(), r0, r1, dc0, dc1);
+	this->_rateConstants(alloy::captureIndex) =
+		alloy::getCaptureFactor(cl0.getRegion(), cl1.getRegion(), r0, r1);
 }
 
 KOKKOS_INLINE_FUNCTION
 double
 AlloyDissociationReaction::getRateForProduction(IndexType gridIndex)
 {
+	double dc0 = this->_clusterData->getCluster(_products[0])
+					 .getDiffusionCoefficient(gridIndex);
+	double dc1 = this->_clusterData->getCluster(_products[1])
+					 .getDiffusionCoefficient(gridIndex);
+
+	return this->_rateConstants(alloy::captureIndex) * (dc0 + dc1);
+}
+
+KOKKOS_INLINE_FUNCTION
+void
+AlloyDissociationReaction::computeRateConstants()
+{
+	// The binding energy
+	Superclass::computeRateConstants();
+
 	auto cl0 = this->_clusterData->getCluster(_products[0]);
 	auto cl1 = this->_clusterData->getCluster(_products[1]);
 
 	double r0 = cl0.getReactionRadius();
 	double r1 = cl1.getReactionRadius();
 
-	double dc0 = cl0.getDiffusionCoefficient(gridIndex);
-	double dc1 = cl1.getDiffusionCoefficient(gridIndex);
-
-	return alloy::getRate(cl0.getRegion(), cl1.getRegion(), r0, r1, dc0, dc1);
+	this->_rateConstants(alloy::captureIndex) =
+		alloy::getCaptureFactor(cl0.getRegion(), cl1.getRegion(), r0, r1);
 }
 
 KOKKOS_INLINE_FUNCTION
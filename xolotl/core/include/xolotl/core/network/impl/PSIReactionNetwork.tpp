@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <limits>
 #include <set>
 
 #include <xolotl/core/network/detail/PSITrapMutation.h>
@@ -55,9 +57,11 @@ PSIReactionNetwork<TSpeciesEnum>::initializeExtraClusterData(
 		return;
 	}
 
-	this->_clusterData.h_view().extraData.trapMutationData.initialize();
+	this->_clusterData.h_view().extraData.trapMutationData.initialize(
+		this->_gridSize);
 	this->copyClusterDataView();
 	this->invalidateDataMirror();
+	checkTrapMutationGridSize();
 }
 
 template <typename TSpeciesEnum>
@@ -76,7 +80,15 @@ PSIReactionNetwork<TSpeciesEnum>::updateExtraClusterData(
 			break;
 	}
 
+	auto oldDepths = _tmHandler->getDepths();
 	_tmHandler->updateData(gridTemps[tempId]);
+	if (_tmHandler->getDepths() != oldDepths) {
+		// Every grid point of the table has to be filled again
+		std::fill(_tmSurfaceDepths.begin(), _tmSurfaceDepths.end(),
+			std::numeric_limits<double>::quiet_NaN());
+		std::fill(_tmSpacings.begin(), _tmSpacings.end(),
+			std::numeric_limits<double>::quiet_NaN());
+	}
 
 	auto& tmData = this->_clusterData.h_view().extraData.trapMutationData;
 
@@ -97,6 +109,7 @@ PSIReactionNetwork<TSpeciesEnum>::updateExtraClusterData(
 	auto desorp = create_mirror_view(tmData.desorption);
 	desorp() = detail::Desorption{desorpInit, desorpId};
 	deep_copy(tmData.desorption, desorp);
+	_desorptionId = desorpId;
 
 	auto depths = Kokkos::View<const double[7], HostSpace, MemoryUnmanaged>(
 		_tmHandler->getDepths().data());
@@ -106,34 +119,127 @@ PSIReactionNetwork<TSpeciesEnum>::updateExtraClusterData(
 		_tmHandler->getVacancySizes().data());
 	deep_copy(tmData.tmVSizes, vSizes);
 
-	this->invalidateDataMirror();
+	this->invalidateDataMirrorFields(detail::CLUSTER_DATA_EXTRA);
 }
 
 template <typename TSpeciesEnum>
 void
-PSIReactionNetwork<TSpeciesEnum>::selectTrapMutationReactions(
-	double depth, double spacing)
+PSIReactionNetwork<TSpeciesEnum>::checkTrapMutationGridSize()
 {
+	const auto gridSize = static_cast<std::size_t>(this->_gridSize);
+	if (_tmSurfaceDepths.size() == gridSize &&
+		_tmEnabledHost.extent(0) == gridSize * 7) {
+		return;
+	}
+
 	auto& tmData = this->_clusterData.h_view().extraData.trapMutationData;
-	auto depths = create_mirror_view(tmData.tmDepths);
-	deep_copy(depths, tmData.tmDepths);
-	auto enable = create_mirror_view(tmData.tmEnabled);
+	if (tmData.tmEnabled.extent(0) != gridSize * 7) {
+		tmData.setGridSize(this->_gridSize);
+		this->copyClusterDataView();
+		this->invalidateDataMirrorFields(detail::CLUSTER_DATA_EXTRA);
+	}
+
+	_tmEnabledHost = Kokkos::View<bool*, Kokkos::HostSpace>(
+		"Trap-mutation enabled helium sizes (host)", gridSize * 7);
+	_tmSurfaceDepths.assign(gridSize, std::numeric_limits<double>::quiet_NaN());
+	_tmSpacings.assign(gridSize, std::numeric_limits<double>::quiet_NaN());
+}
+
+template <typename TSpeciesEnum>
+bool
+PSIReactionNetwork<TSpeciesEnum>::fillTrapMutationTable(
+	IndexType gridIndex, double depth, double spacing)
+{
+	if (_tmSurfaceDepths[gridIndex] == depth &&
+		_tmSpacings[gridIndex] == spacing) {
+		return false;
+	}
+	_tmSurfaceDepths[gridIndex] = depth;
+	_tmSpacings[gridIndex] = spacing;
+
+	const auto& depths = _tmHandler->getDepths();
 	for (std::size_t l = 0; l < depths.size(); ++l) {
-		enable[l] = false;
+		auto& enable = _tmEnabledHost(gridIndex * 7 + l);
+		enable = false;
 		if (depths[l] == 0.0) {
 			continue;
 		}
 		if (depths[l] < depth + 0.01 && depths[l] > depth - spacing - 0.01) {
-			enable[l] = true;
+			enable = true;
 		}
 	}
-	deep_copy(tmData.tmEnabled, enable);
+
+	return true;
+}
+
+template <typename TSpeciesEnum>
+void
+PSIReactionNetwork<TSpeciesEnum>::selectTrapMutationReactions(
+	IndexType gridIndex, double depth, double spacing)
+{
+	checkTrapMutationGridSize();
+	if (!fillTrapMutationTable(gridIndex, depth, spacing)) {
+		return;
+	}
+
+	auto& tmData = this->_clusterData.h_view().extraData.trapMutationData;
+	auto entries = Kokkos::make_pair(gridIndex * 7, (gridIndex + 1) * 7);
+	deep_copy(Kokkos::subview(tmData.tmEnabled, entries),
+		Kokkos::subview(_tmEnabledHost, entries));
 
 	// NOTE:
 	// Not calling invalidateDataMirror() here because this change should
 	// only matter to reactions on-device
 }
 
+template <typename TSpeciesEnum>
+void
+PSIReactionNetwork<TSpeciesEnum>::selectTrapMutationReactions(
+	const GridIndicesView& gridIndices, const std::vector<double>& depths,
+	const std::vector<double>& spacings)
+{
+	checkTrapMutationGridSize();
+	auto hIds = gridIndices.h_view;
+	bool changed = false;
+	for (IndexType b = 0; b < hIds.extent(0); ++b) {
+		if (hIds(b) == this->invalidIndex()) {
+			continue;
+		}
+		changed =
+			fillTrapMutationTable(hIds(b), depths[b], spacings[b]) || changed;
+	}
+	if (!changed) {
+		return;
+	}
+
+	auto& tmData = this->_clusterData.h_view().extraData.trapMutationData;
+	deep_copy(tmData.tmEnabled, _tmEnabledHost);
+}
+
+template <typename TSpeciesEnum>
+bool
+PSIReactionNetwork<TSpeciesEnum>::requiresPointwisePreProcess(
+	const GridIndicesView& gridIndices) const
+{
+	if (!this->_enableTrapMutation) {
+		return false;
+	}
+
+	auto hIds = gridIndices.h_view;
+	std::vector<bool> seen(this->_gridSize, false);
+	for (IndexType b = 0; b < hIds.extent(0); ++b) {
+		auto id = hIds(b);
+		if (id == this->invalidIndex()) {
+			continue;
+		}
+		if (id >= this->_gridSize || seen[id]) {
+			return true;
+		}
+		seen[id] = true;
+	}
+	return false;
+}
+
 template <typename TSpeciesEnum>
 void
 PSIReactionNetwork<TSpeciesEnum>::computeFluxesPreProcess(
@@ -142,7 +248,20 @@ PSIReactionNetwork<TSpeciesEnum>::computeFluxesPreProcess(
 {
 	if (this->_enableTrapMutation) {
 		updateDesorptionLeftSideRate(concentrations, gridIndex);
-		selectTrapMutationReactions(surfaceDepth, spacing);
+		selectTrapMutationReactions(gridIndex, surfaceDepth, spacing);
+	}
+}
+
+template <typename TSpeciesEnum>
+void
+PSIReactionNetwork<TSpeciesEnum>::computeFluxesBatchPreProcess(
+	ConcentrationsBatchView concentrations, const GridIndicesView& gridIndices,
+	const std::vector<double>& surfaceDepths,
+	const std::vector<double>& spacings)
+{
+	if (this->_enableTrapMutation) {
+		updateDesorptionLeftSideRates(concentrations, gridIndices);
+		selectTrapMutationReactions(gridIndices, surfaceDepths, spacings);
 	}
 }
 
@@ -154,7 +273,20 @@ PSIReactionNetwork<TSpeciesEnum>::computePartialsPreProcess(
 {
 	if (this->_enableTrapMutation) {
 		updateDesorptionLeftSideRate(concentrations, gridIndex);
-		selectTrapMutationReactions(surfaceDepth, spacing);
+		selectTrapMutationReactions(gridIndex, surfaceDepth, spacing);
+	}
+}
+
+template <typename TSpeciesEnum>
+void
+PSIReactionNetwork<TSpeciesEnum>::computePartialsBatchPreProcess(
+	ConcentrationsBatchView concentrations, const GridIndicesView& gridIndices,
+	const std::vector<double>& surfaceDepths,
+	const std::vector<double>& spacings)
+{
+	if (this->_enableTrapMutation) {
+		updateDesorptionLeftSideRates(concentrations, gridIndices);
+		selectTrapMutationReactions(gridIndices, surfaceDepths, spacings);
 	}
 }
 
@@ -285,7 +417,22 @@ void
 PSIReactionNetwork<TSpeciesEnum>::updateReactionRates(double time)
 {
 	Superclass::updateReactionRates(time);
+	updateTrapMutationRates();
+}
+
+template <typename TSpeciesEnum>
+void
+PSIReactionNetwork<TSpeciesEnum>::updateReactionRates(
+	Kokkos::View<const IndexType*> gridIndices, double time)
+{
+	Superclass::updateReactionRates(gridIndices, time);
+	updateTrapMutationRates();
+}
 
+template <typename TSpeciesEnum>
+void
+PSIReactionNetwork<TSpeciesEnum>::updateTrapMutationRates()
+{
 	using TrapMutationReactionType =
 		typename Superclass::Traits::TrapMutationReactionType;
 	// TODO: is this just the local largest rate? Is it correct?
@@ -321,20 +468,46 @@ void
 PSIReactionNetwork<TSpeciesEnum>::updateDesorptionLeftSideRate(
 	ConcentrationsView concentrations, IndexType gridIndex)
 {
-	// TODO: Desorption is constant. So make it available on both host and
-	// device. Either DualView or just direct value type that gets copied
+	// The desorption cluster id is kept on the host so only the rate is
+	// copied to the device
+	checkTrapMutationGridSize();
 	auto& tmData = this->_clusterData.h_view().extraData.trapMutationData;
-	auto desorp = create_mirror_view(tmData.desorption);
-	deep_copy(desorp, tmData.desorption);
-	auto lsRate = create_mirror_view(tmData.currentDesorpLeftSideRate);
-	lsRate() = this->getLeftSideRate(concentrations, desorp().id, gridIndex);
-	deep_copy(tmData.currentDesorpLeftSideRate, lsRate);
+	deep_copy(Kokkos::subview(tmData.currentDesorpLeftSideRate, gridIndex),
+		this->getLeftSideRate(concentrations, _desorptionId, gridIndex));
 
 	// NOTE:
 	// Not calling invalidateDataMirror() here because this change should
 	// only matter to reactions on-device
 }
 
+template <typename TSpeciesEnum>
+void
+PSIReactionNetwork<TSpeciesEnum>::updateDesorptionLeftSideRates(
+	ConcentrationsBatchView concentrations, const GridIndicesView& gridIndices)
+{
+	checkTrapMutationGridSize();
+	const auto nRows = static_cast<IndexType>(gridIndices.extent(0));
+	if (_desorpRowRates.extent(0) < nRows) {
+		_desorpRowRates = Kokkos::View<double*>("Desorption Row Rates", nRows);
+	}
+	auto rowRates = _desorpRowRates;
+	auto gridIds = gridIndices.d_view;
+	this->getLeftSideRates(concentrations, _desorptionId, gridIds, rowRates);
+
+	// Scatter the rows to their grid points, which are all distinct here
+	auto& tmData = this->_clusterData.h_view().extraData.trapMutationData;
+	auto rates = tmData.currentDesorpLeftSideRate;
+	const auto invalid = this->invalidIndex();
+	Kokkos::parallel_for(
+		"PSIReactionNetwork::updateDesorptionLeftSideRates", nRows,
+		KOKKOS_LAMBDA(const IndexType b) {
+			if (gridIds(b) != invalid) {
+				rates(gridIds(b)) = rowRates(b);
+			}
+		});
+	Kokkos::fence();
+}
+
 template <typename TSpeciesEnum>
 double
 PSIReactionNetwork<TSpeciesEnum>::checkLatticeParameter(double latticeParameter)
@@ -21,6 +21,7 @@ Reaction<TNetwork, TDerived>::Reaction(ReactionDataRef reactionData,
 	_clusterData(&clusterData),
 	_reactionId(reactionId),
 	_rate(reactionData.getRates(reactionId)),
+	_rateConstants(reactionData.getRateConstants(reactionId)),
 	_widths(reactionData.getWidths(reactionId)),
 	_coefs(reactionData.getCoefficients(reactionId))
 {
@@ -34,6 +35,7 @@ Reaction<TNetwork, TDerived>::updateData(
 {
 	_clusterData = &clusterData;
 	_rate = reactionData.getRates(_reactionId);
+	_rateConstants = reactionData.getRateConstants(_reactionId);
 }
 
 template <typename TNetwork, typename TDerived>
@@ -675,6 +677,17 @@ KOKKOS_INLINE_FUNCTION
 void
 ProductionReaction<TNetwork, TDerived>::computeFlux(
 	ConcentrationsView concentrations, FluxesView fluxes, IndexType gridIndex)
+{
+	detail::AtomicFluxAccumulator acc{fluxes};
+	accumulateFlux(concentrations, acc, gridIndex);
+}
+
+template <typename TNetwork, typename TDerived>
+template <typename TAccumulator>
+KOKKOS_INLINE_FUNCTION
+void
+ProductionReaction<TNetwork, TDerived>::accumulateFlux(
+	ConcentrationsView concentrations, TAccumulator& acc, IndexType gridIndex)
 {
 	constexpr auto speciesRangeNoI = NetworkType::getSpeciesRangeNoI();
 
@@ -709,15 +722,15 @@ ProductionReaction<TNetwork, TDerived>::computeFlux(
 	}
 	f *= this->_rate(gridIndex);
 
-	Kokkos::atomic_sub(&fluxes[_reactants[0]], f / _reactantVolumes[0]);
-	Kokkos::atomic_sub(&fluxes[_reactants[1]], f / _reactantVolumes[1]);
+	acc(_reactants[0], -f / _reactantVolumes[0]);
+	acc(_reactants[1], -f / _reactantVolumes[1]);
 
 	IndexType p = 0;
 	for (auto prodId : _products) {
 		if (prodId == invalidIndex) {
 			continue;
 		}
-		Kokkos::atomic_add(&fluxes[prodId], f / _productVolumes[p]);
+		acc(prodId, f / _productVolumes[p]);
 		p++;
 	}
 
@@ -735,8 +748,7 @@ ProductionReaction<TNetwork, TDerived>::computeFlux(
 				}
 			}
 			f *= this->_rate(gridIndex);
-			Kokkos::atomic_sub(
-				&fluxes[_reactantMomentIds[0][k()]], f / _reactantVolumes[0]);
+			acc(_reactantMomentIds[0][k()], -f / _reactantVolumes[0]);
 		}
 
 		// For the second reactant
@@ -751,8 +763,7 @@ ProductionReaction<TNetwork, TDerived>::computeFlux(
 				}
 			}
 			f *= this->_rate(gridIndex);
-			Kokkos::atomic_sub(
-				&fluxes[_reactantMomentIds[1][k()]], f / _reactantVolumes[1]);
+			acc(_reactantMomentIds[1][k()], -f / _reactantVolumes[1]);
 		}
 
 		// For the products
@@ -775,8 +786,7 @@ ProductionReaction<TNetwork, TDerived>::computeFlux(
 					}
 				}
 				f *= this->_rate(gridIndex);
-				Kokkos::atomic_add(
-					&fluxes[_productMomentIds[p][k()]], f / _productVolumes[p]);
+				acc(_productMomentIds[p][k()], f / _productVolumes[p]);
 			}
 		}
 	}
@@ -1834,6 +1844,20 @@ ProductionReaction<TNetwork, TDerived>::computeLeftSideRate(
 	return 0.0;
 }
 
+template <typename TNetwork, typename TDerived>
+template <typename TRecorder>
+KOKKOS_INLINE_FUNCTION
+void
+ProductionReaction<TNetwork, TDerived>::mapLeftSideClusters(
+	TRecorder& recorder)
+{
+	// Same cases as computeLeftSideRate()
+	recorder(_reactants[0]);
+	if (_reactants[1] != _reactants[0]) {
+		recorder(_reactants[1]);
+	}
+}
+
 template <typename TNetwork, typename TDerived>
 KOKKOS_INLINE_FUNCTION
 void
@@ -2092,6 +2116,15 @@ DissociationReaction<TNetwork, TDerived>::computeCoefficients()
 	}
 }
 
+template <typename TNetwork, typename TDerived>
+KOKKOS_INLINE_FUNCTION
+void
+DissociationReaction<TNetwork, TDerived>::computeRateConstants()
+{
+	this->_rateConstants(bindingEnergyIndex) =
+		this->asDerived()->computeBindingEnergy();
+}
+
 template <typename TNetwork, typename TDerived>
 KOKKOS_INLINE_FUNCTION
 double
@@ -2102,7 +2135,7 @@ DissociationReaction<TNetwork, TDerived>::computeRate(
 	double T = this->_clusterData->temperature(gridIndex);
 
 	double kPlus = this->asDerived()->getRateForProduction(gridIndex);
-	double E_b = this->asDerived()->computeBindingEnergy(time);
+	double E_b = this->_rateConstants(bindingEnergyIndex);
 
 	constexpr double k_B = ::xolotl::core::kBoltzmann;
 
@@ -2233,6 +2266,17 @@ KOKKOS_INLINE_FUNCTION
 void
 DissociationReaction<TNetwork, TDerived>::computeFlux(
 	ConcentrationsView concentrations, FluxesView fluxes, IndexType gridIndex)
+{
+	detail::AtomicFluxAccumulator acc{fluxes};
+	accumulateFlux(concentrations, acc, gridIndex);
+}
+
+template <typename TNetwork, typename TDerived>
+template <typename TAccumulator>
+KOKKOS_INLINE_FUNCTION
+void
+DissociationReaction<TNetwork, TDerived>::accumulateFlux(
+	ConcentrationsView concentrations, TAccumulator& acc, IndexType gridIndex)
 {
 	constexpr auto speciesRangeNoI = NetworkType::getSpeciesRangeNoI();
 
@@ -2253,9 +2297,9 @@ DissociationReaction<TNetwork, TDerived>::computeFlux(
 		f += this->_coefs(i() + 1, 0, 0, 0) * cmR[i()];
 	}
 	f *= this->_rate(gridIndex);
-	Kokkos::atomic_sub(&fluxes[_reactant], f / _reactantVolume);
-	Kokkos::atomic_add(&fluxes[_products[0]], f / _productVolumes[0]);
-	Kokkos::atomic_add(&fluxes[_products[1]], f / _productVolumes[1]);
+	acc(_reactant, -f / _reactantVolume);
+	acc(_products[0], f / _productVolumes[0]);
+	acc(_products[1], f / _productVolumes[1]);
 
 	// Take care of the first moments
 	for (auto k : speciesRangeNoI) {
@@ -2266,8 +2310,7 @@ DissociationReaction<TNetwork, TDerived>::computeFlux(
 				f += this->_coefs(i() + 1, 0, 0, k() + 1) * cmR[i()];
 			}
 			f *= this->_rate(gridIndex);
-			Kokkos::atomic_sub(
-				&fluxes[_reactantMomentIds[k()]], f / _reactantVolume);
+			acc(_reactantMomentIds[k()], -f / _reactantVolume);
 		}
 
 		// Now the first product
@@ -2277,8 +2320,7 @@ DissociationReaction<TNetwork, TDerived>::computeFlux(
 				f += this->_coefs(i() + 1, 0, 1, k() + 1) * cmR[i()];
 			}
 			f *= this->_rate(gridIndex);
-			Kokkos::atomic_add(
-				&fluxes[_productMomentIds[0][k()]], f / _productVolumes[0]);
+			acc(_productMomentIds[0][k()], f / _productVolumes[0]);
 		}
 
 		// Finally the second product
@@ -2288,8 +2330,7 @@ DissociationReaction<TNetwork, TDerived>::computeFlux(
 				f += this->_coefs(i() + 1, 0, 2, k() + 1) * cmR[i()];
 			}
 			f *= this->_rate(gridIndex);
-			Kokkos::atomic_add(
-				&fluxes[_productMomentIds[1][k()]], f / _productVolumes[1]);
+			acc(_productMomentIds[1][k()], f / _productVolumes[1]);
 		}
 	}
 }
@@ -2756,6 +2797,16 @@ DissociationReaction<TNetwork, TDerived>::computeLeftSideRate(
 	return 0.0;
 }
 
+template <typename TNetwork, typename TDerived>
+template <typename TRecorder>
+KOKKOS_INLINE_FUNCTION
+void
+DissociationReaction<TNetwork, TDerived>::mapLeftSideClusters(
+	TRecorder& recorder)
+{
+	recorder(_reactant);
+}
+
 template <typename TNetwork, typename TDerived>
 KOKKOS_INLINE_FUNCTION
 void
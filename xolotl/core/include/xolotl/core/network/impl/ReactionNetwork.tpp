@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include <xolotl/core/Constants.h>
 #include <xolotl/core/network/detail/ReactionGenerator.h>
 #include <xolotl/core/network/detail/TupleUtility.h>
@@ -62,6 +64,11 @@ ReactionNetwork<TImpl>::ReactionNetwork(const Subpaving& subpaving,
 		}
 	}
 	this->setEnableReducedJacobian(useReduced);
+	_shareRatesByTemperature = (opts.getRateStorage() == "temperature");
+	_dispatchReactionsByType = (opts.getReactionDispatch() == "type");
+	_gatherFluxes = (opts.getFluxAccumulation() == "gather");
+	_networkCacheDirectory = opts.getNetworkCache();
+	_networkCacheName = opts.getMaterial();
 
 	this->_numClusters = _clusterData.h_view().numClusters;
 	asDerived()->initializeExtraClusterData(opts);
@@ -75,6 +82,17 @@ ReactionNetwork<TImpl>::ReactionNetwork(const Subpaving& subpaving,
 	Connectivity connectivity;
 	defineReactions(connectivity);
 	generateDiagonalFill(connectivity);
+
+	if (_gatherFluxes) {
+		_worker.defineFluxGatherMap();
+	}
+
+	auto rateTable = opts.getRateTable();
+	if (!rateTable.empty()) {
+		_rateTableLattice = detail::TemperatureLattice(
+			rateTable[0], rateTable[1], rateTable[2]);
+		buildRateTables();
+	}
 }
 
 template <typename TImpl>
@@ -156,7 +174,7 @@ ReactionNetwork<TImpl>::setLatticeParameter(double latticeParameter)
 	this->_atomicVolume = asDerived()->computeAtomicVolume(lParam);
 	_clusterData.h_view().setAtomicVolume(this->_atomicVolume);
 
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -165,7 +183,7 @@ ReactionNetwork<TImpl>::setFissionRate(double rate)
 {
 	Superclass::setFissionRate(rate);
 	_clusterData.h_view().setFissionRate(this->_fissionRate);
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -173,7 +191,7 @@ void
 ReactionNetwork<TImpl>::setZeta(double z)
 {
 	_clusterData.h_view().setZeta(z);
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -182,7 +200,7 @@ ReactionNetwork<TImpl>::setEnableStdReaction(bool reaction)
 {
 	Superclass::setEnableStdReaction(reaction);
 	_clusterData.h_view().setEnableStdReaction(this->_enableStdReaction);
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -191,7 +209,7 @@ ReactionNetwork<TImpl>::setEnableReSolution(bool reaction)
 {
 	Superclass::setEnableReSolution(reaction);
 	_clusterData.h_view().setEnableReSolution(this->_enableReSolution);
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -200,7 +218,7 @@ ReactionNetwork<TImpl>::setEnableNucleation(bool reaction)
 {
 	Superclass::setEnableNucleation(reaction);
 	_clusterData.h_view().setEnableNucleation(this->_enableNucleation);
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -209,7 +227,7 @@ ReactionNetwork<TImpl>::setEnableSink(bool reaction)
 {
 	this->_enableSink = reaction;
 	_clusterData.h_view().setEnableSink(this->_enableSink);
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -218,7 +236,7 @@ ReactionNetwork<TImpl>::setEnableTrapMutation(bool reaction)
 {
 	Superclass::setEnableTrapMutation(reaction);
 	_clusterData.h_view().setEnableTrapMutation(this->_enableTrapMutation);
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -228,6 +246,7 @@ ReactionNetwork<TImpl>::setEnableConstantReaction(bool reaction)
 	this->_enableConstantReaction = reaction;
 	_clusterData.h_view().setEnableConstantReaction(
 		this->_enableConstantReaction);
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_PARAMETERS);
 }
 
 template <typename TImpl>
@@ -247,6 +266,9 @@ ReactionNetwork<TImpl>::setGridSize(IndexType gridSize)
 		_clusterDataMirror.value().setGridSize(gridSize);
 	}
 	_clusterData.h_view().setGridSize(gridSize);
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_TEMPERATURE |
+		detail::CLUSTER_DATA_DIFFUSION_COEFFICIENT);
+	++_diffusionCoefficientsVersion;
 	copyClusterDataView();
 	_reactions.setGridSize(gridSize);
 	_reactions.updateAll(_clusterData.d_view);
@@ -262,13 +284,123 @@ ReactionNetwork<TImpl>::setTemperatures(
 		tempsHost(gridTemps.data(), this->_gridSize);
 	Kokkos::deep_copy(_clusterData.h_view().temperature, tempsHost);
 
+	if (_shareRatesByTemperature) {
+		updateRateSlots(gridTemps);
+	}
+
 	updateDiffusionCoefficients();
 
 	asDerived()->updateExtraClusterData(gridTemps, gridDepths);
 
 	asDerived()->updateReactionRates(_currentTime);
 
-	invalidateDataMirror();
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_TEMPERATURE);
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::setTemperatures(const std::vector<double>& gridTemps,
+	const std::vector<double>& gridDepths,
+	const std::vector<IndexType>& changedGridIndices)
+{
+	// Shared rate slots may have to be regrouped, update everything
+	if (_shareRatesByTemperature) {
+		setTemperatures(gridTemps, gridDepths);
+		return;
+	}
+
+	if (changedGridIndices.empty()) {
+		return;
+	}
+
+	Kokkos::View<const double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+		tempsHost(gridTemps.data(), this->_gridSize);
+	Kokkos::deep_copy(_clusterData.h_view().temperature, tempsHost);
+
+	Kokkos::View<const IndexType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+		idsHost(changedGridIndices.data(), changedGridIndices.size());
+	auto gridIndices =
+		Kokkos::View<IndexType*>("Changed Grid Indices", idsHost.size());
+	Kokkos::deep_copy(gridIndices, idsHost);
+
+	updateDiffusionCoefficients(gridIndices);
+
+	asDerived()->updateExtraClusterData(gridTemps, gridDepths);
+
+	asDerived()->updateReactionRates(gridIndices, _currentTime);
+
+	invalidateDataMirrorFields(detail::CLUSTER_DATA_TEMPERATURE);
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::updateRateSlots(const std::vector<double>& gridTemps)
+{
+	std::vector<IndexType> gridToSlot(this->_gridSize);
+	std::vector<IndexType> slotToGrid;
+	std::unordered_map<double, IndexType> tempSlots;
+	for (IndexType i = 0; i < this->_gridSize; ++i) {
+		auto [it, inserted] =
+			tempSlots.try_emplace(gridTemps[i], slotToGrid.size());
+		if (inserted) {
+			slotToGrid.push_back(i);
+		}
+		gridToSlot[i] = it->second;
+	}
+
+	// The reactions keep unmanaged copies of the views
+	if (_reactions.setRateSlots(gridToSlot, slotToGrid)) {
+		_reactions.updateAll(_clusterData.d_view);
+		Kokkos::fence();
+	}
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::buildRateTables()
+{
+	// Other cluster updaters may depend on more than the temperature
+	if constexpr (!std::is_same_v<ClusterUpdater,
+					  detail::DefaultClusterUpdater<TImpl>>) {
+		XOLOTL_LOG_WARN << "ReactionNetwork: The rate table is not available "
+						   "for this network, the rates are always computed";
+		_rateTableLattice = detail::TemperatureLattice{};
+		return;
+	}
+
+	// Cluster data with one grid point per lattice temperature
+	auto lattice = _rateTableLattice;
+	auto latticeData = _clusterData.h_view();
+	latticeData.setGridSize(lattice.size);
+	auto temps = latticeData.temperature;
+	Kokkos::parallel_for(
+		"ReactionNetwork::buildRateTables", lattice.size,
+		KOKKOS_LAMBDA(IndexType k) { temps(k) = lattice.getTemperature(k); });
+	Kokkos::View<ClusterData> latticeView("Lattice Cluster Data");
+	auto latticeMirror = create_mirror_view(latticeView);
+	latticeMirror() = latticeData;
+	deep_copy(latticeView, latticeMirror);
+
+	using Range2D = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
+	auto updater = ClusterUpdater{};
+	Kokkos::parallel_for(
+		"ReactionNetwork::buildRateTables",
+		Range2D({0, 0}, {latticeData.numClusters, lattice.size}),
+		KOKKOS_LAMBDA(IndexType i, IndexType k) {
+			if (!util::equal(latticeView().diffusionFactor(i), 0.0)) {
+				updater.updateDiffusionCoefficient(latticeView(), i, k);
+			}
+		});
+	Kokkos::fence();
+	_diffusionTable = latticeData.diffusionCoefficient;
+
+	// The reactions point to the lattice data while they are tabulated
+	_rateTable = Kokkos::View<double**>(
+		"Rate Table", _reactions.getNumberOfReactions(), lattice.size);
+	_reactions.updateAll(latticeView);
+	_reactions.tabulateRates(_rateTable);
+	_reactions.updateAll(_clusterData.d_view);
+	Kokkos::fence();
 }
 
 template <typename TImpl>
@@ -276,18 +408,35 @@ void
 ReactionNetwork<TImpl>::setTime(double time)
 {
 	_currentTime = time;
-	asDerived()->updateReactionRates(time);
 
-	invalidateDataMirror();
+	// Only the reaction rates change, the cluster data mirror stays valid
+	asDerived()->updateReactionRates(time);
 }
 
 template <typename TImpl>
 void
 ReactionNetwork<TImpl>::updateReactionRates(double time)
 {
+	if (_rateTableLattice.isEnabled()) {
+		_reactions.updateRates(_rateTableLattice, _rateTable, time);
+		return;
+	}
 	_reactions.updateRates(time);
 }
 
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::updateReactionRates(
+	Kokkos::View<const IndexType*> gridIndices, double time)
+{
+	if (_rateTableLattice.isEnabled()) {
+		_reactions.updateRates(
+			gridIndices, _rateTableLattice, _rateTable, time);
+		return;
+	}
+	_reactions.updateRates(gridIndices, time);
+}
+
 template <typename TImpl>
 std::uint64_t
 ReactionNetwork<TImpl>::getDeviceMemorySize() const noexcept
@@ -296,6 +445,12 @@ ReactionNetwork<TImpl>::getDeviceMemorySize() const noexcept
 
 	ret += _clusterData.h_view().getDeviceMemorySize();
 	ret += _reactions.getDeviceMemorySize();
+	ret += _fluxGatherMap.getDeviceMemorySize();
+	ret += _leftSideReactionMap.getDeviceMemorySize();
+	ret += _diffusionTable.required_allocation_size(
+		_diffusionTable.extent(0), _diffusionTable.extent(1));
+	ret += _rateTable.required_allocation_size(
+		_rateTable.extent(0), _rateTable.extent(1));
 
 	return ret;
 }
@@ -307,11 +462,11 @@ ReactionNetwork<TImpl>::syncClusterDataOnHost()
 	BOOST_LOG_FUNCTION();
 	XOLOTL_LOG_XTRA;
 
-	_subpavingMirror = _subpaving.makeMirrorCopy();
-
+	getSubpavingMirror();
 	auto dataMirror = ClusterDataMirror(*_subpavingMirror, this->_gridSize);
 	dataMirror.deepCopy(_clusterData.h_view());
 	_clusterDataMirror = dataMirror;
+	_staleMirrorFields = 0;
 }
 
 template <typename TImpl>
@@ -520,6 +675,44 @@ void
 ReactionNetwork<TImpl>::updateDiffusionCoefficients()
 {
 	_worker.updateDiffusionCoefficients();
+	++_diffusionCoefficientsVersion;
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::updateDiffusionCoefficients(
+	Kokkos::View<const IndexType*> gridIndices)
+{
+	_worker.updateDiffusionCoefficients(gridIndices);
+	++_diffusionCoefficientsVersion;
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::getDiffusionCoefficients(
+	const std::vector<IdType>& clusterIds, std::vector<double>& coefs)
+{
+	auto hCoefs = Kokkos::create_mirror_view_and_copy(
+		Kokkos::HostSpace{}, _clusterData.h_view().diffusionCoefficient);
+	const auto gridSize = this->_gridSize;
+	coefs.resize(clusterIds.size() * gridSize);
+	for (std::size_t i = 0; i < clusterIds.size(); ++i) {
+		for (IndexType j = 0; j < gridSize; ++j) {
+			coefs[i * gridSize + j] = hCoefs(clusterIds[i], j);
+		}
+	}
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::getTemperatures(std::vector<double>& temperatures)
+{
+	auto hTemps = Kokkos::create_mirror_view_and_copy(
+		Kokkos::HostSpace{}, _clusterData.h_view().temperature);
+	temperatures.resize(this->_gridSize);
+	for (IndexType j = 0; j < this->_gridSize; ++j) {
+		temperatures[j] = hTemps(j);
+	}
 }
 
 template <typename TImpl>
@@ -539,6 +732,21 @@ ReactionNetwork<TImpl>::computeAllFluxes(ConcentrationsView concentrations,
 	asDerived()->computeFluxesPreProcess(
 		concentrations, fluxes, gridIndex, surfaceDepth, spacing);
 
+	if (_fluxGatherMap.isInitialized()) {
+		growFluxSlotBuffer(1);
+		auto buffer = Kokkos::subview(_fluxSlotBuffer, 0, Kokkos::ALL);
+		auto slotOffsets = _fluxGatherMap.slotOffsets;
+		_reactions.forEach("ReactionNetwork::computeAllFluxes",
+			DEVICE_LAMBDA(auto&& reaction) {
+				reaction.contributeFlux(concentrations, fluxes, buffer,
+					slotOffsets(reaction.getId()), gridIndex);
+			});
+		Kokkos::fence();
+		gatherFluxes(FluxesBatchView(fluxes.data(), 1, fluxes.extent(0)),
+			Kokkos::View<const IndexType*>(), 0, 1);
+		return;
+	}
+
 	_reactions.forEach(
 		"ReactionNetwork::computeAllFluxes", DEVICE_LAMBDA(auto&& reaction) {
 			reaction.contributeFlux(concentrations, fluxes, gridIndex);
@@ -546,6 +754,127 @@ ReactionNetwork<TImpl>::computeAllFluxes(ConcentrationsView concentrations,
 	Kokkos::fence();
 }
 
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::computeAllFluxes(
+	ConcentrationsBatchView concentrations, FluxesBatchView fluxes,
+	const GridIndicesView& gridIndices,
+	const std::vector<double>& surfaceDepths,
+	const std::vector<double>& spacings)
+{
+	const auto nRows = static_cast<IndexType>(gridIndices.extent(0));
+	assert(concentrations.extent(0) >= nRows);
+	assert(fluxes.extent(0) >= nRows);
+	const auto invalid = this->invalidIndex();
+
+	if (asDerived()->requiresPointwisePreProcess(gridIndices)) {
+		// The preprocessing depends on the grid point, loop on the host
+		auto hIds = gridIndices.h_view;
+		for (IndexType b = 0; b < nRows; ++b) {
+			if (hIds(b) == invalid) {
+				continue;
+			}
+			computeAllFluxes(Kokkos::subview(concentrations, b, Kokkos::ALL),
+				Kokkos::subview(fluxes, b, Kokkos::ALL), hIds(b),
+				surfaceDepths[b], spacings[b]);
+		}
+		return;
+	}
+
+	asDerived()->computeFluxesBatchPreProcess(
+		concentrations, gridIndices, surfaceDepths, spacings);
+
+	auto gridIds = gridIndices.d_view;
+	if (_fluxGatherMap.isInitialized()) {
+		// The slot buffer holds one row of slots per grid point, process
+		// as many rows at a time as fit in its budget
+		const auto chunkRows = std::min(nRows, getMaxFluxSlotRows());
+		growFluxSlotBuffer(chunkRows);
+		auto buffer = _fluxSlotBuffer;
+		auto slotOffsets = _fluxGatherMap.slotOffsets;
+		for (IndexType begin = 0; begin < nRows; begin += chunkRows) {
+			const auto n = std::min(chunkRows, nRows - begin);
+			_reactions.forEachBatch("ReactionNetwork::computeAllFluxesBatch",
+				n, DEVICE_LAMBDA(auto&& reaction, IndexType b) {
+					const auto row = begin + b;
+					if (gridIds(row) == invalid) {
+						return;
+					}
+					reaction.contributeFlux(
+						Kokkos::subview(concentrations, row, Kokkos::ALL),
+						Kokkos::subview(fluxes, row, Kokkos::ALL),
+						Kokkos::subview(buffer, b, Kokkos::ALL),
+						slotOffsets(reaction.getId()), gridIds(row));
+				});
+			Kokkos::fence();
+			gatherFluxes(fluxes, gridIds, begin, n);
+		}
+		return;
+	}
+
+	_reactions.forEachBatch("ReactionNetwork::computeAllFluxesBatch", nRows,
+		DEVICE_LAMBDA(auto&& reaction, IndexType b) {
+			if (gridIds(b) == invalid) {
+				return;
+			}
+			reaction.contributeFlux(
+				Kokkos::subview(concentrations, b, Kokkos::ALL),
+				Kokkos::subview(fluxes, b, Kokkos::ALL), gridIds(b));
+		});
+	Kokkos::fence();
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::gatherFluxes(FluxesBatchView fluxes,
+	Kokkos::View<const IndexType*> gridIndices, IndexType rowBegin,
+	IndexType nRows)
+{
+	using Range2D = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
+	auto buffer = _fluxSlotBuffer;
+	auto rowMap = _fluxGatherMap.rowMap;
+	auto slots = _fluxGatherMap.slots;
+	const auto nClusters = static_cast<IndexType>(rowMap.extent(0) - 1);
+	const bool checkIds = gridIndices.extent(0) > 0;
+	const auto invalid = this->invalidIndex();
+	// One thread per row and cluster, no atomics needed
+	Kokkos::parallel_for("ReactionNetwork::gatherFluxes",
+		Range2D({0, 0}, {nRows, nClusters}),
+		KOKKOS_LAMBDA(const IndexType b, const IndexType i) {
+			const auto row = rowBegin + b;
+			if (checkIds && gridIndices(row) == invalid) {
+				return;
+			}
+			double f = 0.0;
+			for (IndexType k = rowMap(i); k < rowMap(i + 1); ++k) {
+				f += buffer(b, slots(k));
+			}
+			fluxes(row, i) += f;
+		});
+	Kokkos::fence();
+}
+
+template <typename TImpl>
+typename ReactionNetwork<TImpl>::IndexType
+ReactionNetwork<TImpl>::getMaxFluxSlotRows() const
+{
+	const auto rowSize = std::max<std::uint64_t>(
+		_fluxGatherMap.getNumberOfSlots() * sizeof(double), 1);
+	return static_cast<IndexType>(
+		std::max<std::uint64_t>(maxFluxSlotBufferSize / rowSize, 1));
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::growFluxSlotBuffer(IndexType nRows)
+{
+	if (_fluxSlotBuffer.extent(0) < nRows) {
+		_fluxSlotBuffer = Kokkos::View<double**, Kokkos::LayoutRight>(
+			Kokkos::ViewAllocateWithoutInitializing("Flux Slot Buffer"), nRows,
+			_fluxGatherMap.getNumberOfSlots());
+	}
+}
+
 template <typename TImpl>
 void
 ReactionNetwork<TImpl>::computeAllPartials(ConcentrationsView concentrations,
@@ -581,6 +910,66 @@ ReactionNetwork<TImpl>::computeAllPartials(ConcentrationsView concentrations,
 	Kokkos::fence();
 }
 
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::computeAllPartials(
+	ConcentrationsBatchView concentrations, PartialsBatchView values,
+	const GridIndicesView& gridIndices,
+	const std::vector<double>& surfaceDepths,
+	const std::vector<double>& spacings)
+{
+	const auto nRows = static_cast<IndexType>(gridIndices.extent(0));
+	assert(concentrations.extent(0) >= nRows);
+	assert(values.extent(0) >= nRows);
+	const auto invalid = this->invalidIndex();
+
+	// Reset the values
+	Kokkos::deep_copy(values, 0.0);
+
+	if (asDerived()->requiresPointwisePreProcess(gridIndices)) {
+		// The preprocessing depends on the grid point, loop on the host
+		auto hIds = gridIndices.h_view;
+		for (IndexType b = 0; b < nRows; ++b) {
+			if (hIds(b) == invalid) {
+				continue;
+			}
+			computeAllPartials(Kokkos::subview(concentrations, b, Kokkos::ALL),
+				Kokkos::subview(values, b, Kokkos::ALL), hIds(b),
+				surfaceDepths[b], spacings[b]);
+		}
+		return;
+	}
+
+	asDerived()->computePartialsBatchPreProcess(
+		concentrations, gridIndices, surfaceDepths, spacings);
+
+	auto gridIds = gridIndices.d_view;
+	if (this->_enableReducedJacobian) {
+		_reactions.forEachBatch("ReactionNetwork::computeAllPartialsBatch",
+			nRows, DEVICE_LAMBDA(auto&& reaction, IndexType b) {
+				if (gridIds(b) == invalid) {
+					return;
+				}
+				reaction.contributeReducedPartialDerivatives(
+					Kokkos::subview(concentrations, b, Kokkos::ALL),
+					Kokkos::subview(values, b, Kokkos::ALL), gridIds(b));
+			});
+	}
+	else {
+		_reactions.forEachBatch("ReactionNetwork::computeAllPartialsBatch",
+			nRows, DEVICE_LAMBDA(auto&& reaction, IndexType b) {
+				if (gridIds(b) == invalid) {
+					return;
+				}
+				reaction.contributePartialDerivatives(
+					Kokkos::subview(concentrations, b, Kokkos::ALL),
+					Kokkos::subview(values, b, Kokkos::ALL), gridIds(b));
+			});
+	}
+
+	Kokkos::fence();
+}
+
 template <typename TImpl>
 void
 ReactionNetwork<TImpl>::computeConstantRates(ConcentrationsView concentrations,
@@ -625,11 +1014,15 @@ double
 ReactionNetwork<TImpl>::getLeftSideRate(
 	ConcentrationsView concentrations, IndexType clusterId, IndexType gridIndex)
 {
-	// Get the extent of the reactions
+	// Only visit the reactions having the cluster on their left side
+	const auto& map = _leftSideReactionMap;
+	if (!map.isInitialized() || clusterId >= this->_numClusters) {
+		return 0.0;
+	}
 	double leftSideRate = 0.0;
-	// Loop on all the rates to get the maximum
-	_reactions.reduce(
-		"ReactionNetwork::getLeftSideRate",
+	_reactions.reduceOver(
+		"ReactionNetwork::getLeftSideRate", map.reactionIds,
+		map.hRowMap(clusterId), map.hRowMap(clusterId + 1),
 		DEVICE_LAMBDA(auto&& reaction, double& lsum) {
 			lsum += reaction.contributeLeftSideRate(
 				concentrations, clusterId, gridIndex);
@@ -639,6 +1032,34 @@ ReactionNetwork<TImpl>::getLeftSideRate(
 	return leftSideRate;
 }
 
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::getLeftSideRates(
+	ConcentrationsBatchView concentrations, IndexType clusterId,
+	Kokkos::View<const IndexType*> gridIndices, Kokkos::View<double*> rates)
+{
+	const auto nRows = static_cast<IndexType>(gridIndices.extent(0));
+	const auto& map = _leftSideReactionMap;
+	if (!map.isInitialized() || clusterId >= this->_numClusters) {
+		Kokkos::deep_copy(rates, 0.0);
+		return;
+	}
+	const auto invalid = this->invalidIndex();
+	_reactions.reduceOverBatch("ReactionNetwork::getLeftSideRates",
+		map.reactionIds, map.hRowMap(clusterId), map.hRowMap(clusterId + 1),
+		nRows,
+		DEVICE_LAMBDA(auto&& reaction, IndexType b, double& lsum) {
+			if (gridIndices(b) == invalid) {
+				return;
+			}
+			lsum += reaction.contributeLeftSideRate(
+				Kokkos::subview(concentrations, b, Kokkos::ALL), clusterId,
+				gridIndices(b));
+		},
+		rates);
+	Kokkos::fence();
+}
+
 template <typename TReactionNetwork, typename TDerived>
 struct TQMethodBase
 {
@@ -1437,6 +1858,8 @@ ReactionNetworkWorker<TImpl>::updateDiffusionCoefficients()
 	using Range2D = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
 	auto clusterData = _nw._clusterData.d_view;
 	auto updater = typename Network::ClusterUpdater{};
+	auto lattice = _nw._rateTableLattice;
+	auto table = _nw._diffusionTable;
 	Kokkos::parallel_for(
 		"ReactionNetworkWorker::updateDiffusionCoefficients",
 		Range2D({0, 0},
@@ -1444,11 +1867,49 @@ ReactionNetworkWorker<TImpl>::updateDiffusionCoefficients()
 				_nw._clusterData.h_view().gridSize}),
 		KOKKOS_LAMBDA(IndexType i, IndexType j) {
 			if (!util::equal(clusterData().diffusionFactor(i), 0.0)) {
-				updater.updateDiffusionCoefficient(clusterData(), i, j);
+				double temp = clusterData().temperature(j);
+				if (lattice.isEnabled() && lattice.contains(temp)) {
+					clusterData().diffusionCoefficient(i, j) =
+						lattice.interpolate(table, i, temp);
+				}
+				else {
+					updater.updateDiffusionCoefficient(clusterData(), i, j);
+				}
 			}
 		});
 	Kokkos::fence();
-	_nw.invalidateDataMirror();
+	_nw.invalidateDataMirrorFields(detail::CLUSTER_DATA_DIFFUSION_COEFFICIENT);
+}
+
+template <typename TImpl>
+void
+ReactionNetworkWorker<TImpl>::updateDiffusionCoefficients(
+	Kokkos::View<const IndexType*> gridIndices)
+{
+	using Range2D = Kokkos::MDRangePolicy<Kokkos::Rank<2>>;
+	auto clusterData = _nw._clusterData.d_view;
+	auto updater = typename Network::ClusterUpdater{};
+	auto lattice = _nw._rateTableLattice;
+	auto table = _nw._diffusionTable;
+	Kokkos::parallel_for(
+		"ReactionNetworkWorker::updateDiffusionCoefficients",
+		Range2D({0, 0},
+			{_nw._clusterData.h_view().numClusters, gridIndices.size()}),
+		KOKKOS_LAMBDA(IndexType i, IndexType b) {
+			if (!util::equal(clusterData().diffusionFactor(i), 0.0)) {
+				auto j = gridIndices(b);
+				double temp = clusterData().temperature(j);
+				if (lattice.isEnabled() && lattice.contains(temp)) {
+					clusterData().diffusionCoefficient(i, j) =
+						lattice.interpolate(table, i, temp);
+				}
+				else {
+					updater.updateDiffusionCoefficient(clusterData(), i, j);
+				}
+			}
+		});
+	Kokkos::fence();
+	_nw.invalidateDataMirrorFields(detail::CLUSTER_DATA_DIFFUSION_COEFFICIENT);
 }
 
 template <typename TImpl>
@@ -1522,10 +1983,189 @@ template <typename TImpl>
 void
 ReactionNetworkWorker<TImpl>::defineReactions(Connectivity& connectivity)
 {
-	auto generator = _nw.asDerived()->getReactionGenerator();
-	generator.setConstantConnectivities(_nw._constantConns);
-	_nw._reactions = generator.generateReactions();
-	connectivity = generator.getConnectivity();
+	// Constant reactions are given at runtime so they are never cached
+	bool useCache = !_nw._networkCacheDirectory.empty() &&
+		_nw._constantConns.extent(0) == 0;
+	std::optional<NetworkCache> cache;
+	if (useCache) {
+		cache.emplace(_nw._networkCacheDirectory, getNetworkCacheName(),
+			getNetworkCacheKey());
+	}
+
+	if (!cache || !readReactions(*cache, connectivity)) {
+		auto generator = _nw.asDerived()->getReactionGenerator();
+		generator.setConstantConnectivities(_nw._constantConns);
+		_nw._reactions = generator.generateReactions();
+		connectivity = generator.getConnectivity();
+		if (cache) {
+			cache->write(_nw._reactions.getNumberOfReactionsByType(),
+				generator.getClusterSets(), connectivity);
+		}
+	}
+	_nw._reactions.setDispatchByType(_nw._dispatchReactionsByType);
+
+	defineLeftSideReactionMap();
+}
+
+template <typename TImpl>
+bool
+ReactionNetworkWorker<TImpl>::readReactions(
+	const NetworkCache& cache, Connectivity& connectivity)
+{
+	std::vector<IndexType> counts(
+		std::tuple_size_v<typename ReactionCollection::ReactionTypes>);
+	typename NetworkCache::ClusterSetView clusterSets;
+	Connectivity conn;
+	if (!cache.read(counts, clusterSets, conn)) {
+		return false;
+	}
+
+	_nw._reactions =
+		ReactionCollection::allocate(_nw._clusterData.h_view().gridSize, counts);
+	_nw._reactions.constructAll(_nw._clusterData.d_view, clusterSets);
+	Kokkos::fence();
+	_nw._reactions.setConnectivity(conn);
+	connectivity = conn;
+
+	XOLOTL_LOG << "ReactionNetwork: Loaded the reactions from "
+			   << cache.getPath().string();
+
+	return true;
+}
+
+template <typename TImpl>
+std::string
+ReactionNetworkWorker<TImpl>::getNetworkCacheName()
+{
+	// The material and the species, e.g. "W100:He,D,T,V,I"
+	std::string name = _nw._networkCacheName + ":";
+	bool first = true;
+	for (auto s : Network::getSpeciesRange()) {
+		name += (first ? "" : ",") + toLabelString(s);
+		first = false;
+	}
+	return name;
+}
+
+template <typename TImpl>
+std::uint64_t
+ReactionNetworkWorker<TImpl>::getNetworkCacheKey()
+{
+	NetworkCacheKey key;
+	key.add(NetworkCache::formatVersion);
+	key.add(getNetworkCacheName());
+	key.add(_nw._numDOFs);
+	key.add(_nw.getEnableStdReaction());
+	key.add(_nw.getEnableReSolution());
+	key.add(_nw.getEnableNucleation());
+	key.add(_nw.getEnableSink());
+	key.add(_nw.getEnableTrapMutation());
+	key.add(_nw.getEnableReducedJacobian());
+
+	// Composition and mobility of every cluster
+	auto bounds = _nw.getAllClusterBounds();
+	for (const auto& bound : bounds) {
+		key.add(bound.data(), bound.size() * sizeof(AmountType));
+	}
+	auto diffusionFactor = Kokkos::create_mirror_view_and_copy(
+		Kokkos::HostSpace{}, _nw._clusterData.h_view().diffusionFactor);
+	for (IndexType i = 0; i < diffusionFactor.extent(0); ++i) {
+		key.add(diffusionFactor(i) != 0.0);
+	}
+
+	return key.get();
+}
+
+template <typename TImpl>
+void
+ReactionNetworkWorker<TImpl>::defineFluxGatherMap()
+{
+	auto nReactions = _nw._reactions.getNumberOfReactions();
+	auto nDOFs = _nw._numDOFs;
+
+	// Which clusters the flux slots target does not depend on the
+	// concentrations
+	auto concs = Kokkos::View<double*>("Flux Gather Concentrations", nDOFs + 1);
+
+	// Count the slots of each reaction
+	auto slotOffsets =
+		Kokkos::View<IndexType*>("Flux Slot Offsets", nReactions + 1);
+	auto noTargets = Kokkos::View<IndexType*>();
+	_nw._reactions.forEach("ReactionNetworkWorker::defineFluxGatherMap::count",
+		DEVICE_LAMBDA(auto&& reaction) {
+			slotOffsets(reaction.getId()) =
+				reaction.recordFluxTargets(concs, noTargets, 0);
+		});
+	Kokkos::fence();
+
+	IndexType nSlots = 0;
+	Kokkos::parallel_scan("ReactionNetworkWorker::defineFluxGatherMap::scan",
+		nReactions + 1,
+		KOKKOS_LAMBDA(IndexType i, IndexType & update, const bool final) {
+			auto count = slotOffsets(i);
+			if (final) {
+				slotOffsets(i) = update;
+			}
+			update += count;
+		},
+		nSlots);
+
+	// Record the target of each slot
+	auto targets = Kokkos::View<IndexType*>("Flux Slot Targets", nSlots);
+	_nw._reactions.forEach(
+		"ReactionNetworkWorker::defineFluxGatherMap::record",
+		DEVICE_LAMBDA(auto&& reaction) {
+			reaction.recordFluxTargets(
+				concs, targets, slotOffsets(reaction.getId()));
+		});
+	Kokkos::fence();
+
+	_nw._fluxGatherMap = detail::FluxGatherMap(slotOffsets, targets, nDOFs);
+}
+
+template <typename TImpl>
+void
+ReactionNetworkWorker<TImpl>::defineLeftSideReactionMap()
+{
+	auto nReactions = _nw._reactions.getNumberOfReactions();
+
+	// Count the left side clusters of each reaction
+	auto entryOffsets =
+		Kokkos::View<IndexType*>("Left Side Entry Offsets", nReactions + 1);
+	auto noClusters = Kokkos::View<IndexType*>();
+	_nw._reactions.forEach(
+		"ReactionNetworkWorker::defineLeftSideReactionMap::count",
+		DEVICE_LAMBDA(auto&& reaction) {
+			entryOffsets(reaction.getId()) =
+				reaction.recordLeftSideClusters(noClusters, 0);
+		});
+	Kokkos::fence();
+
+	IndexType nEntries = 0;
+	Kokkos::parallel_scan(
+		"ReactionNetworkWorker::defineLeftSideReactionMap::scan",
+		nReactions + 1,
+		KOKKOS_LAMBDA(IndexType i, IndexType & update, const bool final) {
+			auto count = entryOffsets(i);
+			if (final) {
+				entryOffsets(i) = update;
+			}
+			update += count;
+		},
+		nEntries);
+
+	// Record the cluster of each entry
+	auto clusters = Kokkos::View<IndexType*>("Left Side Clusters", nEntries);
+	_nw._reactions.forEach(
+		"ReactionNetworkWorker::defineLeftSideReactionMap::record",
+		DEVICE_LAMBDA(auto&& reaction) {
+			reaction.recordLeftSideClusters(
+				clusters, entryOffsets(reaction.getId()));
+		});
+	Kokkos::fence();
+
+	_nw._leftSideReactionMap = detail::ClusterReactionMap(
+		entryOffsets, clusters, _nw._clusterData.h_view().numClusters);
 }
 
 template <typename TImpl>
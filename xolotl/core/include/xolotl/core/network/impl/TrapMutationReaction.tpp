@@ -65,8 +65,8 @@ void
 TrapMutationReaction<TNetwork, TDerived>::updateRates(double largestRate)
 {
 	auto rate = this->asDerived()->computeRate(largestRate);
-	for (IndexType i = 0; i < this->_rate.extent(0); ++i) {
-		this->_rate(i) = rate;
+	for (IndexType s = 0; s < this->_rate.getNumberOfSlots(); ++s) {
+		this->_rate.slot(s) = rate;
 	}
 }
 
@@ -99,7 +99,7 @@ TrapMutationReaction<TNetwork, TDerived>::getAppliedRate(
 	double rate = this->_rate[gridIndex];
 	auto& tmData = this->_clusterData->extraData.trapMutationData;
 	if (_heClId == tmData.desorption().id) {
-		rate *= tmData.currentDesorpLeftSideRate();
+		rate *= tmData.currentDesorpLeftSideRate(gridIndex);
 	}
 	rate *= tmData.currentDisappearingRate();
 	return rate;
@@ -108,10 +108,11 @@ TrapMutationReaction<TNetwork, TDerived>::getAppliedRate(
 template <typename TNetwork, typename TDerived>
 KOKKOS_INLINE_FUNCTION
 bool
-TrapMutationReaction<TNetwork, TDerived>::getEnabled() const
+TrapMutationReaction<TNetwork, TDerived>::getEnabled(
+	IndexType gridIndex) const
 {
 	const auto& tmData = this->_clusterData->extraData.trapMutationData;
-	return tmData.tmEnabled[_heAmount - 1] &&
+	return tmData.isEnabled(gridIndex, _heAmount) &&
 		(tmData.tmVSizes[_heAmount - 1] == _vSize);
 }
 
@@ -121,7 +122,7 @@ void
 TrapMutationReaction<TNetwork, TDerived>::computeFlux(
 	ConcentrationsView concentrations, FluxesView fluxes, IndexType gridIndex)
 {
-	if (!getEnabled()) {
+	if (!getEnabled(gridIndex)) {
 		return;
 	}
 
@@ -140,7 +141,7 @@ TrapMutationReaction<TNetwork, TDerived>::computePartialDerivatives(
 	ConcentrationsView concentrations, Kokkos::View<double*> values,
 	IndexType gridIndex)
 {
-	if (!getEnabled()) {
+	if (!getEnabled(gridIndex)) {
 		return;
 	}
 
@@ -158,7 +159,7 @@ TrapMutationReaction<TNetwork, TDerived>::computeReducedPartialDerivatives(
 	ConcentrationsView concentrations, Kokkos::View<double*> values,
 	IndexType gridIndex)
 {
-	if (!getEnabled()) {
+	if (!getEnabled(gridIndex)) {
 		return;
 	}
 
@@ -173,7 +174,7 @@ TrapMutationReaction<TNetwork, TDerived>::computeConstantRates(
 	ConcentrationsView concentrations, RatesView rates, BelongingView isInSub,
 	OwnedSubMapView backMap, IndexType gridIndex)
 {
-	if (!getEnabled()) {
+	if (!getEnabled(gridIndex)) {
 		return;
 	}
 
@@ -11,12 +11,22 @@ namespace network
 {
 namespace zr
 {
-template <typename TRegion>
+//! Position of the capture efficiency coefficients in the rate constants
+//! (after the binding energy of the dissociations)
+constexpr std::size_t captureBegin = 1;
+
+/**
+ * @brief Computes the temperature independent part of the rate between two
+ * clusters: the rate is (c[0] / p^2 + c[1] * p + c[2]) * (dc0 + dc1) where
+ * c are the coefficients written to the rate constants and p is the
+ * anisotropy ratio of the mobile cluster.
+ */
+template <typename TRegion, typename TRateConstants>
 KOKKOS_INLINE_FUNCTION
-double
-getRate(const TRegion& pairCl0Reg, const TRegion& pairCl1Reg, const double r0,
-	const double r1, const double dc0, const double dc1, double rdCl[2][2],
-	double p)
+void
+computeCaptureCoefficients(const TRegion& pairCl0Reg,
+	const TRegion& pairCl1Reg, const double r0, const double r1,
+	double rdCl[2][2], const TRateConstants& rateConstants)
 {
 	constexpr double pi = ::xolotl::core::pi;
 	constexpr double rCore = ::xolotl::core::alphaZrCoreRadius;
@@ -36,9 +46,9 @@ getRate(const TRegion& pairCl0Reg, const TRegion& pairCl1Reg, const double r0,
 	bool cl1IsV = lo1.isOnAxis(Species::V);
 	double n0 = 0; // size of cluster 0
 	double n1 = 0; // size of cluster 1
-	double Pl = 1.0; // Capture efficiency for diffusing defect
-	double Pli = 1.0; // Capture efficiency for interstitial a-loop
-	double Plv = 1.0; // Capture efficiency for vacancy a-loops
+	// Capture efficiency of the loop as Pl[0] / p^2 + Pl[1] * p + Pl[2]
+	// (1.0 without loop)
+	double Pl[3] = {0.0, 0.0, 1.0};
 
 	// Determine parameters for cluster 0 based on cluster type and size
 	if (cl0IsV)
@@ -58,58 +68,92 @@ getRate(const TRegion& pairCl0Reg, const TRegion& pairCl1Reg, const double r0,
 		n1 = lo1[Species::I];
 	bool cl1IsLoop = (n1 > 9);
 
+	// The rate is spherical if none of the clusters are loops
+	double alpha = 1.0;
+	double rateSpherical = zs;
+	double rateToroidal = 0.0;
+
 	// Cluster 0 is a dislocation loop
 	if (cl0IsLoop) {
 		// Define the dislocation capture radius, transition coefficient, and
 		// then calculate the reaction rate
 		double rd = rdCl[0][cl1IsV];
-		double alpha = pow(1 + pow(r0 / (3 * (r1 + rd)), 2), -1);
-		double rateSpherical = 4.0 * pi * (r0 + r1 + rd);
-		double rateToroidal =
-			(4.0 * pi * pi * r0) / log(1 + (8 * r0) / (r1 + rd));
+		alpha = pow(1 + pow(r0 / (3 * (r1 + rd)), 2), -1);
+		rateSpherical = 4.0 * pi * (r0 + r1 + rd);
+		rateToroidal = (4.0 * pi * pi * r0) / log(1 + (8 * r0) / (r1 + rd));
 
 		// Calculate the capture efficiency (assuming only prismatic loops)
-		if (cl0IsV)
-			Pl = 0.78 * pow(p, -2) + 0.66 * p - 0.44;
+		if (cl0IsV) {
+			Pl[0] = 0.78;
+			Pl[1] = 0.66;
+			Pl[2] = -0.44;
+		}
 		else if (lo0.isOnAxis(Species::Basal)) {
 			if (n0 < ::xolotl::core::basalTransitionSize)
 				alpha = 1.0; // Completely spherical
-			Pl = p;
+			Pl[1] = 1.0;
+			Pl[2] = 0.0;
+		}
+		else {
+			Pl[0] = 0.70;
+			Pl[1] = 0.78;
+			Pl[2] = -0.47;
 		}
-		else
-			Pl = 0.70 * pow(p, -2) + 0.78 * p - 0.47;
-
-		return ((1 - alpha) * rateToroidal * Pl + alpha * rateSpherical) *
-			(dc0 + dc1);
 	}
 
 	// Cluster 1 is a dislocation loop:
-	if (cl1IsLoop) {
+	else if (cl1IsLoop) {
 		// Define the dislocation capture radius, transition coefficient, and
 		// then calculate the reaction rate
 		double rd = rdCl[1][cl0IsV];
-		double alpha = pow(1 + pow(r1 / (3 * (r0 + rd)), 2), -1);
-		double rateSpherical = 4.0 * pi * (r0 + r1 + rd);
-		double rateToroidal =
-			(4.0 * pi * pi * r1) / log(1 + (8 * r1) / (r0 + rd));
+		alpha = pow(1 + pow(r1 / (3 * (r0 + rd)), 2), -1);
+		rateSpherical = 4.0 * pi * (r0 + r1 + rd);
+		rateToroidal = (4.0 * pi * pi * r1) / log(1 + (8 * r1) / (r0 + rd));
 
 		// Calculate the capture efficiency (assuming only prismatic loops)
-		if (cl1IsV)
-			Pl = 0.78 * pow(p, -2) + 0.66 * p - 0.44;
+		if (cl1IsV) {
+			Pl[0] = 0.78;
+			Pl[1] = 0.66;
+			Pl[2] = -0.44;
+		}
 		else if (lo1.isOnAxis(Species::Basal)) {
 			if (n1 < ::xolotl::core::basalTransitionSize)
 				alpha = 1.0; // Completely spherical
-			Pl = p;
+			Pl[1] = 1.0;
+			Pl[2] = 0.0;
+		}
+		else {
+			Pl[0] = 0.70;
+			Pl[1] = 0.78;
+			Pl[2] = -0.47;
 		}
-		else
-			Pl = 0.70 * pow(p, -2) + 0.78 * p - 0.47;
+	}
+
+	// (1 - alpha) * rateToroidal * Pl + alpha * rateSpherical
+	const double toroidal = (1 - alpha) * rateToroidal;
+	rateConstants(captureBegin) = toroidal * Pl[0];
+	rateConstants(captureBegin + 1) = toroidal * Pl[1];
+	rateConstants(captureBegin + 2) =
+		toroidal * Pl[2] + alpha * rateSpherical;
+}
 
-		return ((1 - alpha) * rateToroidal * Pl + alpha * rateSpherical) *
-			(dc0 + dc1);
+/**
+ * @brief Computes the rate from the cached capture efficiency coefficients.
+ */
+template <typename TRateConstants>
+KOKKOS_INLINE_FUNCTION
+double
+getRate(const TRateConstants& rateConstants, const double dc0,
+	const double dc1, const double p)
+{
+	double capture = rateConstants(captureBegin + 1) * p +
+		rateConstants(captureBegin + 2);
+	// The p^-2 term is only there for the loops of the diffusing defects
+	if (rateConstants(captureBegin) != 0.0) {
+		capture += rateConstants(captureBegin) / (p * p);
 	}
 
-	// None of the clusters are loops (interaction is based on spherical volume)
-	return zs * (dc0 + dc1);
+	return capture * (dc0 + dc1);
 }
 } // namespace zr
 
@@ -120,9 +164,6 @@ ZrProductionReaction::getRateForProduction(IndexType gridIndex)
 	auto cl0 = this->_clusterData->getCluster(_reactants[0]);
 	auto cl1 = this->_clusterData->getCluster(_reactants[1]);
 
-	double r0 = cl0.getReactionRadius();
-	double r1 = cl1.getReactionRadius();
-
 	double dc0 = cl0.getDiffusionCoefficient(gridIndex);
 	double dc1 = cl1.getDiffusionCoefficient(gridIndex);
 
@@ -135,6 +176,19 @@ ZrProductionReaction::getRateForProduction(IndexType gridIndex)
 		p = this->_clusterData->extraData.anisotropyRatio(
 			_reactants[1], gridIndex);
 
+	return zr::getRate(this->_rateConstants, dc0, dc1, p);
+}
+
+KOKKOS_INLINE_FUNCTION
+void
+ZrProductionReaction::computeRateConstants()
+{
+	auto cl0 = this->_clusterData->getCluster(_reactants[0]);
+	auto cl1 = this->_clusterData->getCluster(_reactants[1]);
+
+	double r0 = cl0.getReactionRadius();
+	double r1 = cl1.getReactionRadius();
+
 	// Create an array with all possible dislocation capture radii
 	// rdCl = {(rdI for cl0, rdV for cl0), (rdI for cl1, rdV for cl1)}
 	double rdCl[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
@@ -147,8 +201,8 @@ ZrProductionReaction::getRateForProduction(IndexType gridIndex)
 	rdCl[1][1] = this->_clusterData->extraData.dislocationCaptureRadius(
 		_reactants[1], 1);
 
-	return zr::getRate(
-		cl0.getRegion(), cl1.getRegion(), r0, r1, dc0, dc1, rdCl, p);
+	zr::computeCaptureCoefficients(
+		cl0.getRegion(), cl1.getRegion(), r0, r1, rdCl, this->_rateConstants);
 }
 
 KOKKOS_INLINE_FUNCTION
@@ -158,9 +212,6 @@ ZrDissociationReaction::getRateForProduction(IndexType gridIndex)
 	auto cl0 = this->_clusterData->getCluster(_products[0]);
 	auto cl1 = this->_clusterData->getCluster(_products[1]);
 
-	double r0 = cl0.getReactionRadius();
-	double r1 = cl1.getReactionRadius();
-
 	double dc0 = cl0.getDiffusionCoefficient(gridIndex);
 	double dc1 = cl1.getDiffusionCoefficient(gridIndex);
 
@@ -173,6 +224,22 @@ ZrDissociationReaction::getRateForProduction(IndexType gridIndex)
 		p = this->_clusterData->extraData.anisotropyRatio(
 			_products[1], gridIndex);
 
+	return zr::getRate(this->_rateConstants, dc0, dc1, p);
+}
+
+KOKKOS_INLINE_FUNCTION
+void
+ZrDissociationReaction::computeRateConstants()
+{
+	// The binding energy
+	Superclass::computeRateConstants();
+
+	auto cl0 = this->_clusterData->getCluster(_products[0]);
+	auto cl1 = this->_clusterData->getCluster(_products[1]);
+
+	double r0 = cl0.getReactionRadius();
+	double r1 = cl1.getReactionRadius();
+
 	// Create an array with all possible dislocation capture radii
 	// rdCl = {(rdI for cl0, rdV for cl0), (rdI for cl1, rdV for cl1)}
 	double rdCl[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
@@ -185,8 +252,8 @@ ZrDissociationReaction::getRateForProduction(IndexType gridIndex)
 	rdCl[1][1] =
 		this->_clusterData->extraData.dislocationCaptureRadius(_products[1], 1);
 
-	return zr::getRate(
-		cl0.getRegion(), cl1.getRegion(), r0, r1, dc0, dc1, rdCl, p);
+	zr::computeCaptureCoefficients(
+		cl0.getRegion(), cl1.getRegion(), r0, r1, rdCl, this->_rateConstants);
 }
 
 KOKKOS_INLINE_FUNCTION
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include <xolotl/core/temperature/TemperatureHandler.h>
 #include <xolotl/options/IOptions.h>
 
@@ -102,6 +104,24 @@ public:
 		double* val, IdType* indices, double hxLeft, double hxRight, int xi,
 		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) override;
 
+	/**
+	 * \see ITemperatureHandler.h
+	 */
+	void
+	computeTemperatureLine(double currentTime, double*** concLines,
+		double** updatedConcLine, const double* hxLeft, const double* hxRight,
+		const std::uint8_t* pointMask, int xs, int xm, double sy = 0.0,
+		int iy = 0, double sz = 0.0, int iz = 0) override;
+
+	/**
+	 * \see ITemperatureHandler.h
+	 */
+	bool
+	computePartialsForTemperatureLine(double currentTime, double*** concLines,
+		double* val, IdType* indices, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) override;
+
 	/**
 	 * Get the heat flux at this time.
 	 *
@@ -184,9 +204,49 @@ private:
 	double A = 10.846, B = -184.22, C = 872.47;
 
 	/**
-	 * Hang on to single allocation for use in computeTemperature()
+	 * The temperatures at the middle, left, and right points and the
+	 * material properties (alpha, beta, gamma, and their derivatives) at
+	 * each point of the line being computed
 	 */
-	std::vector<std::array<double, 2>> oldConcBox;
+	std::vector<double> midTemps, leftTemps, rightTemps, alphas, betas,
+		gammas, dAlphas, dBetas, dGammas, ddBetas;
+
+	/**
+	 * Gather the temperatures and compute the material properties on n
+	 * points of a line.
+	 *
+	 * @param concLines The lines of concentrations
+	 * @param lineStart The position in the lines of the first point
+	 * @param xs The position on the x grid of the first point
+	 * @param n The number of points
+	 * @param withPartials Whether the derivatives only needed by the partials
+	 * are computed
+	 */
+	void
+	computeLineProperties(double*** concLines, int lineStart, int xs, int n,
+		bool withPartials);
+
+	/**
+	 * Compute the flux due to the heat equation on n points of a line.
+	 *
+	 * \see computeTemperatureLine
+	 */
+	void
+	computeLineTemperature(double heatFlux, double*** concLines,
+		double** updatedConcLine, const double* hxLeft, const double* hxRight,
+		const std::uint8_t* pointMask, int lineStart, int xs, int n, double sy,
+		double sz);
+
+	/**
+	 * Compute the partials due to the heat equation on n points of a line.
+	 *
+	 * \see computePartialsForTemperatureLine
+	 */
+	void
+	computeLinePartials(double heatFlux, double*** concLines, double* val,
+		const double* hxLeft, const double* hxRight,
+		const std::uint8_t* pointMask, int lineStart, int xs, int n, double sy,
+		double sz);
 
 	/**
 	 * Get the spatially dependent part of the heat conductivity.
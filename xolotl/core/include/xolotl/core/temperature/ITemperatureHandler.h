@@ -1,6 +1,7 @@
 #ifndef ITEMPERATUREHANDLER_H
 #define ITEMPERATUREHANDLER_H
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -143,6 +144,76 @@ public:
 		double* val, IdType* indices, double hxLeft, double hxRight, int xi,
 		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) = 0;
 
+	/**
+	 * Compute the flux due to the heat equation on a whole line of the
+	 * locally owned grid in the x direction. It gives the same result as
+	 * calling computeTemperature on each point of the line where pointMask
+	 * is not zero, but the heat flux is only evaluated once and the material
+	 * properties are computed for all the points at once.
+	 *
+	 * @param currentTime The current time
+	 * @param concLines The lines of concentrations, indexed by the position
+	 * on the x grid (ghost points included), for the middle line then the
+	 * bottom/top/front/back ones
+	 * @param updatedConcLine The line of updated concentrations
+	 * @param hxLeft The step sizes on the left side of each point of the
+	 * line in the x direction
+	 * @param hxRight The step sizes on the right side of each point of the
+	 * line in the x direction
+	 * @param pointMask Not zero for the points of the line where the heat
+	 * equation is computed
+	 * @param xs The beginning of the grid on this process, first point of
+	 * the line
+	 * @param xm The number of points in the line
+	 * @param sy The space parameter, depending on the grid step size in the y
+	 * direction
+	 * @param iy The position on the y grid
+	 * @param sz The space parameter, depending on the grid step size in the z
+	 * direction
+	 * @param iz The position on the z grid
+	 */
+	virtual void
+	computeTemperatureLine(double currentTime, double*** concLines,
+		double** updatedConcLine, const double* hxLeft, const double* hxRight,
+		const std::uint8_t* pointMask, int xs, int xm, double sy = 0.0,
+		int iy = 0, double sz = 0.0, int iz = 0) = 0;
+
+	/**
+	 * Compute the partials due to the heat equation on a whole line of the
+	 * locally owned grid in the x direction, the same way as
+	 * computeTemperatureLine.
+	 *
+	 * @param currentTime The current time
+	 * @param concLines The lines of concentrations, see
+	 * computeTemperatureLine
+	 * @param val The pointer to the array that will contain the values of
+	 * partials for the heat equation, 2 * dimension + 1 values for each point
+	 * of the line
+	 * @param indices The pointer to the array that will contain the indices of
+	 * the temperature in the network
+	 * @param hxLeft The step sizes on the left side of each point of the
+	 * line in the x direction
+	 * @param hxRight The step sizes on the right side of each point of the
+	 * line in the x direction
+	 * @param pointMask Not zero for the points of the line where the partials
+	 * are computed
+	 * @param xs The beginning of the grid on this process, first point of
+	 * the line
+	 * @param xm The number of points in the line
+	 * @param sy The space parameter, depending on the grid step size in the y
+	 * direction
+	 * @param iy The position on the y grid
+	 * @param sz The space parameter, depending on the grid step size in the z
+	 * direction
+	 * @param iz The position on the z grid
+	 * @return True if the partials were updated
+	 */
+	virtual bool
+	computePartialsForTemperatureLine(double currentTime, double*** concLines,
+		double* val, IdType* indices, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) = 0;
+
 	/**
 	 * Get the heat flux at this time.
 	 *
@@ -101,6 +101,36 @@ public:
 		return false;
 	}
 
+	/**
+	 * Compute the flux due to the heat equation on a line.
+	 * Don't do anything.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	void
+	computeTemperatureLine(double currentTime, double*** concLines,
+		double** updatedConcLine, const double* hxLeft, const double* hxRight,
+		const std::uint8_t* pointMask, int xs, int xm, double sy = 0.0,
+		int iy = 0, double sz = 0.0, int iz = 0) override
+	{
+		return;
+	}
+
+	/**
+	 * Compute the partials due to the heat equation on a line.
+	 * Don't do anything.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	bool
+	computePartialsForTemperatureLine(double currentTime, double*** concLines,
+		double* val, IdType* indices, const double* hxLeft,
+		const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) override
+	{
+		return false;
+	}
+
 	/**
 	 * Get the heat flux at this time.
 	 *
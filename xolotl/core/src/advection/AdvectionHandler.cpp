@@ -0,0 +1,107 @@
+// Includes
+#include <algorithm>
+
+#include <xolotl/core/advection/AdvectionHandler.h>
+
+namespace xolotl
+{
+namespace core
+{
+namespace advection
+{
+const double*
+AdvectionHandler::getAdvectionCoefficients(
+	network::IReactionNetwork& network) const
+{
+	auto version = network.getDiffusionCoefficientsVersion();
+	const std::size_t gridSize = network.getGridSize();
+	if (version == advectionCoefsVersion &&
+		advectionCoefs.size() == advectingClusters.size() * gridSize) {
+		return advectionCoefs.data();
+	}
+
+	std::vector<double> temperatures;
+	network.getTemperatures(temperatures);
+	network.getDiffusionCoefficients(advectingClusters, advectionCoefs);
+	for (std::size_t a = 0; a < advectingClusters.size(); a++) {
+		double* coefs = advectionCoefs.data() + a * gridSize;
+		for (std::size_t g = 0; g < gridSize; g++) {
+			coefs[g] *=
+				3.0 * sinkStrengthVector[a] / (kBoltzmann * temperatures[g]);
+		}
+	}
+	advectionCoefsVersion = version;
+
+	return advectionCoefs.data();
+}
+
+void
+AdvectionHandler::applyLineStencil(network::IReactionNetwork& network,
+	double** const* stencilLines, const int* stencilShifts, int nStencil,
+	const double* weights, const double* grads, const std::uint8_t* mask,
+	std::size_t maskStride, double** updatedConcLine,
+	const std::uint8_t* pointMask, int xs, int ix0, int n) const
+{
+	const std::size_t nAdvec = advectingClusters.size();
+	if (nAdvec == 0 || n <= 0)
+		return;
+
+	const double* coefs = getAdvectionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
+
+	lineConcs.resize(nStencil * n);
+	lineFluxes.resize(n);
+	double* flux = lineFluxes.data();
+
+	for (std::size_t a = 0; a < nAdvec; a++) {
+		const auto currId = advectingClusters[a];
+		const double* coef = coefs + a * coefsGridSize + ix0;
+		const std::uint8_t* clusterMask =
+			mask ? mask + a * maskStride + ix0 : nullptr;
+
+		// Gather the concentrations of this cluster at each point of the
+		// stencil
+		for (int s = 0; s < nStencil; s++) {
+			double* concs = lineConcs.data() + s * n;
+			double** line = stencilLines[s];
+			const int shift = stencilShifts[s];
+			for (int p = 0; p < n; p++) {
+				concs[p] = line[xs + ix0 + p + shift][currId];
+			}
+			if (clusterMask) {
+				for (int p = 0; p < n; p++) {
+					concs[p] *= clusterMask[p + 1 + shift];
+				}
+			}
+		}
+
+		// Compute the flux at each point, only reading contiguous buffers
+		std::fill(flux, flux + n, 0.0);
+		for (int s = 0; s < nStencil; s++) {
+			const double* concs = lineConcs.data() + s * n;
+			const double* w = weights + s * n;
+			for (int p = 0; p < n; p++) {
+				flux[p] += w[p] * concs[p];
+			}
+		}
+		for (int p = 0; p < n; p++) {
+			flux[p] *= coef[p + 1];
+		}
+		if (grads) {
+			const double* midConcs = lineConcs.data();
+			for (int p = 0; p < n; p++) {
+				flux[p] += (coef[p + 2] - coef[p + 1]) * grads[p] * midConcs[p];
+			}
+		}
+
+		// Update the concentration of the cluster
+		for (int p = 0; p < n; p++) {
+			if (pointMask[p])
+				updatedConcLine[xs + ix0 + p][currId] += flux[p];
+		}
+	}
+}
+
+} /* end namespace advection */
+} /* end namespace core */
+} /* end namespace xolotl */
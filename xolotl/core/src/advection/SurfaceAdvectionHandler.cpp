@@ -15,20 +15,12 @@ SurfaceAdvectionHandler::initializeAdvectionGrid(
 	// Get the number of advecting clusters
 	int nAdvec = advectingClusters.size();
 
-	// Initialize the advection grid with true everywhere
-	advectionGrid.clear();
-	// Initialize it to True
-	for (int k = 0; k < nz + 2; k++) {
-		std::vector<std::vector<std::vector<bool>>> tempGridTer;
-		for (int j = 0; j < ny + 2; j++) {
-			std::vector<std::vector<bool>> tempGridBis;
-			for (int i = 0; i < nx + 2; i++) {
-				tempGridBis.emplace_back(nAdvec, true);
-			}
-			tempGridTer.push_back(tempGridBis);
-		}
-		advectionGrid.push_back(tempGridTer);
-	}
+	// Initialize the advection grid with true everywhere, the points are
+	// stored at i + 1 for i in [0, nx + 2)
+	gridNx = nx + 3;
+	gridNy = ny + 2;
+	nGridPoints = (std::size_t)gridNx * gridNy * (nz + 2);
+	advectionGrid.assign(nAdvec * nGridPoints, 1);
 
 	// Initialize the grid position
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
@@ -66,8 +58,11 @@ SurfaceAdvectionHandler::initializeAdvectionGrid(
 								advectingClusters.end(), currAdvCluster);
 							if (it != advectingClusters.end()) {
 								// Set this diffusion grid value to false
-								advectionGrid[k + 1][j + 1][i + 1][(*it)] =
-									false;
+								auto advClusterIdx =
+									it - advectingClusters.begin();
+								advectionGrid[advClusterIdx * nGridPoints +
+									getGridPointIndex(i + 1, j + 1, k + 1)] =
+									0;
 							}
 							else {
 								throw std::runtime_error(
@@ -93,94 +88,92 @@ SurfaceAdvectionHandler::computeAdvection(network::IReactionNetwork& network,
 	double* updatedConcOffset, double hxLeft, double hxRight, int ix, double hy,
 	int iy, double hz, int iz) const
 {
-	// Consider each advecting cluster
-	// TODO Maintaining a separate index assumes that advectingClusters is
-	// visited in same order as advectionGrid array for given point
-	// and the sinkStrengthVector.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// advecting clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int advClusterIdx = 0;
-	for (auto const& currId : advectingClusters) {
-		auto cluster = network.getClusterCommon(currId);
-
-		// Get the initial concentrations
-		double oldConc = concVector[0][currId] *
-			advectionGrid[iz + 1][iy + 1][ix + 1][advClusterIdx]; // middle
-		double oldRightConc = concVector[2][currId] *
-			advectionGrid[iz + 1][iy + 1][ix + 2][advClusterIdx]; // right
-
-		// Compute the concentration as explained in the description of the
-		// method
-		double conc = (3.0 * sinkStrengthVector[advClusterIdx] *
-						  cluster.getDiffusionCoefficient(ix + 1)) *
-			((oldRightConc / pow(pos[0] - location + hxRight, 4)) -
-				(oldConc / pow(pos[0] - location, 4))) /
-			(kBoltzmann * cluster.getTemperature(ix + 1) * hxRight);
-
-		conc += (3.0 * sinkStrengthVector[advClusterIdx] * oldConc) *
-			(cluster.getDiffusionCoefficient(ix + 2) /
-					cluster.getTemperature(ix + 2) -
-				cluster.getDiffusionCoefficient(ix + 1) /
-					cluster.getTemperature(ix + 1)) /
-			(kBoltzmann * hxRight * pow(pos[0] - location, 4));
-
-		// Update the concentration of the cluster
-		updatedConcOffset[currId] += conc;
-
-		++advClusterIdx;
-	}
+	// Consider this point as a line of one point
+	double* midLine[3] = {concVector[1], concVector[0], concVector[2]};
+	double** concLines[1] = {midLine + 1};
+	double* updatedLine[1] = {updatedConcOffset};
+	const std::uint8_t pointMask[1] = {1};
+	computeLineAdvection(network, &pos[0], concLines, updatedLine, &hxLeft,
+		&hxRight, pointMask, -ix, ix, 1, iy, iz);
+
+	return;
+}
+
+void
+SurfaceAdvectionHandler::computeAdvectionLine(
+	network::IReactionNetwork& network,
+	const plsm::SpaceVector<double, 3>& linePos, const double* xPositions,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	double hy, int iy, double hz, int iz) const
+{
+	computeLineAdvection(network, xPositions, concLines, updatedConcLine,
+		hxLeft, hxRight, pointMask, xs, 0, xm, iy, iz);
 
 	return;
 }
 
+void
+SurfaceAdvectionHandler::computeLineAdvection(
+	network::IReactionNetwork& network, const double* xPositions,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int ix0,
+	int n, int iy, int iz) const
+{
+	// Compute the geometric factors once for each point, with the middle
+	// and right weights as explained in the description of computeAdvection
+	stencilWeights.resize(2 * n);
+	gradWeights.resize(n);
+	double* midWeights = stencilWeights.data();
+	double* rightWeights = midWeights + n;
+	for (int p = 0; p < n; p++) {
+		double a = xPositions[p] - location;
+		double b = a + hxRight[p];
+		double invA4 = 1.0 / (a * a * a * a);
+		midWeights[p] = -invA4 / hxRight[p];
+		rightWeights[p] = 1.0 / (b * b * b * b * hxRight[p]);
+		gradWeights[p] = invA4 / hxRight[p];
+	}
+
+	double** stencilLines[2] = {concLines[0], concLines[0]};
+	const int stencilShifts[2] = {0, 1};
+	applyLineStencil(network, stencilLines, stencilShifts, 2,
+		stencilWeights.data(), gradWeights.data(),
+		advectionGrid.data() + getGridPointIndex(0, iy + 1, iz + 1),
+		nGridPoints, updatedConcLine, pointMask, xs, ix0, n);
+}
+
 void
 SurfaceAdvectionHandler::computePartialsForAdvection(
 	network::IReactionNetwork& network, double* val, IdType* indices,
 	const plsm::SpaceVector<double, 3>& pos, double hxLeft, double hxRight,
 	int ix, double hy, int iy, double hz, int iz) const
 {
-	// Get the number of advecting cluster
-	int nAdvec = advectingClusters.size();
+	const double* coefs = getAdvectionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
+
+	// The geometric factors are the same for all the clusters
+	double a = pos[0] - location;
+	double b = a + hxRight;
+	double midFactor = 1.0 / (hxRight * a * a * a * a);
+	double rightFactor = 1.0 / (hxRight * b * b * b * b);
+	const auto mid = getGridPointIndex(ix + 1, iy + 1, iz + 1);
 
 	// Consider each advecting cluster.
-	// TODO Maintaining a separate index assumes that advectingClusters is
-	// visited in same order as advectionGrid array for given point
-	// and the sinkStrengthVector.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// advecting clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int advClusterIdx = 0;
-	for (auto const& currId : advectingClusters) {
-		auto cluster = network.getClusterCommon(currId);
-		// Get the diffusion coefficient of the cluster
-		double diffCoeff = cluster.getDiffusionCoefficient(ix + 1);
-		// Get the sink strength value
-		double sinkStrength = sinkStrengthVector[advClusterIdx];
+	for (std::size_t c = 0; c < advectingClusters.size(); c++) {
+		const double* coef = coefs + c * coefsGridSize;
+		const std::uint8_t* mask = advectionGrid.data() + c * nGridPoints;
 
 		// Set the cluster index that will be used by PetscSolver
 		// to compute the row and column indices for the Jacobian
-		indices[advClusterIdx] = currId;
+		indices[c] = advectingClusters[c];
 
 		// Compute the partial derivatives for advection of this cluster as
 		// explained in the description of this method
-		val[advClusterIdx * 2] = -(3.0 * sinkStrength * diffCoeff) /
-			(kBoltzmann * cluster.getTemperature(ix + 1) * hxRight *
-				pow(pos[0] - location, 4)) *
-			advectionGrid[iz + 1][iy + 1][ix + 1][advClusterIdx]; // middle
-		val[advClusterIdx * 2] += (3.0 * sinkStrength) *
-			(cluster.getDiffusionCoefficient(ix + 2) /
-					cluster.getTemperature(ix + 2) -
-				cluster.getDiffusionCoefficient(ix + 1) /
-					cluster.getTemperature(ix + 1)) /
-			(kBoltzmann * hxRight * pow(pos[0] - location, 4)) *
-			advectionGrid[iz + 1][iy + 1][ix + 1][advClusterIdx]; // middle
-		val[(advClusterIdx * 2) + 1] = (3.0 * sinkStrength * diffCoeff) /
-			(kBoltzmann * cluster.getTemperature(ix + 1) * hxRight *
-				pow(pos[0] - location + hxRight, 4)) *
-			advectionGrid[iz + 1][iy + 1][ix + 2][advClusterIdx]; // right
-
-		++advClusterIdx;
+		val[c * 2] = (-coef[ix + 1] * midFactor +
+						 (coef[ix + 2] - coef[ix + 1]) * midFactor) *
+			mask[mid]; // middle
+		val[(c * 2) + 1] = coef[ix + 1] * rightFactor * mask[mid + 1]; // right
 	}
 
 	return;
@@ -98,61 +98,69 @@ XGBAdvectionHandler::computeAdvection(network::IReactionNetwork& network,
 	double* updatedConcOffset, double hxLeft, double hxRight, int ix, double hy,
 	int iy, double hz, int iz) const
 {
-	// Consider each advecting cluster.
-	// TODO Maintaining a separate index assumes that advectingClusters is
-	// visited in same order as advectionGrid array for given point
-	// and the sinkStrengthVector.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// advecting clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int advClusterIdx = 0;
-	for (auto const& currId : advectingClusters) {
-		auto cluster = network.getClusterCommon(currId);
+	// Consider this point as a line of one point
+	double* midLine[3] = {concVector[1], concVector[0], concVector[2]};
+	double** concLines[1] = {midLine + 1};
+	double* updatedLine[1] = {updatedConcOffset};
+	const std::uint8_t pointMask[1] = {1};
+	computeLineAdvection(network, &pos[0], concLines, updatedLine, &hxLeft,
+		&hxRight, pointMask, -ix, ix, 1);
+
+	return;
+}
+
+void
+XGBAdvectionHandler::computeAdvectionLine(network::IReactionNetwork& network,
+	const plsm::SpaceVector<double, 3>& linePos, const double* xPositions,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	double hy, int iy, double hz, int iz) const
+{
+	computeLineAdvection(network, xPositions, concLines, updatedConcLine,
+		hxLeft, hxRight, pointMask, xs, 0, xm);
+
+	return;
+}
 
+void
+XGBAdvectionHandler::computeLineAdvection(network::IReactionNetwork& network,
+	const double* xPositions, double*** concLines, double** updatedConcLine,
+	const double* hxLeft, const double* hxRight, const std::uint8_t* pointMask,
+	int xs, int ix0, int n) const
+{
+	// Compute the weights of the middle, left, and right concentrations at
+	// each point
+	stencilWeights.assign(3 * n, 0.0);
+	double* midWeights = stencilWeights.data();
+	double* leftWeights = midWeights + n;
+	double* rightWeights = leftWeights + n;
+	for (int p = 0; p < n; p++) {
+		double dist = xPositions[p] - location;
 		// If we are on the sink, the behavior is not the same
 		// Both sides are giving their concentrations to the center
-		if (isPointOnSink(pos)) {
-			double oldLeftConc = concVector[1][currId]; // left
-			double oldRightConc = concVector[2][currId]; // right
-
-			double conc = (3.0 * sinkStrengthVector[advClusterIdx] *
-							  cluster.getDiffusionCoefficient(ix + 1)) *
-				((oldLeftConc / pow(hxLeft, 5)) +
-					(oldRightConc / pow(hxRight, 5))) /
-				(kBoltzmann * cluster.getTemperature(ix + 1));
-
-			// Update the concentration of the cluster
-			updatedConcOffset[currId] += conc;
-		}
-		// Here we are NOT on the GB sink
-		else {
-			// Get the initial concentrations
-			double oldConc = concVector[0][currId]; // middle
-			double oldRightConc = concVector[2 * (pos[0] > location) +
-				1 * (pos[0] < location)][currId]; // left or right
-
-			// Get the a=d and b=d+h positions
-			double a = fabs(location - pos[0]);
-			double b = fabs(location - pos[0]) + hxRight * (pos[0] > location) +
-				hxLeft * (pos[0] < location);
-
-			// Compute the concentration as explained in the description of the
-			// method
-			double conc = (3.0 * sinkStrengthVector[advClusterIdx] *
-							  cluster.getDiffusionCoefficient(ix + 1)) *
-				((oldRightConc / pow(b, 4)) - (oldConc / pow(a, 4))) /
-				(kBoltzmann * cluster.getTemperature(ix + 1) *
-					(hxRight * (pos[0] > location) +
-						hxLeft * (pos[0] < location)));
-
-			// Update the concentration of the cluster
-			updatedConcOffset[currId] += conc;
+		if (fabs(dist) < 0.001) {
+			leftWeights[p] = 1.0 / pow(hxLeft[p], 5);
+			rightWeights[p] = 1.0 / pow(hxRight[p], 5);
+			continue;
 		}
 
-		++advClusterIdx;
+		// Get the a=d and b=d+h positions
+		double h = (dist > 0.0) ? hxRight[p] : hxLeft[p];
+		double a = fabs(dist);
+		double b = a + h;
+		midWeights[p] = -1.0 / (a * a * a * a * h);
+		double otherWeight = 1.0 / (b * b * b * b * h);
+		if (dist > 0.0)
+			rightWeights[p] = otherWeight;
+		else
+			leftWeights[p] = otherWeight;
 	}
 
-	return;
+	double** stencilLines[3] = {concLines[0], concLines[0], concLines[0]};
+	const int stencilShifts[3] = {0, -1, 1};
+	applyLineStencil(network, stencilLines, stencilShifts, 3,
+		stencilWeights.data(), nullptr, nullptr, 0, updatedConcLine, pointMask,
+		xs, ix0, n);
 }
 
 void
@@ -161,59 +169,41 @@ XGBAdvectionHandler::computePartialsForAdvection(
 	const plsm::SpaceVector<double, 3>& pos, double hxLeft, double hxRight,
 	int ix, double hy, int iy, double hz, int iz) const
 {
-	// Consider each advecting cluster.
-	// TODO Maintaining a separate index assumes that advectingClusters is
-	// visited in same order as advectionGrid array for given point
-	// and the sinkStrengthVector.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// advecting clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int advClusterIdx = 0;
-	for (auto const& currId : advectingClusters) {
-		auto cluster = network.getClusterCommon(currId);
-		// Get the diffusion coefficient of the cluster
-		double diffCoeff = cluster.getDiffusionCoefficient(ix + 1);
-		// Get the sink strength value
-		double sinkStrength = sinkStrengthVector[advClusterIdx];
+	const double* coefs = getAdvectionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
+
+	// The geometric factors are the same for all the clusters
+	bool onSink = isPointOnSink(pos);
+	double factors[2] = {0.0, 0.0};
+	if (onSink) {
+		factors[0] = 1.0 / pow(hxLeft, 5); // left
+		factors[1] = 1.0 / pow(hxRight, 5); // right
+	}
+	else {
+		// Get the a=d and b=d+h positions
+		double h = (pos[0] > location) ? hxRight : hxLeft;
+		double a = fabs(location - pos[0]);
+		double b = a + h;
+		factors[0] = -1.0 / (a * a * a * a * h); // middle
+		factors[1] = 1.0 / (b * b * b * b * h); // left or right
+	}
 
+	// Consider each advecting cluster.
+	for (std::size_t c = 0; c < advectingClusters.size(); c++) {
 		// Set the cluster index that will be used by PetscSolver
 		// to compute the row and column indices for the Jacobian
-		indices[advClusterIdx] = currId;
+		indices[c] = advectingClusters[c];
 
-		// If we are on the sink, the partial derivatives are not the same
-		// Both sides are giving their concentrations to the center
-		if (isPointOnSink(pos)) {
-			// 1D case
-			if (dimension == 1) {
-				val[advClusterIdx * 2] = (3.0 * sinkStrength * diffCoeff) /
-					(kBoltzmann * cluster.getTemperature(ix + 1) *
-						pow(hxLeft, 5)); // left
-				val[(advClusterIdx * 2) + 1] =
-					(3.0 * sinkStrength * diffCoeff) /
-					(kBoltzmann * cluster.getTemperature(ix + 1) *
-						pow(hxRight, 5)); // right
-			}
-		}
-		// Here we are NOT on the GB sink
-		else {
-			// Get the a=d and b=d+h positions
-			double a = fabs(location - pos[0]);
-			double b = fabs(location - pos[0]) + hxRight * (pos[0] > location) +
-				hxLeft * (pos[0] < location);
-
-			// Compute the partial derivatives for advection of this cluster as
-			// explained in the description of this method
-			val[advClusterIdx * 2] = -(3.0 * sinkStrength * diffCoeff) /
-				(kBoltzmann * cluster.getTemperature(ix + 1) * pow(a, 4) *
-					(hxRight * (pos[0] > location) +
-						hxLeft * (pos[0] < location))); // middle
-			val[(advClusterIdx * 2) + 1] = (3.0 * sinkStrength * diffCoeff) /
-				(kBoltzmann * cluster.getTemperature(ix + 1) * pow(b, 4) *
-					(hxRight * (pos[0] > location) +
-						hxLeft * (pos[0] < location))); // left or right
-		}
+		// If we are on the sink, the partial derivatives are only set in the
+		// 1D case
+		if (onSink && dimension != 1)
+			continue;
 
-		++advClusterIdx;
+		// Compute the partial derivatives for advection of this cluster as
+		// explained in the description of this method
+		double coef = coefs[c * coefsGridSize + ix + 1];
+		val[c * 2] = coef * factors[0];
+		val[(c * 2) + 1] = coef * factors[1];
 	}
 
 	return;
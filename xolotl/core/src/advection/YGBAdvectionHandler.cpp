@@ -1,4 +1,6 @@
 // Includes
+#include <algorithm>
+
 #include <xolotl/core/advection/YGBAdvectionHandler.h>
 #include <xolotl/core/network/IPSIReactionNetwork.h>
 
@@ -98,110 +100,104 @@ YGBAdvectionHandler::computeAdvection(network::IReactionNetwork& network,
 	double* updatedConcOffset, double hxLeft, double hxRight, int ix, double hy,
 	int iy, double hz, int iz) const
 {
-	// Consider each advecting cluster.
-	// TODO Maintaining a separate index assumes that advectingClusters is
-	// visited in same order as advectionGrid array for given point
-	// and the sinkStrengthVector.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// advecting clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int advClusterIdx = 0;
-	for (auto const& currId : advectingClusters) {
-		auto cluster = network.getClusterCommon(currId);
-
-		// If we are on the sink, the behavior is not the same
-		// Both sides are giving their concentrations to the center
-		if (isPointOnSink(pos)) {
-			double oldBottomConc = concVector[3][currId]; // bottom
-			double oldTopConc = concVector[4][currId]; // top
-
-			double conc = (3.0 * sinkStrengthVector[advClusterIdx] *
-							  cluster.getDiffusionCoefficient(ix + 1)) *
-				((oldBottomConc / pow(hy, 5)) + (oldTopConc / pow(hy, 5))) /
-				(kBoltzmann * cluster.getTemperature(ix + 1));
-
-			// Update the concentration of the cluster
-			updatedConcOffset[currId] += conc;
-		}
-		// Here we are NOT on the GB sink
-		else {
-			// Get the initial concentrations
-			double oldConc = concVector[0][currId]; // middle
-			double oldRightConc = concVector[4 * (pos[1] > location) +
-				3 * (pos[1] < location)][currId]; // top or bottom
-
-			// Get the a=d and b=d+h positions
-			double a = fabs(location - pos[1]);
-			double b = fabs(location - pos[1]) + hy;
-
-			// Compute the concentration as explained in the description of the
-			// method
-			double conc = (3.0 * sinkStrengthVector[advClusterIdx] *
-							  cluster.getDiffusionCoefficient(ix + 1)) *
-				((oldRightConc / pow(b, 4)) - (oldConc / pow(a, 4))) /
-				(kBoltzmann * cluster.getTemperature(ix + 1) * hy);
-
-			// Update the concentration of the cluster
-			updatedConcOffset[currId] += conc;
-		}
+	// Consider this point as a line of one point
+	double** concLines[3] = {concVector, concVector + 3, concVector + 4};
+	double* updatedLine[1] = {updatedConcOffset};
+	const std::uint8_t pointMask[1] = {1};
+	computeLineAdvection(
+		network, pos, concLines, updatedLine, pointMask, -ix, ix, 1, hy);
 
-		++advClusterIdx;
-	}
+	return;
+}
+
+void
+YGBAdvectionHandler::computeAdvectionLine(network::IReactionNetwork& network,
+	const plsm::SpaceVector<double, 3>& linePos, const double* xPositions,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	double hy, int iy, double hz, int iz) const
+{
+	computeLineAdvection(network, linePos, concLines, updatedConcLine,
+		pointMask, xs, 0, xm, hy);
 
 	return;
 }
 
+void
+YGBAdvectionHandler::computeLineAdvection(network::IReactionNetwork& network,
+	const plsm::SpaceVector<double, 3>& linePos, double*** concLines,
+	double** updatedConcLine, const std::uint8_t* pointMask, int xs, int ix0,
+	int n, double hy) const
+{
+	// The geometric factors only depend on the position of the line
+	double factors[2] = {0.0, 0.0};
+	double** stencilLines[2] = {concLines[0], concLines[0]};
+	// If we are on the sink, the behavior is not the same
+	// Both sides are giving their concentrations to the center
+	if (isPointOnSink(linePos)) {
+		factors[0] = 1.0 / pow(hy, 5); // bottom
+		factors[1] = factors[0]; // top
+		stencilLines[0] = concLines[1];
+		stencilLines[1] = concLines[2];
+	}
+	// Here we are NOT on the GB sink
+	else {
+		// Get the a=d and b=d+h positions
+		double a = fabs(location - linePos[1]);
+		double b = a + hy;
+		factors[0] = -1.0 / (a * a * a * a * hy); // middle
+		factors[1] = 1.0 / (b * b * b * b * hy); // top or bottom
+		stencilLines[1] =
+			concLines[(linePos[1] > location) ? 2 : 1];
+	}
+
+	stencilWeights.resize(2 * n);
+	std::fill(stencilWeights.begin(), stencilWeights.begin() + n, factors[0]);
+	std::fill(stencilWeights.begin() + n, stencilWeights.end(), factors[1]);
+
+	const int stencilShifts[2] = {0, 0};
+	applyLineStencil(network, stencilLines, stencilShifts, 2,
+		stencilWeights.data(), nullptr, nullptr, 0, updatedConcLine, pointMask,
+		xs, ix0, n);
+}
+
 void
 YGBAdvectionHandler::computePartialsForAdvection(
 	network::IReactionNetwork& network, double* val, IdType* indices,
 	const plsm::SpaceVector<double, 3>& pos, double hxLeft, double hxRight,
 	int ix, double hy, int iy, double hz, int iz) const
 {
-	// Consider each advecting cluster.
-	// TODO Maintaining a separate index assumes that advectingClusters is
-	// visited in same order as advectionGrid array for given point
-	// and the sinkStrengthVector.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// advecting clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int advClusterIdx = 0;
-	for (auto const& currId : advectingClusters) {
-		auto cluster = network.getClusterCommon(currId);
-		// Get the diffusion coefficient of the cluster
-		double diffCoeff = cluster.getDiffusionCoefficient(ix + 1);
-		// Get the sink strength value
-		double sinkStrength = sinkStrengthVector[advClusterIdx];
+	const double* coefs = getAdvectionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
+
+	// The geometric factors are the same for all the clusters
+	double factors[2] = {0.0, 0.0};
+	// If we are on the sink, the partial derivatives are not the same
+	// Both sides are giving their concentrations to the center
+	if (isPointOnSink(pos)) {
+		factors[0] = 1.0 / pow(hy, 5); // top or bottom
+		factors[1] = factors[0]; // top or bottom
+	}
+	// Here we are NOT on the GB sink
+	else {
+		// Get the a=d and b=d+h positions
+		double a = fabs(location - pos[1]);
+		double b = a + hy;
+		factors[0] = -1.0 / (hy * a * a * a * a); // middle
+		factors[1] = 1.0 / (hy * b * b * b * b); // top or bottom
+	}
 
+	// Consider each advecting cluster.
+	for (std::size_t c = 0; c < advectingClusters.size(); c++) {
 		// Set the cluster index that will be used by PetscSolver
 		// to compute the row and column indices for the Jacobian
-		indices[advClusterIdx] = currId;
-
-		// If we are on the sink, the partial derivatives are not the same
-		// Both sides are giving their concentrations to the center
-		if (isPointOnSink(pos)) {
-			val[advClusterIdx * 2] = (3.0 * sinkStrength * diffCoeff) /
-				(kBoltzmann * cluster.getTemperature(ix + 1) *
-					pow(hy, 5)); // top or bottom
-			val[(advClusterIdx * 2) + 1] =
-				val[advClusterIdx * 2]; // top or bottom
-		}
-		// Here we are NOT on the GB sink
-		else {
-			// Get the a=d and b=d+h positions
-			double a = fabs(location - pos[1]);
-			double b = fabs(location - pos[1]) + hy;
-
-			// Compute the partial derivatives for advection of this cluster as
-			// explained in the description of this method
-			val[advClusterIdx * 2] = -(3.0 * sinkStrength * diffCoeff) /
-				(kBoltzmann * cluster.getTemperature(ix + 1) * hy *
-					pow(a, 4)); // middle
-			val[(advClusterIdx * 2) + 1] = (3.0 * sinkStrength * diffCoeff) /
-				(kBoltzmann * cluster.getTemperature(ix + 1) * hy *
-					pow(b, 4)); // top or bottom
-		}
+		indices[c] = advectingClusters[c];
 
-		++advClusterIdx;
+		// Compute the partial derivatives for advection of this cluster as
+		// explained in the description of this method
+		double coef = coefs[c * coefsGridSize + ix + 1];
+		val[c * 2] = coef * factors[0];
+		val[(c * 2) + 1] = coef * factors[1];
 	}
 
 	return;
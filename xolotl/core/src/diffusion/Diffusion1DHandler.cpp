@@ -1,7 +1,4 @@
 // Includes
-#include <array>
-#include <iostream>
-
 #include <xolotl/core/diffusion/Diffusion1DHandler.h>
 
 namespace xolotl
@@ -16,14 +13,8 @@ Diffusion1DHandler::initializeDiffusionGrid(
 	std::vector<double> grid, int nx, int xs, int ny, double hy, int ys, int nz,
 	double hz, int zs)
 {
-	// Get the number of diffusing clusters
-	const int nDiff = diffusingClusters.size();
-
 	// Initialize the diffusion grid with true everywhere
-	diffusionGrid.clear();
-	for (int i = 0; i < nx + 2; i++) {
-		diffusionGrid.emplace_back(nDiff, true);
-	}
+	allocateDiffusionGrid(nx + 2);
 
 	// Initialize the grid position
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
@@ -41,23 +32,7 @@ Diffusion1DHandler::initializeDiffusionGrid(
 
 			// Check if we are on a sink
 			if (currAdvectionHandler->isPointOnSink(gridPosition)) {
-				// We have to find the corresponding reactant in the diffusion
-				// cluster collection.
-				for (auto const currAdvCluster : advecClusters) {
-					auto it = find(diffusingClusters.begin(),
-						diffusingClusters.end(), currAdvCluster);
-					if (it != diffusingClusters.end()) {
-						// Set this diffusion grid value to false
-						diffusionGrid[i][(*it)] = false;
-					}
-					else {
-						throw std::runtime_error(
-							"\nThe advecting cluster of id: " +
-							std::to_string(currAdvCluster) +
-							" was not found in the diffusing clusters, cannot "
-							"use the diffusion!");
-					}
-				}
+				removeAdvectingClusters(advecClusters, i);
 			}
 		}
 	}
@@ -70,30 +45,21 @@ Diffusion1DHandler::computeDiffusion(network::IReactionNetwork& network,
 	double** concVector, double* updatedConcOffset, double hxLeft,
 	double hxRight, int ix, double, int, double, int) const
 {
-	// Consider each diffusing cluster.
-	// TODO Maintaining a separate index assumes that diffusingClusters is
-	// visited in same order as diffusionGrid array for given point.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// diffusing clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int diffClusterIdx = 0;
+	const double* coefs = getDiffusionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
 
-	for (auto const& currId : diffusingClusters) {
-		auto cluster = network.getClusterCommon(currId);
+	// Consider each diffusing cluster.
+	for (std::size_t d = 0; d < diffusingClusters.size(); d++) {
+		const auto currId = diffusingClusters[d];
+		const std::uint8_t* mask = diffusionGrid.data() + d * nGridPoints;
+		const double* diff = coefs + d * coefsGridSize;
 
 		// Get the initial concentrations
-		double oldConc =
-			concVector[0][currId] * diffusionGrid[ix + 1][diffClusterIdx];
-		double oldLeftConc =
-			concVector[1][currId] * diffusionGrid[ix][diffClusterIdx];
-		double oldRightConc =
-			concVector[2][currId] * diffusionGrid[ix + 2][diffClusterIdx];
-		double leftDiff = cluster.getDiffusionCoefficient(ix),
-			   midDiff = cluster.getDiffusionCoefficient(ix + 1),
-			   rightDiff = cluster.getDiffusionCoefficient(ix + 2);
-		double leftTemp = cluster.getTemperature(ix),
-			   midTemp = cluster.getTemperature(ix + 1),
-			   rightTemp = cluster.getTemperature(ix + 2);
+		double oldConc = concVector[0][currId] * mask[ix + 1];
+		double oldLeftConc = concVector[1][currId] * mask[ix];
+		double oldRightConc = concVector[2][currId] * mask[ix + 2];
+		double leftDiff = diff[ix], midDiff = diff[ix + 1],
+			   rightDiff = diff[ix + 2];
 
 		// Use a simple midpoint stencil to compute the concentration
 		double conc = (midDiff * 2.0 *
@@ -105,57 +71,55 @@ Diffusion1DHandler::computeDiffusion(network::IReactionNetwork& network,
 
 		// Update the concentration of the cluster
 		updatedConcOffset[currId] += conc;
-
-		// Increase the index
-		diffClusterIdx++;
 	}
 
 	return;
 }
 
+void
+Diffusion1DHandler::computeDiffusionLine(network::IReactionNetwork& network,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	double, int, double, int) const
+{
+	const std::size_t maskRows[1] = {getGridPointIndex(0)};
+	computeLineDiffusion(network, concLines, updatedConcLine, hxLeft,
+		hxRight, pointMask, xs, xm, 0, maskRows, nullptr);
+
+	return;
+}
+
 void
 Diffusion1DHandler::computePartialsForDiffusion(
 	network::IReactionNetwork& network, double* val, IdType* indices,
 	double hxLeft, double hxRight, int ix, double, int, double, int) const
 {
-	// Loop on them
-	// TODO Maintaining a separate index assumes that diffusingClusters is
-	// visited in same order as diffusionGrid array for given point.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// diffusing clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int diffClusterIdx = 0;
+	const double* coefs = getDiffusionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
 
-	for (auto const& currId : diffusingClusters) {
-		auto cluster = network.getClusterCommon(currId);
+	// Loop on them
+	for (std::size_t d = 0; d < diffusingClusters.size(); d++) {
+		const std::uint8_t* mask = diffusionGrid.data() + d * nGridPoints;
+		const double* diff = coefs + d * coefsGridSize;
 
 		// Set the cluster index, the PetscSolver will use it to compute
 		// the row and column indices for the Jacobian
-		indices[diffClusterIdx] = currId;
-		double leftDiff = cluster.getDiffusionCoefficient(ix),
-			   midDiff = cluster.getDiffusionCoefficient(ix + 1),
-			   rightDiff = cluster.getDiffusionCoefficient(ix + 2);
-		double leftTemp = cluster.getTemperature(ix),
-			   midTemp = cluster.getTemperature(ix + 1),
-			   rightTemp = cluster.getTemperature(ix + 2);
+		indices[d] = diffusingClusters[d];
+		double leftDiff = diff[ix], midDiff = diff[ix + 1],
+			   rightDiff = diff[ix + 2];
 
 		// Compute the partial derivatives for diffusion of this cluster
 		// for the middle, left, and right grid point
-		val[diffClusterIdx * 3] = (-2.0 * midDiff / (hxLeft * hxRight)) *
-			diffusionGrid[ix + 1][diffClusterIdx]; // middle
-		val[(diffClusterIdx * 3) + 1] =
-			(midDiff * 2.0 / (hxLeft * (hxLeft + hxRight)) +
-				(leftDiff - rightDiff) /
-					((hxLeft + hxRight) * (hxLeft + hxRight))) *
-			diffusionGrid[ix][diffClusterIdx]; // left
-		val[(diffClusterIdx * 3) + 2] =
-			(midDiff * 2.0 / (hxRight * (hxLeft + hxRight)) +
-				(rightDiff - leftDiff) /
-					((hxLeft + hxRight) * (hxLeft + hxRight))) *
-			diffusionGrid[ix + 2][diffClusterIdx]; // right
-
-		// Increase the index
-		diffClusterIdx++;
+		val[d * 3] =
+			(-2.0 * midDiff / (hxLeft * hxRight)) * mask[ix + 1]; // middle
+		val[(d * 3) + 1] = (midDiff * 2.0 / (hxLeft * (hxLeft + hxRight)) +
+							   (leftDiff - rightDiff) /
+								   ((hxLeft + hxRight) * (hxLeft + hxRight))) *
+			mask[ix]; // left
+		val[(d * 3) + 2] = (midDiff * 2.0 / (hxRight * (hxLeft + hxRight)) +
+							   (rightDiff - leftDiff) /
+								   ((hxLeft + hxRight) * (hxLeft + hxRight))) *
+			mask[ix + 2]; // right
 	}
 
 	return;
@@ -13,23 +13,8 @@ Diffusion3DHandler::initializeDiffusionGrid(
 	std::vector<double> grid, int nx, int xs, int ny, double hy, int ys, int nz,
 	double hz, int zs)
 {
-	// Get the number of diffusing clusters
-	int nDiff = diffusingClusters.size();
-
 	// Initialize the diffusion grid with true everywhere
-	diffusionGrid.clear();
-	// Initialize it to True
-	for (int k = 0; k < nz + 2; k++) {
-		std::vector<std::vector<std::vector<bool>>> tempGridTer;
-		for (int j = 0; j < ny + 2; j++) {
-			std::vector<std::vector<bool>> tempGridBis;
-			for (int i = 0; i < nx + 2; i++) {
-				tempGridBis.emplace_back(nDiff, true);
-			}
-			tempGridTer.push_back(tempGridBis);
-		}
-		diffusionGrid.push_back(tempGridTer);
-	}
+	allocateDiffusionGrid(nx + 2, ny + 2, nz + 2);
 
 	// Initialize the grid position
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
@@ -54,23 +39,7 @@ Diffusion3DHandler::initializeDiffusionGrid(
 
 					// Check if we are on a sink
 					if (currAdvectionHandler->isPointOnSink(gridPosition)) {
-						// We have to find the corresponding reactant in the
-						// diffusion cluster collection.
-						for (auto const& currAdvCluster : advecClusters) {
-							auto it = find(diffusingClusters.begin(),
-								diffusingClusters.end(), currAdvCluster);
-							if (it != diffusingClusters.end()) {
-								// Set this diffusion grid value to false
-								diffusionGrid[k + 1][j + 1][i][(*it)] = false;
-							}
-							else {
-								throw std::runtime_error(
-									"\nThe advecting cluster of id: " +
-									std::to_string(currAdvCluster) +
-									" was not found in the diffusing clusters, "
-									"cannot use the diffusion!");
-							}
-						}
+						removeAdvectingClusters(advecClusters, i, j + 1, k + 1);
 					}
 				}
 			}
@@ -85,109 +54,112 @@ Diffusion3DHandler::computeDiffusion(network::IReactionNetwork& network,
 	double** concVector, double* updatedConcOffset, double hxLeft,
 	double hxRight, int ix, double sy, int iy, double sz, int iz) const
 {
-	// Loop on them
-	// TODO Maintaining a separate index assumes that diffusingClusters is
-	// visited in same order as diffusionGrid array for given point.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// diffusing clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int diffClusterIdx = 0;
-	for (auto const& currId : diffusingClusters) {
-		auto cluster = network.getClusterCommon(currId);
+	const double* coefs = getDiffusionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
+
+	// The positions of the middle/left/right/bottom/top/front/back points in
+	// the diffusion grid of a cluster
+	const auto mid = getGridPointIndex(ix + 1, iy + 1, iz + 1);
+	const auto left = mid - 1, right = mid + 1;
+	const auto bottom = getGridPointIndex(ix + 1, iy, iz + 1);
+	const auto top = getGridPointIndex(ix + 1, iy + 2, iz + 1);
+	const auto front = getGridPointIndex(ix + 1, iy + 1, iz);
+	const auto back = getGridPointIndex(ix + 1, iy + 1, iz + 2);
+
+	// Consider each diffusing cluster.
+	for (std::size_t d = 0; d < diffusingClusters.size(); d++) {
+		const auto currId = diffusingClusters[d];
+		const std::uint8_t* mask = diffusionGrid.data() + d * nGridPoints;
+		const double* diff = coefs + d * coefsGridSize;
 
 		// Get the initial concentrations
-		double oldConc = concVector[0][currId] *
-			diffusionGrid[iz + 1][iy + 1][ix + 1][diffClusterIdx]; // middle
-		double oldLeftConc = concVector[1][currId] *
-			diffusionGrid[iz + 1][iy + 1][ix][diffClusterIdx]; // left
-		double oldRightConc = concVector[2][currId] *
-			diffusionGrid[iz + 1][iy + 1][ix + 2][diffClusterIdx]; // right
-		double oldBottomConc = concVector[3][currId] *
-			diffusionGrid[iz + 1][iy][ix + 1][diffClusterIdx]; // bottom
-		double oldTopConc = concVector[4][currId] *
-			diffusionGrid[iz + 1][iy + 2][ix + 1][diffClusterIdx]; // top
-		double oldFrontConc = concVector[5][currId] *
-			diffusionGrid[iz][iy + 1][ix + 1][diffClusterIdx]; // front
-		double oldBackConc = concVector[6][currId] *
-			diffusionGrid[iz + 2][iy + 1][ix + 1][diffClusterIdx]; // back
+		double oldConc = concVector[0][currId] * mask[mid]; // middle
+		double oldLeftConc = concVector[1][currId] * mask[left]; // left
+		double oldRightConc = concVector[2][currId] * mask[right]; // right
+		double oldBottomConc = concVector[3][currId] * mask[bottom]; // bottom
+		double oldTopConc = concVector[4][currId] * mask[top]; // top
+		double oldFrontConc = concVector[5][currId] * mask[front]; // front
+		double oldBackConc = concVector[6][currId] * mask[back]; // back
 
 		// Use a simple midpoint stencil to compute the concentration
-		double conc = cluster.getDiffusionCoefficient(ix + 1) *
+		double conc = diff[ix + 1] *
 				(2.0 *
 						(oldLeftConc + (hxLeft / hxRight) * oldRightConc -
 							(1.0 + (hxLeft / hxRight)) * oldConc) /
 						(hxLeft * (hxLeft + hxRight)) +
 					sy * (oldBottomConc + oldTopConc - 2.0 * oldConc) +
 					sz * (oldFrontConc + oldBackConc - 2.0 * oldConc)) +
-			((cluster.getDiffusionCoefficient(ix + 2) -
-				 cluster.getDiffusionCoefficient(ix)) *
-				(oldRightConc - oldLeftConc) /
+			((diff[ix + 2] - diff[ix]) * (oldRightConc - oldLeftConc) /
 				((hxLeft + hxRight) * (hxLeft + hxRight)));
 
 		// Update the concentration of the cluster
 		updatedConcOffset[currId] += conc;
-
-		++diffClusterIdx;
 	}
 
 	return;
 }
 
+void
+Diffusion3DHandler::computeDiffusionLine(network::IReactionNetwork& network,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	double sy, int iy, double sz, int iz) const
+{
+	// The middle, bottom, top, front, and back rows of the diffusion grid
+	const std::size_t maskRows[5] = {getGridPointIndex(0, iy + 1, iz + 1),
+		getGridPointIndex(0, iy, iz + 1), getGridPointIndex(0, iy + 2, iz + 1),
+		getGridPointIndex(0, iy + 1, iz), getGridPointIndex(0, iy + 1, iz + 2)};
+	const double s[2] = {sy, sz};
+	computeLineDiffusion(network, concLines, updatedConcLine, hxLeft,
+		hxRight, pointMask, xs, xm, 2, maskRows, s);
+
+	return;
+}
+
 void
 Diffusion3DHandler::computePartialsForDiffusion(
 	network::IReactionNetwork& network, double* val, IdType* indices,
 	double hxLeft, double hxRight, int ix, double sy, int iy, double sz,
 	int iz) const
 {
+	const double* coefs = getDiffusionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
+
+	// The positions of the middle/left/right/bottom/top/front/back points in
+	// the diffusion grid of a cluster
+	const auto mid = getGridPointIndex(ix + 1, iy + 1, iz + 1);
+	const auto left = mid - 1, right = mid + 1;
+	const auto bottom = getGridPointIndex(ix + 1, iy, iz + 1);
+	const auto top = getGridPointIndex(ix + 1, iy + 2, iz + 1);
+	const auto front = getGridPointIndex(ix + 1, iy + 1, iz);
+	const auto back = getGridPointIndex(ix + 1, iy + 1, iz + 2);
+
 	// Consider each diffusing cluster.
-	// TODO Maintaining a separate index assumes that diffusingClusters is
-	// visited in same order as diffusionGrid array for given point.
-	// Currently true with C++11, but we'd like to be able to visit the
-	// diffusing clusters in any order (so that we can parallelize).
-	// Maybe with a zip? or a std::transform?
-	int diffClusterIdx = 0;
-	for (auto const& currId : diffusingClusters) {
-		auto cluster = network.getClusterCommon(currId);
+	for (std::size_t d = 0; d < diffusingClusters.size(); d++) {
+		const std::uint8_t* mask = diffusionGrid.data() + d * nGridPoints;
+		const double* diff = coefs + d * coefsGridSize;
 
 		// Set the cluster index, the PetscSolver will use it to compute
 		// the row and column indices for the Jacobian
-		indices[diffClusterIdx] = currId;
+		indices[d] = diffusingClusters[d];
 
 		// Compute the partial derivatives for diffusion of this cluster
 		// for the middle, left, right, bottom, top, front, and back grid point
-		val[diffClusterIdx * 7] = -2.0 *
-			cluster.getDiffusionCoefficient(ix + 1) *
-			((1.0 / (hxLeft * hxRight)) + sy + sz) *
-			diffusionGrid[iz + 1][iy + 1][ix + 1][diffClusterIdx]; // middle
-		val[(diffClusterIdx * 7) + 1] =
-			(cluster.getDiffusionCoefficient(ix + 1) * 2.0 /
-					(hxLeft * (hxLeft + hxRight)) +
-				(cluster.getDiffusionCoefficient(ix) -
-					cluster.getDiffusionCoefficient(ix + 2)) /
-					((hxLeft + hxRight) * (hxLeft + hxRight))) *
-			diffusionGrid[iz + 1][iy + 1][ix][diffClusterIdx]; // left
-		val[(diffClusterIdx * 7) + 2] =
-			(cluster.getDiffusionCoefficient(ix + 1) * 2.0 /
-					(hxRight * (hxLeft + hxRight)) +
-				(cluster.getDiffusionCoefficient(ix + 2) -
-					cluster.getDiffusionCoefficient(ix)) /
+		val[d * 7] = -2.0 * diff[ix + 1] *
+			((1.0 / (hxLeft * hxRight)) + sy + sz) * mask[mid]; // middle
+		val[(d * 7) + 1] = (diff[ix + 1] * 2.0 / (hxLeft * (hxLeft + hxRight)) +
+							   (diff[ix] - diff[ix + 2]) /
+								   ((hxLeft + hxRight) * (hxLeft + hxRight))) *
+			mask[left]; // left
+		val[(d * 7) + 2] =
+			(diff[ix + 1] * 2.0 / (hxRight * (hxLeft + hxRight)) +
+				(diff[ix + 2] - diff[ix]) /
 					((hxLeft + hxRight) * (hxLeft + hxRight))) *
-			diffusionGrid[iz + 1][iy + 1][ix + 2][diffClusterIdx]; // right
-		val[(diffClusterIdx * 7) + 3] =
-			cluster.getDiffusionCoefficient(ix + 1) * sy *
-			diffusionGrid[iz + 1][iy][ix + 1][diffClusterIdx]; // bottom
-		val[(diffClusterIdx * 7) + 4] =
-			cluster.getDiffusionCoefficient(ix + 1) * sy *
-			diffusionGrid[iz + 1][iy + 2][ix + 1][diffClusterIdx]; // top
-		val[(diffClusterIdx * 7) + 5] =
-			cluster.getDiffusionCoefficient(ix + 1) * sz *
-			diffusionGrid[iz][iy + 1][ix + 1][diffClusterIdx]; // front
-		val[(diffClusterIdx * 7) + 6] =
-			cluster.getDiffusionCoefficient(ix + 1) * sz *
-			diffusionGrid[iz + 2][iy + 1][ix + 1][diffClusterIdx]; // back
-
-		// Increase the index
-		diffClusterIdx++;
+			mask[right]; // right
+		val[(d * 7) + 3] = diff[ix + 1] * sy * mask[bottom]; // bottom
+		val[(d * 7) + 4] = diff[ix + 1] * sy * mask[top]; // top
+		val[(d * 7) + 5] = diff[ix + 1] * sz * mask[front]; // front
+		val[(d * 7) + 6] = diff[ix + 1] * sz * mask[back]; // back
 	}
 
 	return;
@@ -0,0 +1,142 @@
+// Includes
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include <xolotl/core/diffusion/DiffusionHandler.h>
+
+namespace xolotl
+{
+namespace core
+{
+namespace diffusion
+{
+void
+DiffusionHandler::removeAdvectingClusters(
+	const std::vector<IdType>& advecClusters, int i, int j, int k)
+{
+	const auto pointIndex = getGridPointIndex(i, j, k);
+	for (auto const currAdvCluster : advecClusters) {
+		// We have to find the corresponding reactant in the diffusion
+		// cluster collection.
+		auto it = std::find(
+			diffusingClusters.begin(), diffusingClusters.end(), currAdvCluster);
+		if (it == diffusingClusters.end()) {
+			throw std::runtime_error("\nThe advecting cluster of id: " +
+				std::to_string(currAdvCluster) +
+				" was not found in the diffusing clusters, cannot "
+				"use the diffusion!");
+		}
+
+		// Set this diffusion grid value to false
+		auto diffClusterIdx = it - diffusingClusters.begin();
+		diffusionGrid[diffClusterIdx * nGridPoints + pointIndex] = 0;
+	}
+}
+
+const double*
+DiffusionHandler::getDiffusionCoefficients(
+	network::IReactionNetwork& network) const
+{
+	auto version = network.getDiffusionCoefficientsVersion();
+	if (version != diffusionCoefsVersion ||
+		diffusionCoefs.size() !=
+			diffusingClusters.size() * network.getGridSize()) {
+		network.getDiffusionCoefficients(diffusingClusters, diffusionCoefs);
+		diffusionCoefsVersion = version;
+	}
+
+	return diffusionCoefs.data();
+}
+
+void
+DiffusionHandler::computeLineDiffusion(network::IReactionNetwork& network,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	int nTransverse, const std::size_t* maskRows, const double* s) const
+{
+	const std::size_t nDiff = diffusingClusters.size();
+	if (nDiff == 0 || xm <= 0)
+		return;
+
+	const double* coefs = getDiffusionCoefficients(network);
+	const std::size_t coefsGridSize = network.getGridSize();
+
+	// The factors of the stencil in the x direction at each point
+	stencilFactors.resize(3 * xm);
+	double* midFactor = stencilFactors.data();
+	double* ratio = midFactor + xm;
+	double* gradFactor = ratio + xm;
+	for (int i = 0; i < xm; i++) {
+		midFactor[i] = 2.0 / (hxLeft[i] * (hxLeft[i] + hxRight[i]));
+		ratio[i] = hxLeft[i] / hxRight[i];
+		gradFactor[i] =
+			1.0 / ((hxLeft[i] + hxRight[i]) * (hxLeft[i] + hxRight[i]));
+	}
+
+	// The middle line has two more points for the left and right neighbors
+	lineConcs.resize((xm + 2) + 2 * nTransverse * xm);
+	lineFluxes.resize(2 * xm);
+	double* midConcs = lineConcs.data();
+	double* flux = lineFluxes.data();
+	double* transverse = flux + xm;
+
+	for (std::size_t d = 0; d < nDiff; d++) {
+		const auto currId = diffusingClusters[d];
+		const std::uint8_t* mask = diffusionGrid.data() + d * nGridPoints;
+		const double* diff = coefs + d * coefsGridSize;
+
+		// Gather the concentrations of this cluster on the middle line from
+		// the left ghost to the right one
+		double** midLine = concLines[0];
+		const std::uint8_t* midMask = mask + maskRows[0];
+		for (int i = 0; i < xm + 2; i++) {
+			midConcs[i] = midLine[xs - 1 + i][currId] * midMask[i];
+		}
+
+		// Gather the neighbor lines and add their contribution
+		std::fill(transverse, transverse + xm, 0.0);
+		for (int n = 0; n < nTransverse; n++) {
+			double* lowConcs = midConcs + (xm + 2) + 2 * n * xm;
+			double* highConcs = lowConcs + xm;
+			double** lowLine = concLines[1 + 2 * n];
+			double** highLine = concLines[2 + 2 * n];
+			const std::uint8_t* lowMask = mask + maskRows[1 + 2 * n] + 1;
+			const std::uint8_t* highMask = mask + maskRows[2 + 2 * n] + 1;
+			for (int i = 0; i < xm; i++) {
+				lowConcs[i] = lowLine[xs + i][currId] * lowMask[i];
+				highConcs[i] = highLine[xs + i][currId] * highMask[i];
+			}
+			const double sn = s[n];
+			for (int i = 0; i < xm; i++) {
+				transverse[i] +=
+					sn * (lowConcs[i] + highConcs[i] - 2.0 * midConcs[i + 1]);
+			}
+		}
+
+		// Use a simple midpoint stencil to compute the flux at each point,
+		// only reading contiguous buffers
+		for (int i = 0; i < xm; i++) {
+			const double oldLeftConc = midConcs[i];
+			const double oldConc = midConcs[i + 1];
+			const double oldRightConc = midConcs[i + 2];
+			flux[i] = diff[i + 1] *
+					(midFactor[i] *
+							(oldLeftConc + ratio[i] * oldRightConc -
+								(1.0 + ratio[i]) * oldConc) +
+						transverse[i]) +
+				(diff[i + 2] - diff[i]) * (oldRightConc - oldLeftConc) *
+					gradFactor[i];
+		}
+
+		// Update the concentration of the cluster
+		for (int i = 0; i < xm; i++) {
+			if (pointMask[i])
+				updatedConcLine[xs + i][currId] += flux[i];
+		}
+	}
+}
+
+} /* end namespace diffusion */
+} /* end namespace core */
+} /* end namespace xolotl */
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iostream>
@@ -16,7 +17,10 @@ namespace flux
 FluxHandler::FluxHandler(const options::IOptions& options) :
 	fluxAmplitude(0.0),
 	useTimeProfile(false),
-	normFactor(0.0)
+	normFactor(0.0),
+	profileSurfacePos(0),
+	profileTime(std::numeric_limits<double>::quiet_NaN()),
+	profileInterval(0)
 {
 	// Initialize the fluence vector
 	fluence.push_back(0.0);
@@ -50,6 +54,22 @@ FluxHandler::initializeFluxHandler(network::IReactionNetwork& network,
 		return;
 	}
 
+	// Compute the profile of the flux
+	computeFluxProfile(surfacePos);
+
+	// Clear the flux vector
+	incidentFluxVec.clear();
+	incidentFluxVec.emplace_back(fluxProfile.size(), 0.0);
+
+	// Scale it with the amplitude
+	recomputeFluxHandler(surfacePos);
+
+	return;
+}
+
+void
+FluxHandler::computeFluxProfile(int surfacePos)
+{
 	// Compute the norm factor because the fit function has an
 	// arbitrary amplitude
 	normFactor = 0.0;
@@ -63,18 +83,16 @@ FluxHandler::initializeFluxHandler(network::IReactionNetwork& network,
 		normFactor += FitFunction(x) * (xGrid[i + 1] - xGrid[i]);
 	}
 
-	// Factor the incident flux will be multiplied by to get
-	// the wanted intensity
-	double fluxNormalized = 0.0;
+	// Factor the fit function will be multiplied by to get a unit amplitude
+	double unitNormalized = 0.0;
 	if (normFactor > 0.0)
-		fluxNormalized = fluxAmplitude / normFactor;
+		unitNormalized = 1.0 / normFactor;
 
-	// Clear the flux vector
-	incidentFluxVec.clear();
+	// Clear the profile
+	fluxProfile.clear();
 	// The first value corresponding to the surface position should always be
 	// 0.0
-	std::vector<double> tempVector;
-	tempVector.push_back(0.0);
+	fluxProfile.push_back(0.0);
 
 	// Starts a i = surfacePos + 1 because the first value was already put in
 	// the vector
@@ -82,17 +100,14 @@ FluxHandler::initializeFluxHandler(network::IReactionNetwork& network,
 		// Get the x position
 		auto x = (xGrid[i] + xGrid[i + 1]) / 2.0 - xGrid[surfacePos + 1];
 
-		// Compute the flux value
-		double incidentFlux = fluxNormalized * FitFunction(x);
-		// Add it to the vector
-		tempVector.push_back(incidentFlux);
+		// Compute the profile value
+		fluxProfile.push_back(unitNormalized * FitFunction(x));
 	}
 
 	// The last value should always be 0.0 because of boundary conditions
-	tempVector.push_back(0.0);
+	fluxProfile.push_back(0.0);
 
-	// Add it to the vector of fluxes
-	incidentFluxVec.push_back(tempVector);
+	profileSurfacePos = surfacePos;
 
 	return;
 }
@@ -100,21 +115,17 @@ FluxHandler::initializeFluxHandler(network::IReactionNetwork& network,
 void
 FluxHandler::recomputeFluxHandler(int surfacePos)
 {
-	// Factor the incident flux will be multiplied by
-	double fluxNormalized = 0.0;
-	if (normFactor > 0.0)
-		fluxNormalized = fluxAmplitude / normFactor;
-
-	// Starts at i = surfacePos + 1 because the first values were already put in
-	// the vector
-	for (int i = surfacePos + 1; i < xGrid.size() - 3; i++) {
-		// Get the x position
-		auto x = (xGrid[i] + xGrid[i + 1]) / 2.0 - xGrid[surfacePos + 1];
+	// The profile only has to be computed again if the surface moved
+	if (surfacePos != profileSurfacePos ||
+		fluxProfile.size() != incidentFluxVec[0].size()) {
+		computeFluxProfile(surfacePos);
+		incidentFluxVec[0].resize(fluxProfile.size());
+	}
 
-		// Compute the flux value
-		double incidentFlux = fluxNormalized * FitFunction(x);
-		// Add it to the vector
-		incidentFluxVec[0][i - surfacePos] = incidentFlux;
+	// Scale the profile with the amplitude
+	auto& fluxVec = incidentFluxVec[0];
+	for (std::size_t i = 0; i < fluxProfile.size(); i++) {
+		fluxVec[i] = fluxAmplitude * fluxProfile[i];
 	}
 
 	return;
@@ -146,34 +157,43 @@ FluxHandler::initializeTimeProfile(const std::string& fileName)
 double
 FluxHandler::getProfileAmplitude(double currentTime) const
 {
-	// Initialize the amplitude to return
-	double f = 0.0;
-
 	// If the time is smaller than or equal than the first stored time
 	if (currentTime <= time[0])
-		return f = amplitudes[0];
+		return amplitudes[0];
 
 	// If the time is larger or equal to the last stored time
 	if (currentTime >= time[time.size() - 1])
-		return f = amplitudes[time.size() - 1];
+		return amplitudes[time.size() - 1];
+
+	// Determine the interval the time falls in, i.e.
+	// time[k] <= time <= time[k + 1], starting with the last one used
+	auto k = profileInterval;
+	if (k + 1 >= time.size() || currentTime < time[k] ||
+		currentTime > time[k + 1]) {
+		// Binary search for the first stored time larger than the time
+		auto it = std::upper_bound(time.begin(), time.end(), currentTime);
+		k = (it - time.begin()) - 1;
+		profileInterval = k;
+	}
 
-	// Else loop to determine the interval the time falls in
-	// i.e. time[k] < time < time[k + 1]
-	for (unsigned int k = 0; k < time.size() - 1; k++) {
-		if (currentTime < time[k])
-			continue;
-		if (currentTime > time[k + 1])
-			continue;
+	// Compute the amplitude following a linear interpolation between
+	// the two stored values
+	return amplitudes[k] +
+		(amplitudes[k + 1] - amplitudes[k]) * (currentTime - time[k]) /
+		(time[k + 1] - time[k]);
+}
 
-		// Compute the amplitude following a linear interpolation between
-		// the two stored values
-		f = amplitudes[k] +
-			(amplitudes[k + 1] - amplitudes[k]) * (currentTime - time[k]) /
-				(time[k + 1] - time[k]);
-		break;
-	}
+bool
+FluxHandler::updateProfileAmplitude(double currentTime)
+{
+	// Nothing to do if the time didn't change
+	if (currentTime == profileTime)
+		return false;
+
+	fluxAmplitude = getProfileAmplitude(currentTime);
+	profileTime = currentTime;
 
-	return f;
+	return true;
 }
 
 void
@@ -184,10 +204,15 @@ FluxHandler::computeIncidentFlux(
 	if (fluxIndices.size() == 0)
 		return;
 
-	// Recompute the flux vector if a time profile is used
+	// Recompute the flux vector if a time profile is used and the time
+	// changed, or if the surface differs from the one of the profile (each
+	// line of a 2D/3D grid has its own)
 	if (useTimeProfile) {
-		fluxAmplitude = getProfileAmplitude(currentTime);
-		recomputeFluxHandler(surfacePos);
+		bool timeChanged = updateProfileAmplitude(currentTime);
+		if ((timeChanged || surfacePos != profileSurfacePos) &&
+			incidentFluxVec[0].size() > 0) {
+			recomputeFluxHandler(surfacePos);
+		}
 	}
 
 	if (incidentFluxVec[0].size() == 0) {
@@ -27,7 +27,6 @@ HeatEquationHandler::HeatEquationHandler(
 	heatConductivity(0.0),
 	zeroFlux(util::equal(heatFlux, 0.0)),
 	dimension(dim),
-	oldConcBox(dimension, {0.0, 0.0}),
 	interfaceLoc(0.0),
 	fluxFile(filename)
 {
@@ -135,66 +134,157 @@ HeatEquationHandler::computeTemperature(double currentTime, double** concVector,
 		return;
 	}
 
+	// Consider this point as a line of one point, at position 1 in the
+	// lines
+	double* midPoints[3] = {concVector[1], concVector[0], concVector[2]};
+	double* otherPoints[4][2] = {};
+	double** concLines[5] = {midPoints};
+	for (int d = 1; d < dimension; ++d) {
+		otherPoints[2 * d - 2][1] = concVector[2 * d + 1];
+		otherPoints[2 * d - 1][1] = concVector[2 * d + 2];
+		concLines[2 * d - 1] = otherPoints[2 * d - 2];
+		concLines[2 * d] = otherPoints[2 * d - 1];
+	}
+	double* updatedLine[2] = {nullptr, updatedConcOffset};
+	const std::uint8_t pointMask[1] = {1};
+
+	computeLineTemperature(getHeatFlux(currentTime), concLines, updatedLine,
+		&hxLeft, &hxRight, pointMask, 1, xi, 1, sy, sz);
+}
+
+void
+HeatEquationHandler::computeTemperatureLine(double currentTime,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	double sy, int iy, double sz, int iz)
+{
+	// Skip if the flux is 0
+	if (zeroFlux) {
+		return;
+	}
+
+	// The heat flux is the same for the whole line
+	computeLineTemperature(getHeatFlux(currentTime), concLines,
+		updatedConcLine, hxLeft, hxRight, pointMask, xs, xs, xm, sy, sz);
+}
+
+void
+HeatEquationHandler::computeLineProperties(
+	double*** concLines, int lineStart, int xs, int n, bool withPartials)
+{
 	// Initial declaration
-	int index = this->_dof;
+	const int index = this->_dof;
 
-	auto heatFlux = getHeatFlux(currentTime);
+	midTemps.resize(n);
+	leftTemps.resize(n);
+	rightTemps.resize(n);
+	alphas.resize(n);
+	betas.resize(n);
+	gammas.resize(n);
+	dAlphas.resize(n);
+	dBetas.resize(n);
 
 	// Get the initial concentrations
-	double oldConc = concVector[0][index];
-	for (int d = 0; d < dimension; ++d) {
-		oldConcBox[d][0] = concVector[2 * d + 1][index];
-		oldConcBox[d][1] = concVector[2 * d + 2][index];
+	double** midLine = concLines[0];
+	for (int p = 0; p < n; ++p) {
+		midTemps[p] = midLine[lineStart + p][index];
+		leftTemps[p] = midLine[lineStart + p - 1][index];
+		rightTemps[p] = midLine[lineStart + p + 1][index];
 	}
 
 	// Adjust the parameters
-	double alpha = getLocalHeatAlpha(xi), beta = getLocalHeatBeta(oldConc),
-		   gamma = getLocalHeatGamma(oldConc), dAlpha = getDAlpha(xi),
-		   dBeta = getDBeta(oldConc);
-
-	double s[3] = {0, sy, sz};
-
-	double x1 = xGrid[xi] - xGrid[surfacePosition + 1];
-	double x2 = xGrid[xi + 1] - xGrid[surfacePosition + 1];
-
-	// Surface and interface
-	if (xi == surfacePosition or (interfaceLoc > x1 and interfaceLoc <= x2)) {
-		// Boundary condition with heat flux
-		updatedConcOffset[index] += (2.0 * heatFlux * gamma / hxLeft) +
-			(2.0 * alpha * beta * gamma) * (oldConcBox[0][1] - oldConc) /
-				(hxLeft * hxRight);
-		// Second term for temperature dependent conductivity
-		updatedConcOffset[index] += -heatFlux * dAlpha * gamma / alpha +
-			heatFlux * heatFlux * gamma * dBeta / (alpha * beta * beta);
+	for (int p = 0; p < n; ++p) {
+		alphas[p] = getLocalHeatAlpha(xs + p);
+		dAlphas[p] = getDAlpha(xs + p);
 	}
-	else if (xi == bulkPosition) {
-		// Boundary condition with heat flux
-		double bulkHeatFlux = getBulkHeatFlux(oldConc);
-		updatedConcOffset[index] += -(2.0 * bulkHeatFlux * gamma / hxRight) +
-			(2.0 * alpha * beta * gamma) * (oldConcBox[0][0] - oldConc) /
-				(hxLeft * hxRight);
-		// Second term for temperature dependent conductivity
-		updatedConcOffset[index] += -bulkHeatFlux * dAlpha * gamma / alpha +
-			bulkHeatFlux * bulkHeatFlux * gamma * dBeta / (alpha * beta * beta);
+	for (int p = 0; p < n; ++p) {
+		double temp = midTemps[p];
+		betas[p] = getLocalHeatBeta(temp);
+		gammas[p] = getLocalHeatGamma(temp);
+		dBetas[p] = getDBeta(temp);
 	}
-	else {
-		// Use a simple midpoint stencil to compute the concentration
-		updatedConcOffset[index] += 2.0 * alpha * beta * gamma *
-			(oldConcBox[0][0] + (hxLeft / hxRight) * oldConcBox[0][1] -
-				(1.0 + (hxLeft / hxRight)) * oldConc) /
-			(hxLeft * (hxLeft + hxRight));
-		// Second term for temperature dependent conductivity
-		updatedConcOffset[index] += dAlpha * beta * gamma *
-				(oldConcBox[0][1] - oldConcBox[0][0]) / (hxLeft + hxRight) +
-			alpha * dBeta * gamma * (oldConcBox[0][1] - oldConcBox[0][0]) *
-				(oldConcBox[0][1] - oldConcBox[0][0]) /
-				((hxLeft + hxRight) * (hxLeft + hxRight));
+
+	if (!withPartials)
+		return;
+
+	dGammas.resize(n);
+	ddBetas.resize(n);
+	for (int p = 0; p < n; ++p) {
+		double temp = midTemps[p];
+		dGammas[p] = getDGamma(temp);
+		ddBetas[p] = getDDBeta(temp);
 	}
+}
 
-	// Deal with the potential additional dimensions
-	for (int d = 1; d < dimension; ++d) {
-		updatedConcOffset[index] += alpha * beta * gamma * s[d] *
-			(oldConcBox[d][0] + oldConcBox[d][1] - 2.0 * oldConc);
+void
+HeatEquationHandler::computeLineTemperature(double heatFlux,
+	double*** concLines, double** updatedConcLine, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int lineStart,
+	int xs, int n, double sy, double sz)
+{
+	// Initial declaration
+	const int index = this->_dof;
+
+	computeLineProperties(concLines, lineStart, xs, n, false);
+
+	double s[3] = {0, sy, sz};
+
+	for (int p = 0; p < n; ++p) {
+		if (!pointMask[p])
+			continue;
+
+		const int xi = xs + p;
+		double* updatedConcOffset = updatedConcLine[lineStart + p];
+		double oldConc = midTemps[p], oldLeftConc = leftTemps[p],
+			   oldRightConc = rightTemps[p];
+		double alpha = alphas[p], beta = betas[p], gamma = gammas[p],
+			   dAlpha = dAlphas[p], dBeta = dBetas[p];
+		double hl = hxLeft[p], hr = hxRight[p];
+
+		double x1 = xGrid[xi] - xGrid[surfacePosition + 1];
+		double x2 = xGrid[xi + 1] - xGrid[surfacePosition + 1];
+
+		// Surface and interface
+		if (xi == surfacePosition or
+			(interfaceLoc > x1 and interfaceLoc <= x2)) {
+			// Boundary condition with heat flux
+			updatedConcOffset[index] += (2.0 * heatFlux * gamma / hl) +
+				(2.0 * alpha * beta * gamma) * (oldRightConc - oldConc) /
+					(hl * hr);
+			// Second term for temperature dependent conductivity
+			updatedConcOffset[index] += -heatFlux * dAlpha * gamma / alpha +
+				heatFlux * heatFlux * gamma * dBeta / (alpha * beta * beta);
+		}
+		else if (xi == bulkPosition) {
+			// Boundary condition with heat flux
+			double bulkHeatFlux = getBulkHeatFlux(oldConc);
+			updatedConcOffset[index] += -(2.0 * bulkHeatFlux * gamma / hr) +
+				(2.0 * alpha * beta * gamma) * (oldLeftConc - oldConc) /
+					(hl * hr);
+			// Second term for temperature dependent conductivity
+			updatedConcOffset[index] += -bulkHeatFlux * dAlpha * gamma / alpha +
+				bulkHeatFlux * bulkHeatFlux * gamma * dBeta /
+					(alpha * beta * beta);
+		}
+		else {
+			// Use a simple midpoint stencil to compute the concentration
+			updatedConcOffset[index] += 2.0 * alpha * beta * gamma *
+				(oldLeftConc + (hl / hr) * oldRightConc -
+					(1.0 + (hl / hr)) * oldConc) /
+				(hl * (hl + hr));
+			// Second term for temperature dependent conductivity
+			updatedConcOffset[index] += dAlpha * beta * gamma *
+					(oldRightConc - oldLeftConc) / (hl + hr) +
+				alpha * dBeta * gamma * (oldRightConc - oldLeftConc) *
+					(oldRightConc - oldLeftConc) / ((hl + hr) * (hl + hr));
+		}
+
+		// Deal with the potential additional dimensions
+		for (int d = 1; d < dimension; ++d) {
+			updatedConcOffset[index] += alpha * beta * gamma * s[d] *
+				(concLines[2 * d - 1][lineStart + p][index] +
+					concLines[2 * d][lineStart + p][index] - 2.0 * oldConc);
+		}
 	}
 }
 
@@ -208,92 +298,130 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 		return false;
 	}
 
-	// Initial declaration
-	int index = this->_dof;
+	// Get the DOF
+	indices[0] = this->_dof;
 
-	auto heatFlux = getHeatFlux(currentTime);
+	// Consider this point as a line of one point, at position 1 in the
+	// line
+	double* midPoints[3] = {concVector[1], concVector[0], concVector[2]};
+	double** concLines[1] = {midPoints};
+	const std::uint8_t pointMask[1] = {1};
 
-	// Get the initial concentrations
-	double oldConc = concVector[0][index];
-	for (int d = 0; d < dimension; ++d) {
-		oldConcBox[d][0] = concVector[2 * d + 1][index];
-		oldConcBox[d][1] = concVector[2 * d + 2][index];
+	computeLinePartials(getHeatFlux(currentTime), concLines, val, &hxLeft,
+		&hxRight, pointMask, 1, xi, 1, sy, sz);
+
+	return true;
+}
+
+bool
+HeatEquationHandler::computePartialsForTemperatureLine(double currentTime,
+	double*** concLines, double* val, IdType* indices, const double* hxLeft,
+	const double* hxRight, const std::uint8_t* pointMask, int xs, int xm,
+	double sy, int iy, double sz, int iz)
+{
+	// Skip if the flux is 0
+	if (zeroFlux) {
+		return false;
 	}
 
 	// Get the DOF
-	indices[0] = index;
+	indices[0] = this->_dof;
+
+	// The heat flux is the same for the whole line
+	computeLinePartials(getHeatFlux(currentTime), concLines, val, hxLeft,
+		hxRight, pointMask, xs, xs, xm, sy, sz);
+
+	return true;
+}
+
+void
+HeatEquationHandler::computeLinePartials(double heatFlux, double*** concLines,
+	double* vals, const double* hxLeft, const double* hxRight,
+	const std::uint8_t* pointMask, int lineStart, int xs, int n, double sy,
+	double sz)
+{
+	computeLineProperties(concLines, lineStart, xs, n, true);
 
 	double s[3] = {0, sy, sz};
+	const int stride = 2 * dimension + 1;
 
-	double alpha = getLocalHeatAlpha(xi), beta = getLocalHeatBeta(oldConc),
-		   gamma = getLocalHeatGamma(oldConc), dAlpha = getDAlpha(xi),
-		   dBeta = getDBeta(oldConc), dGamma = getDGamma(oldConc),
-		   ddBeta = getDDBeta(oldConc);
-
-	// Compute the partials along the depth
-	val[0] = -2.0 * alpha * beta * gamma / (hxLeft * hxRight) +
-		alpha * (ddBeta * gamma + dGamma * dBeta) *
-			(oldConcBox[0][1] - oldConcBox[0][0]) *
-			(oldConcBox[0][1] - oldConcBox[0][0]) /
-			((hxLeft + hxRight) * (hxLeft + hxRight)) +
-		2.0 * alpha * (dBeta * gamma + beta * dGamma) *
-			(oldConcBox[0][0] + (hxLeft / hxRight) * oldConcBox[0][1] -
-				(1.0 + (hxLeft / hxRight)) * oldConc) /
-			((hxLeft + hxRight) * hxLeft) +
-		dAlpha * (dBeta * gamma + dGamma * beta) *
-			(oldConcBox[0][1] - oldConcBox[0][0]) / (hxLeft + hxRight);
-	val[1] = 2.0 * alpha * beta * gamma / (hxLeft * (hxLeft + hxRight)) -
-		beta * dAlpha * gamma / (hxLeft + hxRight) +
-		2.0 * alpha * dBeta * gamma * (oldConcBox[0][0] - oldConcBox[0][1]) /
-			((hxLeft + hxRight) * (hxLeft + hxRight));
-	val[2] = 2.0 * alpha * beta * gamma / (hxRight * (hxLeft + hxRight)) +
-		beta * dAlpha * gamma / (hxLeft + hxRight) +
-		2.0 * alpha * dBeta * gamma * (oldConcBox[0][1] - oldConcBox[0][0]) /
-			((hxLeft + hxRight) * (hxLeft + hxRight));
-
-	// Deal with the potential additional dimensions
-	for (int d = 1; d < dimension; ++d) {
-		val[0] -= 2.0 * alpha * beta * gamma * s[d];
-		val[2 * d + 1] = alpha * beta * gamma * s[d];
-		val[2 * d + 2] = alpha * beta * gamma * s[d];
-	}
+	for (int p = 0; p < n; ++p) {
+		if (!pointMask[p])
+			continue;
 
-	double x1 = xGrid[xi] - xGrid[surfacePosition + 1];
-	double x2 = xGrid[xi + 1] - xGrid[surfacePosition + 1];
-
-	// Boundary condition with the heat flux
-	if (xi == surfacePosition or (interfaceLoc > x1 and interfaceLoc <= x2)) {
-		val[0] = 2.0 * heatFlux * dGamma / hxLeft -
-			2.0 * alpha * beta * gamma / (hxLeft * hxRight) +
-			2.0 * alpha * (dBeta * gamma + dGamma * beta) *
-				(oldConcBox[0][1] - oldConc) / (hxLeft * hxRight) -
-			heatFlux * dGamma * dAlpha / alpha +
-			heatFlux * heatFlux * (gamma * ddBeta + dGamma * dBeta) /
-				(alpha * beta * beta) -
-			2.0 * heatFlux * heatFlux * gamma * dBeta * dBeta *
-				(alpha * beta * beta * beta);
-		val[1] = 0.0;
-		val[2] = 2.0 * alpha * beta * gamma / (hxLeft * hxRight);
-	}
-	else if (xi == bulkPosition) {
-		double bulkHeatFlux = getBulkHeatFlux(oldConc);
-		double dBulk = getBulkHeatFluxDerivative(oldConc);
-		val[0] = -2.0 * bulkHeatFlux * dGamma / hxRight -
-			2.0 * alpha * beta * gamma / (hxLeft * hxRight) +
-			2.0 * alpha * (dBeta * gamma + dGamma * beta) *
-				(oldConcBox[0][0] - oldConc) / (hxLeft * hxRight) -
-			bulkHeatFlux * dAlpha * dGamma / alpha +
-			bulkHeatFlux * bulkHeatFlux * (gamma * ddBeta + dGamma * dBeta) /
-				(alpha * beta * beta) -
-			2.0 * bulkHeatFlux * bulkHeatFlux * gamma * dBeta * dBeta *
-				(alpha * beta * beta * beta) -
-			dBulk * gamma * dAlpha / alpha - 2.0 * dBulk * gamma / hxRight +
-			2.0 * bulkHeatFlux * dBulk * gamma * dBeta / (alpha * beta * beta);
-		val[1] = 2.0 * alpha * beta * gamma / (hxLeft * hxRight);
-		val[2] = 0.0;
-	}
+		const int xi = xs + p;
+		double* val = vals + p * stride;
+		double oldConc = midTemps[p], oldLeftConc = leftTemps[p],
+			   oldRightConc = rightTemps[p];
+		double alpha = alphas[p], beta = betas[p], gamma = gammas[p],
+			   dAlpha = dAlphas[p], dBeta = dBetas[p], dGamma = dGammas[p],
+			   ddBeta = ddBetas[p];
+		double hl = hxLeft[p], hr = hxRight[p];
+
+		// Compute the partials along the depth
+		val[0] = -2.0 * alpha * beta * gamma / (hl * hr) +
+			alpha * (ddBeta * gamma + dGamma * dBeta) *
+				(oldRightConc - oldLeftConc) * (oldRightConc - oldLeftConc) /
+				((hl + hr) * (hl + hr)) +
+			2.0 * alpha * (dBeta * gamma + beta * dGamma) *
+				(oldLeftConc + (hl / hr) * oldRightConc -
+					(1.0 + (hl / hr)) * oldConc) /
+				((hl + hr) * hl) +
+			dAlpha * (dBeta * gamma + dGamma * beta) *
+				(oldRightConc - oldLeftConc) / (hl + hr);
+		val[1] = 2.0 * alpha * beta * gamma / (hl * (hl + hr)) -
+			beta * dAlpha * gamma / (hl + hr) +
+			2.0 * alpha * dBeta * gamma * (oldLeftConc - oldRightConc) /
+				((hl + hr) * (hl + hr));
+		val[2] = 2.0 * alpha * beta * gamma / (hr * (hl + hr)) +
+			beta * dAlpha * gamma / (hl + hr) +
+			2.0 * alpha * dBeta * gamma * (oldRightConc - oldLeftConc) /
+				((hl + hr) * (hl + hr));
+
+		// Deal with the potential additional dimensions
+		for (int d = 1; d < dimension; ++d) {
+			val[0] -= 2.0 * alpha * beta * gamma * s[d];
+			val[2 * d + 1] = alpha * beta * gamma * s[d];
+			val[2 * d + 2] = alpha * beta * gamma * s[d];
+		}
 
-	return true;
+		double x1 = xGrid[xi] - xGrid[surfacePosition + 1];
+		double x2 = xGrid[xi + 1] - xGrid[surfacePosition + 1];
+
+		// Boundary condition with the heat flux
+		if (xi == surfacePosition or
+			(interfaceLoc > x1 and interfaceLoc <= x2)) {
+			val[0] = 2.0 * heatFlux * dGamma / hl -
+				2.0 * alpha * beta * gamma / (hl * hr) +
+				2.0 * alpha * (dBeta * gamma + dGamma * beta) *
+					(oldRightConc - oldConc) / (hl * hr) -
+				heatFlux * dGamma * dAlpha / alpha +
+				heatFlux * heatFlux * (gamma * ddBeta + dGamma * dBeta) /
+					(alpha * beta * beta) -
+				2.0 * heatFlux * heatFlux * gamma * dBeta * dBeta *
+					(alpha * beta * beta * beta);
+			val[1] = 0.0;
+			val[2] = 2.0 * alpha * beta * gamma / (hl * hr);
+		}
+		else if (xi == bulkPosition) {
+			double bulkHeatFlux = getBulkHeatFlux(oldConc);
+			double dBulk = getBulkHeatFluxDerivative(oldConc);
+			val[0] = -2.0 * bulkHeatFlux * dGamma / hr -
+				2.0 * alpha * beta * gamma / (hl * hr) +
+				2.0 * alpha * (dBeta * gamma + dGamma * beta) *
+					(oldLeftConc - oldConc) / (hl * hr) -
+				bulkHeatFlux * dAlpha * dGamma / alpha +
+				bulkHeatFlux * bulkHeatFlux *
+					(gamma * ddBeta + dGamma * dBeta) / (alpha * beta * beta) -
+				2.0 * bulkHeatFlux * bulkHeatFlux * gamma * dBeta * dBeta *
+					(alpha * beta * beta * beta) -
+				dBulk * gamma * dAlpha / alpha - 2.0 * dBulk * gamma / hr +
+				2.0 * bulkHeatFlux * dBulk * gamma * dBeta /
+					(alpha * beta * beta);
+			val[1] = 2.0 * alpha * beta * gamma / (hl * hr);
+			val[2] = 0.0;
+		}
+	}
 }
 
 double
@@ -7,6 +7,7 @@
 #include <xolotl/factory/solver/SolverFactory.h>
 #include <xolotl/factory/viz/VizHandlerFactory.h>
 #include <xolotl/interface/Interface.h>
+#include <xolotl/io/CheckpointWriter.h>
 #include <xolotl/options/Options.h>
 #include <xolotl/perf/IPerfHandler.h>
 #include <xolotl/solver/Solver.h>
@@ -27,9 +28,19 @@ public:
 				std::make_unique<Kokkos::ScopeGuard>(
 					argc, const_cast<char**>(argv)) :
 				nullptr)
+	{
+	}
+
+	/**
+	 * Initialize MPI unless the caller already did.
+	 *
+	 * @param threadMultiple Whether to ask for full thread support
+	 */
+	void
+	initializeMPI(int& argc, const char* argv[], bool threadMultiple)
 	{
 		if (!initialized()) {
-			util::mpiInit(argc, argv);
+			util::mpiInit(argc, argv, threadMultiple);
 			_mpiInitializedHere = true;
 		}
 	}
@@ -107,6 +118,14 @@ XolotlInterface::initializeXolotl(int& argc, const char* argv[], MPI_Comm comm)
 try {
 	context = std::make_unique<Context>(argc, argv);
 
+	// The options are read first because they decide whether MPI needs full
+	// thread support, which is only the case for the background checkpoints
+	// with a thread-safe HDF5 build
+	options::Options opts;
+	opts.readParams(argc, argv);
+	context->initializeMPI(argc, argv,
+		opts.useCheckpointThread() && io::CheckpointWriter::isHDF5ThreadSafe());
+
 	// Initialize the MPI communicator to use
 	util::setMPIComm(comm);
 	auto xolotlComm = util::getMPIComm();
@@ -115,9 +134,6 @@ try {
 	int rank;
 	MPI_Comm_rank(xolotlComm, &rank);
 
-	options::Options opts;
-	opts.readParams(argc, argv);
-
 	if (rank == 0) {
 		// Print the start message
 		XOLOTL_LOG << "Starting Xolotl (" << getExactVersionString() << ")\n";
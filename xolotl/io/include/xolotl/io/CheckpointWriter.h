@@ -0,0 +1,126 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <xolotl/io/XFile.h>
+
+namespace xolotl
+{
+namespace io
+{
+/**
+ * Writes the checkpoints of a run into a checkpoint file that stays open
+ * between them.
+ *
+ * When both MPI (MPI_THREAD_MULTIPLE) and HDF5 (thread-safe build) allow
+ * it, each checkpoint is written by a background thread on its own
+ * duplicate of the communicator, so the solver only waits if the previous
+ * checkpoint is still being written when the next one is submitted. The
+ * tasks must therefore only use data they own, typically a copy of the
+ * solution taken when they are submitted. Otherwise the tasks are run
+ * right away.
+ */
+class CheckpointWriter
+{
+public:
+	/**
+	 * The work of one checkpoint, given the open file and the communicator
+	 * to use for any collective operation.
+	 */
+	using Task = std::function<void(XFile& file, MPI_Comm comm)>;
+
+	/**
+	 * Open an existing checkpoint file. Collective over the communicator.
+	 *
+	 * @param path Path of the file to open.
+	 * @param comm The MPI communicator used to access the file, it is
+	 * duplicated.
+	 * @param background Whether the checkpoints should be written in the
+	 * background (checkpointThread option), which also requires MPI full
+	 * thread support and a thread-safe HDF5.
+	 */
+	CheckpointWriter(fs::path path, MPI_Comm comm, bool background = false);
+
+	CheckpointWriter(const CheckpointWriter&) = delete;
+	CheckpointWriter&
+	operator=(const CheckpointWriter&) = delete;
+
+	/**
+	 * Wait for the last checkpoint and close the file. Collective over the
+	 * communicator.
+	 */
+	~CheckpointWriter();
+
+	/**
+	 * Is the HDF5 library a thread-safe build? MPI full thread support is
+	 * only worth asking for in that case.
+	 */
+	static bool
+	isHDF5ThreadSafe();
+
+	/**
+	 * Are the checkpoints written in the background?
+	 */
+	bool
+	isAsync() const
+	{
+		return async;
+	}
+
+	/**
+	 * Write a checkpoint, waiting for the previous one first.
+	 *
+	 * @param task The work of the checkpoint.
+	 */
+	void
+	submit(Task task);
+
+	/**
+	 * Wait for the last submitted checkpoint to be on disk. Rethrows the
+	 * error of a failed checkpoint.
+	 */
+	void
+	wait();
+
+private:
+	/**
+	 * The loop of the background thread.
+	 */
+	void
+	run();
+
+	/**
+	 * Run a task and flush the file.
+	 */
+	void
+	write(const Task& task);
+
+	//! The duplicate of the communicator
+	MPI_Comm comm;
+
+	//! The checkpoint file
+	std::unique_ptr<XFile> file;
+
+	//! Whether a background thread writes the checkpoints
+	bool async;
+
+	//! The background thread and its synchronization
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable cond;
+
+	//! The checkpoint being written
+	Task pending;
+	bool busy;
+	bool stop;
+
+	//! The error of the last checkpoint
+	std::exception_ptr error;
+};
+} // namespace io
+} // namespace xolotl
@@ -229,6 +229,11 @@ public:
 		DataSetTBase(const HDF5Object& loc, std::string dsetName,
 			const DataSpace& dspace);
 
+		// Create data set with the given creation properties
+		// (e.g., chunking and filters).
+		DataSetTBase(const HDF5Object& loc, std::string dsetName,
+			const DataSpace& dspace, const PropertyList& createProps);
+
 		// Open existing data set.
 		DataSetTBase(const HDF5Object& loc, std::string dsetName);
 	};
@@ -250,6 +255,13 @@ public:
 		{
 		}
 
+		// Create data set with the given creation properties.
+		DataSet(const HDF5Object& loc, std::string dsetName,
+			const DataSpace& dspace, const PropertyList& createProps) :
+			DataSetTBase<T>(loc, dsetName, dspace, createProps)
+		{
+		}
+
 		// Open existing data set.
 		DataSet(const HDF5Object& loc, std::string dsetName) :
 			DataSetTBase<T>(loc, dsetName)
@@ -337,10 +349,11 @@ public:
 		/// Concise name for Ragged data type.
 		using Ragged2DType = std::vector<std::vector<T>>;
 
-	private:
 		/// Concise name for type of flattened data.
 		using FlatType = std::vector<T>;
 
+	private:
+
 		/**
 		 * Determine the number of values per grid point.
 		 *
@@ -399,6 +412,16 @@ public:
 		Ragged2DType
 		readData(const std::vector<uint32_t>& globalStartingIndices) const;
 
+		/**
+		 * Read our part of the flattened data set.
+		 *
+		 * @param globalStartingIndices Starting indices for each of
+		 * the grid points we own, plus one past.
+		 * @return the part of the flattened data set that we own.
+		 */
+		FlatType
+		readFlatData(const std::vector<uint32_t>& globalStartingIndices) const;
+
 		/**
 		 * Write our part of the ragged data set.
 		 *
@@ -453,6 +476,22 @@ public:
 		 */
 		Ragged2DType
 		read(int baseX, int numX) const;
+
+		/**
+		 * Read data from an existing data set without building the
+		 * ragged representation.
+		 *
+		 * @param baseX Index of the first X point we own.
+		 * @param numX Number of X points we own.
+		 * @param globalStartingIndices Filled with the indices of the
+		 * first item of the X points we own within the flattened data
+		 * set, plus one past the last item.
+		 * @return The flattened data associated with X points in
+		 * [baseX,baseX+numXs).
+		 */
+		FlatType
+		readFlat(int baseX, int numX,
+			std::vector<uint32_t>& globalStartingIndices) const;
 	};
 
 #if READY
@@ -768,6 +807,12 @@ public:
 	{
 		Close();
 	}
+
+	/**
+	 * Write the data buffered for our file to disk.
+	 */
+	void
+	Flush(void) const;
 };
 
 } // namespace io
@@ -25,6 +25,21 @@ HDF5File::DataSetTBase<T>::DataSetTBase(
 	}
 }
 
+template <typename T>
+HDF5File::DataSetTBase<T>::DataSetTBase(const HDF5Object& loc,
+	std::string dsetName, const DataSpace& dspace,
+	const PropertyList& createProps) :
+	DataSetBase(loc, dsetName)
+{
+	setId(H5Dcreate(loc.getId(), dsetName.c_str(), TypeInFile<T>().getId(),
+		dspace.getId(), H5P_DEFAULT, createProps.getId(), H5P_DEFAULT));
+	if (getId() < 0) {
+		std::ostringstream estr;
+		estr << "Failed to create dataset " << getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
 template <typename T>
 HDF5File::DataSetTBase<T>::DataSetTBase(
 	const HDF5Object& loc, std::string dsetName) :
@@ -533,8 +548,21 @@ HDF5File::RaggedDataSet2D<T>::readStartingIndices(int baseX, int numX) const
 }
 
 template <typename T>
-typename HDF5File::RaggedDataSet2D<T>::Ragged2DType
-HDF5File::RaggedDataSet2D<T>::readData(
+typename HDF5File::RaggedDataSet2D<T>::FlatType
+HDF5File::RaggedDataSet2D<T>::readFlat(
+	int baseX, int numX, std::vector<uint32_t>& globalStartingIndices) const
+{
+	// We assume the gridpoint values are indices into the gridpoint array,
+	// so non-negative and base 0.
+	assert(baseX >= 0);
+
+	globalStartingIndices = readStartingIndices(baseX, numX);
+	return readFlatData(globalStartingIndices);
+}
+
+template <typename T>
+typename HDF5File::RaggedDataSet2D<T>::FlatType
+HDF5File::RaggedDataSet2D<T>::readFlatData(
 	const std::vector<uint32_t>& globalStartingIndices) const
 {
 	// Determine the total number of values we own.
@@ -570,6 +598,17 @@ HDF5File::RaggedDataSet2D<T>::readData(
 		comm, "flatData");
 #endif // READY
 
+	return flatData;
+}
+
+template <typename T>
+typename HDF5File::RaggedDataSet2D<T>::Ragged2DType
+HDF5File::RaggedDataSet2D<T>::readData(
+	const std::vector<uint32_t>& globalStartingIndices) const
+{
+	// Read our part of the flattened data.
+	auto flatData = readFlatData(globalStartingIndices);
+
 	// Convert from flat representation to ragged 2D representation.
 	//
 	// First, determine number of points we own.
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <xolotl/io/XFile.h>
+
+namespace xolotl
+{
+namespace io
+{
+/**
+ * Writes the time series of the monitors (retention, surface position,
+ * temperature profile, ...), one row per monitored time step.
+ *
+ * Each series is registered once with the names of its columns, then rows
+ * are added to it and kept in memory. In the text format the rows are
+ * appended to the file of the series, which stays open, once enough of
+ * them are buffered or enough time went by since the last write, so that
+ * several processes may write rows to the same series. In the HDF5
+ * format nothing is written to text files: the rows are handed over with
+ * each checkpoint (see takeRows()) and appended to one extensible dataset
+ * per series in the checkpoint file, as this is the only time all the
+ * processes access it together.
+ *
+ * Series are identified by the name of their text file, the HDF5 dataset
+ * is named after its stem.
+ */
+class TimeSeriesWriter
+{
+public:
+	//! The output formats
+	enum class Format
+	{
+		text,
+		hdf5
+	};
+
+	//! When the buffered rows are written
+	struct Policy
+	{
+		Format format = Format::text;
+
+		//! The number of rows buffered before the text series are written
+		std::size_t maxRows = 100;
+
+		//! The time (s) after which the text series are written anyway
+		double maxSeconds = 10.0;
+	};
+
+	/**
+	 * The rows of all the series taken from the writer, to be appended to
+	 * the HDF5 file.
+	 */
+	class Rows
+	{
+	public:
+		/**
+		 * Append the rows to the time series group of the file, creating
+		 * it if needed. Collective over the communicator of the file, all
+		 * the processes must have registered the same series in the same
+		 * order.
+		 *
+		 * @param file The checkpoint file.
+		 */
+		void
+		write(const XFile& file) const;
+
+	private:
+		friend class TimeSeriesWriter;
+
+		//! The rows of one series, cut or padded to its columns
+		struct Part
+		{
+			std::string name;
+			std::vector<std::string> columns;
+			std::vector<double> values;
+		};
+
+		std::vector<Part> _parts;
+	};
+
+	//! The Constructor
+	TimeSeriesWriter(Policy policy = Policy{});
+
+	TimeSeriesWriter(const TimeSeriesWriter&) = delete;
+	TimeSeriesWriter&
+	operator=(const TimeSeriesWriter&) = delete;
+
+	//! The Destructor, writes what is left of the text series
+	~TimeSeriesWriter();
+
+	/**
+	 * Set when the rows are written, before registering any series.
+	 */
+	void
+	setPolicy(Policy policy);
+
+	/**
+	 * Get when the rows are written.
+	 */
+	const Policy&
+	getPolicy() const
+	{
+		return _policy;
+	}
+
+	/**
+	 * Register a series.
+	 *
+	 * @param fileName The name of the text file, which identifies the series
+	 * @param columns The names of the columns
+	 * @param truncate Whether to start a new text file with a header line
+	 * (the names of the columns after a '#'), instead of appending to it
+	 * @param precision The number of significant digits in the text file
+	 * @param integerColumns The number of leading columns holding integers
+	 * (e.g. time step numbers) printed as such in the text file
+	 */
+	void
+	addSeries(const std::string& fileName, std::vector<std::string> columns,
+		bool truncate, int precision = 6, std::size_t integerColumns = 0);
+
+	/**
+	 * Check whether a series was registered.
+	 */
+	bool
+	hasSeries(const std::string& fileName) const
+	{
+		return _series.count(fileName) > 0;
+	}
+
+	/**
+	 * Add a row to a series. A row with a different number of values than
+	 * there are columns is written as is in the text file, and cut or
+	 * padded with NaN in the HDF5 file.
+	 *
+	 * @param fileName The name of the series
+	 * @param values The values of the row
+	 */
+	void
+	addRow(const std::string& fileName, const std::vector<double>& values);
+
+	/**
+	 * Write the buffered rows of the text series.
+	 */
+	void
+	flush();
+
+	/**
+	 * Take the buffered rows of all the series for the HDF5 file.
+	 */
+	Rows
+	takeRows();
+
+private:
+	struct Series
+	{
+		std::vector<std::string> columns;
+		int precision;
+		std::size_t integerColumns;
+
+		//! The text file, opened in append mode with the first rows
+		std::ofstream file;
+
+		//! The buffered values and where each row ends
+		std::vector<double> values;
+		std::vector<std::size_t> rowEnds;
+	};
+
+	/**
+	 * Write the buffered rows of a text series.
+	 */
+	void
+	flush(const std::string& fileName, Series& series);
+
+	//! When to write
+	Policy _policy;
+
+	//! The series, by file name, kept in registration order for the HDF5
+	//! file
+	std::map<std::string, Series> _series;
+	std::vector<std::string> _order;
+
+	//! The number of buffered rows
+	std::size_t _numRows;
+
+	//! The time of the last text write
+	std::chrono::steady_clock::time_point _lastFlush;
+};
+} // namespace io
+} // namespace xolotl
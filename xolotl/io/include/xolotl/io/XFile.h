@@ -1,6 +1,7 @@
 #ifndef XCORE_XFILE_H
 #define XCORE_XFILE_H
 
+#include <cstdint>
 #include <set>
 #include <string>
 #include <tuple>
@@ -60,6 +61,12 @@ public:
 		// Name of the concentrations data set.
 		static const std::string concDatasetName;
 
+		// Name of the dense concentrations data set.
+		static const std::string denseConcDatasetName;
+
+		// Name of the dense concentrations data set of 2D and 3D grids.
+		static const std::string denseGridConcDatasetName;
+
 		// Names of grid-specification attributes.
 		static const std::string nxAttrName;
 		static const std::string hxAttrName;
@@ -86,6 +93,10 @@ public:
 		using ConcType = std::pair<int, double>;
 		using Concs1DType = HDF5File::RaggedDataSet2D<ConcType>::Ragged2DType;
 
+		// Concise name for dense concentrations, the values of
+		// consecutive grid points stored one after the other.
+		using DenseConcsType = std::vector<double>;
+
 		/**
 		 * Construct the group name for the given time step.
 		 *
@@ -278,7 +289,9 @@ public:
 			const XFile& file, int baseX, const Concs1DType& concs) const;
 
 		/**
-		 * Read concentration dataset for our grid points in a 1D problem.
+		 * Read concentration dataset for our grid points in a 1D problem,
+		 * whichever its layout (only the non-zero values of the dense
+		 * layout are returned).
 		 * Assumes that grid point slabs are assigned to processes in
 		 * MPI rank order.
 		 *
@@ -293,6 +306,157 @@ public:
 		Concs1DType
 		readConcentrations(const XFile& file, int baseX, int numX) const;
 
+		/**
+		 * Add a dense concentration dataset for all grid points in a 1D
+		 * problem: a (grid point x value) dataset, chunked following the
+		 * decomposition of the grid and compressed (shuffle + deflate) when
+		 * the HDF5 library allows it.  This layout is an alternative
+		 * to the ragged one written by writeConcentrations, both are
+		 * understood by the read functions.
+		 * Assumes that grid point slabs are assigned to processes in
+		 * MPI rank order.  Collective.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param baseX Index of first grid point we own.
+		 * @param numX Number of grid points we own.
+		 * @param numValues Number of values per grid point, the same on all
+		 *              processes.
+		 * @param concs Values of the grid points we own, of size
+		 *              numX * numValues.  Element i * numValues + l is the
+		 *              value l of (baseX + i)
+		 */
+		void
+		writeDenseConcentrations(const XFile& file, int baseX, int numX,
+			int numValues, const DenseConcsType& concs) const;
+
+		/**
+		 * Read a range of values for our grid points in a 1D problem,
+		 * whichever the layout of the concentration dataset.  With the
+		 * dense layout only the selected range is read from the file.
+		 * Collective.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param baseX Index of first grid point we own.
+		 * @param numX Number of grid points we own.
+		 * @param firstValue Index of the first value to read.
+		 * @param numValues Number of values to read for each grid point.
+		 * @return Values of the grid points we own, of size
+		 *              numX * numValues.  Element i * numValues + l is the
+		 *              value (firstValue + l) of (baseX + i), zero if it
+		 *              was not written
+		 */
+		DenseConcsType
+		readDenseConcentrations(const XFile& file, int baseX, int numX,
+			int firstValue, int numValues) const;
+
+		/**
+		 * Read a range of values for our grid points in a 1D problem
+		 * directly into the caller's array, whichever the layout of the
+		 * concentration dataset.  Only our part of the dataset is read,
+		 * with collective hyperslab reads, so the grid decomposition can
+		 * differ from the one used to write it.  Collective.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param baseX Index of first grid point we own.
+		 * @param numX Number of grid points we own.
+		 * @param firstValue Index of the first value to read.
+		 * @param numValues Number of values to read for each grid point.
+		 * @param concs Array of size numX * numValues receiving the values,
+		 *              element i * numValues + l is the value
+		 *              (firstValue + l) of (baseX + i).  Values that were
+		 *              not written are left unchanged.
+		 */
+		void
+		readConcentrations(const XFile& file, int baseX, int numX,
+			int firstValue, int numValues, double* concs) const;
+
+		/**
+		 * Add a dense concentration dataset for all grid points in a 2D or
+		 * 3D problem: a (z x y x x x value) dataset, chunked following the
+		 * decomposition of the grid and compressed like the 1D one.  Each
+		 * process writes its block of the grid with one collective
+		 * hyperslab write.  A 2D problem uses baseZ = 0 and numZ = 1.
+		 * Collective.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param baseX, baseY, baseZ Indices of the first grid point we own.
+		 * @param numX, numY, numZ Number of grid points we own in each
+		 *              direction.
+		 * @param numValues Number of values per grid point, the same on all
+		 *              processes.
+		 * @param concs Values of the grid points we own, in the order of a
+		 *              DMDA array (x fastest).  Element
+		 *              ((k * numY + j) * numX + i) * numValues + l is the
+		 *              value l of (baseX + i, baseY + j, baseZ + k)
+		 */
+		void
+		writeDenseConcentrations(const XFile& file, int baseX, int numX,
+			int baseY, int numY, int baseZ, int numZ, int numValues,
+			const DenseConcsType& concs) const;
+
+		/**
+		 * Read the values of our block of the grid in a 2D or 3D problem
+		 * directly into the caller's array, from the dataset written by
+		 * the 2D/3D writeDenseConcentrations, with one collective hyperslab
+		 * read.  Only the grid indices matter, so the grid decomposition
+		 * can differ from the one used to write it.  Collective.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param baseX, baseY, baseZ Indices of the first grid point we own.
+		 * @param numX, numY, numZ Number of grid points we own in each
+		 *              direction.
+		 * @param numValues Number of values to read for each grid point.
+		 * @param concs Array receiving the values, in the same order as
+		 *              the one given to writeDenseConcentrations.  Values
+		 *              past the ones in the file are left unchanged.
+		 */
+		void
+		readConcentrations(const XFile& file, int baseX, int numX, int baseY,
+			int numY, int baseZ, int numZ, int numValues,
+			double* concs) const;
+
+		/**
+		 * Determine whether our concentrations use the ragged layout.
+		 *
+		 * @return True iff the concentrations were written by
+		 *              writeConcentrations.
+		 */
+		bool
+		hasRaggedConcentrations(void) const;
+
+		/**
+		 * Determine whether our concentrations use the dense layout.
+		 *
+		 * @return True iff the concentrations were written by
+		 *              writeDenseConcentrations.
+		 */
+		bool
+		hasDenseConcentrations(void) const;
+
+		/**
+		 * Determine whether our concentrations use the dense layout of 2D
+		 * and 3D grids.
+		 *
+		 * @return True iff the concentrations were written by the 2D/3D
+		 *              writeDenseConcentrations.
+		 */
+		bool
+		hasDenseGridConcentrations(void) const;
+
+		/**
+		 * Obtain the number of values per grid point of the dense
+		 * concentration dataset.
+		 *
+		 * @return The number of values per grid point.
+		 */
+		int
+		getNumDenseValues(void) const;
+
 		/**
 		 * Read the times from our timestep group.
 		 *
@@ -392,6 +556,24 @@ public:
 		// parallel reads of concentrations.
 		Data3DType
 		readGridPoint(int i, int j = -1, int k = -1) const;
+
+		/**
+		 * Read our (i,j,k)-th grid point concentrations directly into
+		 * the caller's array.  Independent, so each process only reads
+		 * the grid points it owns.
+		 *
+		 * @param concs The array receiving the concentrations, indexed by
+		 *              the indices stored in the file.  Values that were
+		 *              not written are left unchanged.
+		 * @param numValues The size of concs, indices past it are ignored
+		 * @param i The index of the grid point on the x axis
+		 * @param j The index of the grid point on the y axis
+		 * @param k The index of the grid point on the z axis
+		 * @return True iff the grid point was found in the file
+		 */
+		bool
+		readGridPoint(double* concs, int numValues, int i, int j = -1,
+			int k = -1) const;
 	};
 
 	// Our concentrations group.
@@ -485,6 +667,7 @@ public:
 		// Names of network attribute.
 		static const std::string sizeAttrName;
 		static const std::string phaseSpaceAttrName;
+		static const std::string hashAttrName;
 
 	public:
 		// Path to the network group within our HDF5 file.
@@ -533,6 +716,72 @@ public:
 		 */
 		void
 		copyTo(const XFile& target) const;
+
+		/**
+		 * Make the network group of the given file an external link to
+		 * the file that actually holds ourself (ourself may already be a
+		 * link), instead of copying.  The link is relative to the
+		 * directory of the target file when possible.
+		 * A NetworkGroup must not already exist in the file.
+		 *
+		 * @param target The file that will reference us.
+		 */
+		void
+		linkTo(const XFile& target) const;
+
+		/**
+		 * Read the hash of the network content.
+		 *
+		 * @return The hash, 0 if the group was written without one.
+		 */
+		std::uint64_t
+		readHash() const;
+
+		/**
+		 * Determine whether we live in the shared file of the given
+		 * network, as written by writeSharedFile, which is the only file
+		 * that is safe to link to (a checkpoint file may be overwritten by
+		 * its run).
+		 *
+		 * @param network The network.
+		 * @return True iff the file holding us (we may be a link) is named
+		 *              after our hash and our hash is the one of the network.
+		 */
+		bool
+		isSharedFile(core::network::IReactionNetwork& network) const;
+
+		/**
+		 * Compute the hash of the content written for the given network.
+		 *
+		 * @param network The network.
+		 * @return The hash.
+		 */
+		static std::uint64_t
+		computeHash(core::network::IReactionNetwork& network);
+
+		/**
+		 * Write the network in a file of the given directory named after
+		 * its hash, unless it is already there with the same hash, so that
+		 * runs using the same network can all link to one file.  Safe if
+		 * several processes write the same file at once.
+		 *
+		 * @param dir The directory of the file.
+		 * @param network The network to write.
+		 * @return The path of the network file.
+		 */
+		static fs::path
+		writeSharedFile(
+			const fs::path& dir, core::network::IReactionNetwork& network);
+
+		/**
+		 * Replace the network group of the given file by a copy of the
+		 * group it links to, if it is an external link.
+		 *
+		 * @param file The file whose network group to embed.
+		 * @return True iff the network group was a link.
+		 */
+		static bool
+		embed(const XFile& file);
 	};
 
 	// A group describing a cluster within our HDF5 file.
@@ -599,6 +848,69 @@ public:
 			double& diffusionFactor) const;
 	};
 
+	// The group holding the time series written by the monitors, one
+	// extensible (rows x columns) dataset per series.
+	class TimeSeriesGroup : public HDF5File::Group
+	{
+	private:
+		// Name of the attribute listing the columns of a series.
+		static const std::string columnsAttrName;
+
+	public:
+		// Path of the time series group within the file.
+		static const fs::path path;
+
+		// Create or open the time series group.
+		TimeSeriesGroup(void) = delete;
+		TimeSeriesGroup(const TimeSeriesGroup& other) = delete;
+		TimeSeriesGroup(const XFile& file, bool create = false);
+
+		/**
+		 * Append rows to a series, creating its dataset on first use.
+		 * Collective: every process gives the same name and columns, and
+		 * its own rows that are appended after the ones of the lower ranks.
+		 * If the dataset already exists with a different number of
+		 * columns, the rows are cut or padded with NaN to fit it.
+		 *
+		 * @param file The file of the group.
+		 * @param name The name of the series.
+		 * @param columns The names of the columns.
+		 * @param rows My rows, one after the other, each with as many values
+		 * as there are columns.
+		 */
+		void
+		appendRows(const XFile& file, const std::string& name,
+			const std::vector<std::string>& columns,
+			const std::vector<double>& rows) const;
+
+		/**
+		 * Check whether a series was written.
+		 *
+		 * @param name The name of the series.
+		 * @return True iff the series has a dataset.
+		 */
+		bool
+		hasSeries(const std::string& name) const;
+
+		/**
+		 * Read the names of the columns of a series.
+		 *
+		 * @param name The name of the series.
+		 * @return The names of the columns.
+		 */
+		std::vector<std::string>
+		readColumns(const std::string& name) const;
+
+		/**
+		 * Read all the rows of a series.
+		 *
+		 * @param name The name of the series.
+		 * @return The rows.
+		 */
+		std::vector<std::vector<double>>
+		readRows(const std::string& name) const;
+	};
+
 private:
 	/**
 	 * Pass through only Create* access modes.
@@ -0,0 +1,136 @@
+#include <hdf5.h>
+
+#include <xolotl/io/CheckpointWriter.h>
+#include <xolotl/util/Log.h>
+
+namespace xolotl
+{
+namespace io
+{
+namespace
+{
+/**
+ * Can a background thread do collective HDF5 writes while the solver
+ * communicates?
+ */
+bool
+canWriteInBackground()
+{
+	int provided = MPI_THREAD_SINGLE;
+	MPI_Query_thread(&provided);
+	return provided == MPI_THREAD_MULTIPLE &&
+		CheckpointWriter::isHDF5ThreadSafe();
+}
+} // namespace
+
+bool
+CheckpointWriter::isHDF5ThreadSafe()
+{
+	hbool_t threadSafe = false;
+	H5is_library_threadsafe(&threadSafe);
+	return threadSafe;
+}
+
+CheckpointWriter::CheckpointWriter(
+	fs::path path, MPI_Comm _comm, bool background) :
+	comm(MPI_COMM_NULL),
+	async(background && canWriteInBackground()),
+	busy(false),
+	stop(false)
+{
+	MPI_Comm_dup(_comm, &comm);
+	file = std::make_unique<XFile>(
+		path, comm, XFile::AccessMode::OpenReadWrite);
+
+	if (async) {
+		thread = std::thread(&CheckpointWriter::run, this);
+	}
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+	try {
+		wait();
+	}
+	catch (const std::exception& e) {
+		XOLOTL_LOG_ERR << "CheckpointWriter: " << e.what();
+	}
+
+	if (thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stop = true;
+		}
+		cond.notify_all();
+		thread.join();
+	}
+
+	file.reset();
+	MPI_Comm_free(&comm);
+}
+
+void
+CheckpointWriter::submit(Task task)
+{
+	if (!async) {
+		write(task);
+		return;
+	}
+
+	wait();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending = std::move(task);
+		busy = true;
+	}
+	cond.notify_all();
+}
+
+void
+CheckpointWriter::wait()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	cond.wait(lock, [this] { return !busy; });
+	if (error) {
+		auto toThrow = error;
+		error = nullptr;
+		std::rethrow_exception(toThrow);
+	}
+}
+
+void
+CheckpointWriter::write(const Task& task)
+{
+	task(*file, comm);
+	file->Flush();
+}
+
+void
+CheckpointWriter::run()
+{
+	std::unique_lock<std::mutex> lock(mutex);
+	while (true) {
+		cond.wait(lock, [this] { return busy || stop; });
+		if (!busy) {
+			return;
+		}
+
+		// Write without holding the lock
+		auto task = std::move(pending);
+		lock.unlock();
+		std::exception_ptr taskError;
+		try {
+			write(task);
+		}
+		catch (...) {
+			taskError = std::current_exception();
+		}
+		lock.lock();
+
+		error = taskError;
+		busy = false;
+		cond.notify_all();
+	}
+}
+} // namespace io
+} // namespace xolotl
@@ -112,6 +112,15 @@ HDF5File::Open(fs::path _path, AccessMode _mode, MPI_Comm _comm, bool par)
 	}
 }
 
+void
+HDF5File::Flush(void) const
+{
+	auto status = H5Fflush(getId(), H5F_SCOPE_GLOBAL);
+	if (status < 0) {
+		throw HDF5Exception(BuildHDF5ErrorString());
+	}
+}
+
 bool
 HDF5File::hasGroup(fs::path path) const
 {
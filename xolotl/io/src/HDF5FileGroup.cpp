@@ -18,8 +18,13 @@ HDF5File::Group::Group(
 			H5P_DEFAULT)); // group access property list
 	}
 	else {
+		// Groups that are external links (e.g., a shared network) are
+		// never modified through us, open their file read-only so that
+		// several runs can use it at once.
+		PropertyList accessProps(H5P_GROUP_ACCESS);
+		H5Pset_elink_acc_flags(accessProps.getId(), H5F_ACC_RDONLY);
 		setId(H5Gopen(getLocation().getId(), getName().c_str(),
-			H5P_DEFAULT)); // group access property list
+			accessProps.getId())); // group access property list
 	}
 	if (getId() < 0) {
 		std::ostringstream estr;
@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cassert>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+#include <xolotl/io/TimeSeriesWriter.h>
+#include <xolotl/util/Log.h>
+
+namespace xolotl
+{
+namespace io
+{
+void
+TimeSeriesWriter::Rows::write(const XFile& file) const
+{
+	if (_parts.empty()) {
+		return;
+	}
+
+	auto group = file.getGroup<XFile::TimeSeriesGroup>();
+	if (not group) {
+		group = std::make_unique<XFile::TimeSeriesGroup>(file, true);
+	}
+	for (auto&& part : _parts) {
+		group->appendRows(file, part.name, part.columns, part.values);
+	}
+}
+
+TimeSeriesWriter::TimeSeriesWriter(Policy policy) :
+	_policy(policy),
+	_numRows(0),
+	_lastFlush(std::chrono::steady_clock::now())
+{
+}
+
+TimeSeriesWriter::~TimeSeriesWriter()
+{
+	try {
+		flush();
+	}
+	catch (const std::exception& e) {
+		XOLOTL_LOG_ERR << "TimeSeriesWriter: " << e.what();
+	}
+}
+
+void
+TimeSeriesWriter::setPolicy(Policy policy)
+{
+	assert(_series.empty());
+	_policy = policy;
+}
+
+void
+TimeSeriesWriter::addSeries(const std::string& fileName,
+	std::vector<std::string> columns, bool truncate, int precision,
+	std::size_t integerColumns)
+{
+	// Several monitors may share a file, the first one defines it
+	if (hasSeries(fileName)) {
+		return;
+	}
+
+	auto& series = _series[fileName];
+	series.columns = std::move(columns);
+	series.precision = precision;
+	series.integerColumns = integerColumns;
+	_order.push_back(fileName);
+
+	// Start the text file with the header now so that it exists even
+	// without rows, then close it: the rows may come from other processes
+	// too, so they are always appended
+	if (_policy.format == Format::text and truncate) {
+		std::ofstream file(fileName, std::ios::trunc);
+		file << "#";
+		for (std::size_t i = 0; i < series.columns.size(); ++i) {
+			file << (i > 0 ? " " : "") << series.columns[i];
+		}
+		file << std::endl;
+		if (not file) {
+			throw std::runtime_error(
+				"TimeSeriesWriter: unable to write " + fileName);
+		}
+	}
+}
+
+void
+TimeSeriesWriter::addRow(
+	const std::string& fileName, const std::vector<double>& values)
+{
+	auto it = _series.find(fileName);
+	if (it == _series.end()) {
+		throw std::runtime_error(
+			"TimeSeriesWriter: the series " + fileName + " was not registered");
+	}
+
+	auto& series = it->second;
+	series.values.insert(series.values.end(), values.begin(), values.end());
+	series.rowEnds.push_back(series.values.size());
+	++_numRows;
+
+	if (_policy.format != Format::text) {
+		return;
+	}
+
+	std::chrono::duration<double> elapsed =
+		std::chrono::steady_clock::now() - _lastFlush;
+	if (_numRows >= _policy.maxRows or elapsed.count() >= _policy.maxSeconds) {
+		flush();
+	}
+}
+
+void
+TimeSeriesWriter::flush()
+{
+	if (_policy.format != Format::text) {
+		return;
+	}
+
+	for (auto&& [fileName, series] : _series) {
+		flush(fileName, series);
+	}
+	_numRows = 0;
+	_lastFlush = std::chrono::steady_clock::now();
+}
+
+void
+TimeSeriesWriter::flush(const std::string& fileName, Series& series)
+{
+	if (series.rowEnds.empty()) {
+		return;
+	}
+
+	if (not series.file.is_open()) {
+		series.file.open(fileName, std::ios::app);
+	}
+
+	auto& file = series.file;
+	file << std::setprecision(series.precision);
+	std::size_t rowBegin = 0;
+	for (auto rowEnd : series.rowEnds) {
+		for (auto i = rowBegin; i < rowEnd; ++i) {
+			if (i > rowBegin) {
+				file << " ";
+			}
+			if (i - rowBegin < series.integerColumns) {
+				file << static_cast<long long>(series.values[i]);
+			}
+			else {
+				file << series.values[i];
+			}
+		}
+		file << "\n";
+		rowBegin = rowEnd;
+	}
+	file.flush();
+	if (not file) {
+		throw std::runtime_error(
+			"TimeSeriesWriter: unable to write " + fileName);
+	}
+
+	series.values.clear();
+	series.rowEnds.clear();
+}
+
+TimeSeriesWriter::Rows
+TimeSeriesWriter::takeRows()
+{
+	Rows rows;
+	for (auto&& fileName : _order) {
+		auto& series = _series[fileName];
+
+		// Cut or pad each row to the columns
+		auto numColumns = series.columns.size();
+		Rows::Part part;
+		part.name = fs::path(fileName).stem().string();
+		part.columns = series.columns;
+		part.values.assign(series.rowEnds.size() * numColumns,
+			std::numeric_limits<double>::quiet_NaN());
+		std::size_t rowBegin = 0;
+		for (std::size_t r = 0; r < series.rowEnds.size(); ++r) {
+			auto rowEnd = series.rowEnds[r];
+			auto numCopied = std::min(rowEnd - rowBegin, numColumns);
+			std::copy_n(&series.values[rowBegin], numCopied,
+				&part.values[r * numColumns]);
+			rowBegin = rowEnd;
+		}
+		rows._parts.push_back(std::move(part));
+
+		series.values.clear();
+		series.rowEnds.clear();
+	}
+	_numRows = 0;
+
+	return rows;
+}
+} // namespace io
+} // namespace xolotl
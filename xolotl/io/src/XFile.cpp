@@ -1,8 +1,13 @@
 #include <hdf5.h>
 
+#include <algorithm>
 #include <array>
+#include <cassert>
+#include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <limits>
+#include <random>
 #include <sstream>
 
 #include <mpi.h>
@@ -59,6 +64,45 @@ XFile::XFile(fs::path _path, MPI_Comm _comm, AccessMode _mode) :
 const fs::path XFile::NetworkGroup::path = "/networkGroup";
 const std::string XFile::NetworkGroup::sizeAttrName = "totalSize";
 const std::string XFile::NetworkGroup::phaseSpaceAttrName = "phaseSpace";
+const std::string XFile::NetworkGroup::hashAttrName = "hash";
+
+namespace
+{
+// Chain the FNV-1a hash of the given bytes.
+void
+hashBytes(std::uint64_t& hash, const void* data, std::size_t size)
+{
+	auto bytes = static_cast<const unsigned char*>(data);
+	for (std::size_t n = 0; n < size; ++n) {
+		hash ^= bytes[n];
+		hash *= 1099511628211ull;
+	}
+}
+
+// Name of the file holding the given HDF5 object.
+fs::path
+getFileName(hid_t id)
+{
+	auto size = H5Fget_name(id, nullptr, 0);
+	if (size < 0) {
+		throw HDF5Exception("Unable to obtain the name of the file");
+	}
+	std::string name(size + 1, '\0');
+	H5Fget_name(id, name.data(), name.size());
+	name.resize(size);
+	return fs::path(name);
+}
+
+// Name of the shared file of the network with the given hash.
+std::string
+makeSharedFileName(std::uint64_t hash)
+{
+	std::ostringstream namestr;
+	namestr << "network_" << std::hex << std::setw(16) << std::setfill('0')
+			<< hash << ".h5";
+	return namestr.str();
+}
+} // namespace
 
 XFile::NetworkGroup::NetworkGroup(const XFile& file) :
 	HDF5File::Group(file, NetworkGroup::path, false)
@@ -104,6 +148,10 @@ XFile::NetworkGroup::NetworkGroup(
 		*this, sizeAttrName, scalarDSpace);
 	normalSizeAttr.setTo(totalSize);
 
+	// Add a hash attribute to identify the content.
+	Attribute<std::uint64_t> hashAttr(*this, hashAttrName, scalarDSpace);
+	hashAttr.setTo(computeHash(network));
+
 	for (core::network::IReactionNetwork::IndexType i = 0; i < totalSize; i++) {
 		auto cluster = network.getClusterCommon(i);
 		// Create and initialize the cluster group
@@ -138,6 +186,139 @@ XFile::NetworkGroup::copyTo(const XFile& target) const
 		H5P_DEFAULT);
 }
 
+void
+XFile::NetworkGroup::linkTo(const XFile& target) const
+{
+	// Our group is always at the same path in the file that holds it,
+	// which is not the file we were opened from if we are a link.
+	auto srcPath = fs::absolute(getFileName(getId()));
+
+	// Keep the link valid if the files are moved together.
+	auto targetDir = fs::absolute(getFileName(target.getId())).parent_path();
+	std::error_code ec;
+	auto linkPath = fs::relative(srcPath, targetDir, ec);
+	if (ec or linkPath.empty()) {
+		linkPath = srcPath;
+	}
+
+	auto status = H5Lcreate_external(linkPath.string().c_str(),
+		NetworkGroup::path.string().c_str(), target.getId(),
+		NetworkGroup::path.string().c_str(), H5P_DEFAULT, H5P_DEFAULT);
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Unable to link the network group to " << linkPath;
+		throw HDF5Exception(estr.str());
+	}
+}
+
+std::uint64_t
+XFile::NetworkGroup::readHash() const
+{
+	if (H5Aexists(getId(), hashAttrName.c_str()) <= 0) {
+		return 0;
+	}
+	Attribute<std::uint64_t> hashAttr(*this, hashAttrName);
+	return hashAttr.get();
+}
+
+bool
+XFile::NetworkGroup::isSharedFile(
+	core::network::IReactionNetwork& network) const
+{
+	// The file that actually holds us, we may be a link.
+	auto hash = readHash();
+	return hash != 0 and hash == computeHash(network) and
+		getFileName(getId()).filename() == makeSharedFileName(hash);
+}
+
+std::uint64_t
+XFile::NetworkGroup::computeHash(core::network::IReactionNetwork& network)
+{
+	std::uint64_t hash = 14695981039346656037ull;
+
+	for (auto&& name : network.getPhaseSpace()) {
+		hashBytes(hash, name.data(), name.size() + 1);
+	}
+
+	auto bounds = network.getAllClusterBounds();
+	int totalSize = network.getNumClusters();
+	hashBytes(hash, &totalSize, sizeof(totalSize));
+	for (core::network::IReactionNetwork::IndexType i = 0; i < totalSize; i++) {
+		hashBytes(hash, bounds[i].data(),
+			bounds[i].size() * sizeof(bounds[i][0]));
+		auto cluster = network.getClusterCommon(i);
+		double values[3] = {cluster.getFormationEnergy(),
+			cluster.getMigrationEnergy(), cluster.getDiffusionFactor()};
+		hashBytes(hash, values, sizeof(values));
+	}
+
+	return hash;
+}
+
+fs::path
+XFile::NetworkGroup::writeSharedFile(
+	const fs::path& dir, core::network::IReactionNetwork& network)
+{
+	auto hash = computeHash(network);
+	auto filePath = dir / makeSharedFileName(hash);
+	if (fs::exists(filePath)) {
+		// Only reuse a file that holds this very network, anything else
+		// is replaced.
+		bool valid = false;
+		try {
+			XFile file(filePath, MPI_COMM_SELF, AccessMode::OpenReadOnly);
+			auto networkGroup = file.getGroup<NetworkGroup>();
+			valid = networkGroup and networkGroup->readHash() == hash;
+		}
+		catch (const HDF5Exception&) {
+		}
+		if (valid) {
+			return filePath;
+		}
+	}
+
+	// Write under a unique name and move it in place so that other runs
+	// never see a partial file.
+	std::ostringstream tmpstr;
+	tmpstr << filePath.string() << '.' << std::random_device{}() << ".tmp";
+	fs::path tmpPath = tmpstr.str();
+	{
+		XFile file(tmpPath, 1, MPI_COMM_SELF);
+		NetworkGroup networkGroup(file, network);
+	}
+	fs::rename(tmpPath, filePath);
+
+	return filePath;
+}
+
+bool
+XFile::NetworkGroup::embed(const XFile& file)
+{
+	auto name = NetworkGroup::path.string();
+	H5L_info_t info;
+	if (H5Lget_info(file.getId(), name.c_str(), &info, H5P_DEFAULT) < 0 or
+		info.type != H5L_TYPE_EXTERNAL) {
+		return false;
+	}
+
+	// Copy the linked group next to the link, then put it in its place.
+	auto tmpName = name + "_embedded";
+	herr_t status = H5Ocopy(file.getId(), name.c_str(), file.getId(),
+		tmpName.c_str(), H5P_DEFAULT, H5P_DEFAULT);
+	if (status >= 0) {
+		status = H5Ldelete(file.getId(), name.c_str(), H5P_DEFAULT);
+	}
+	if (status >= 0) {
+		status = H5Lmove(file.getId(), tmpName.c_str(), file.getId(),
+			name.c_str(), H5P_DEFAULT, H5P_DEFAULT);
+	}
+	if (status < 0) {
+		throw HDF5Exception("Unable to embed the linked network group");
+	}
+
+	return true;
+}
+
 //----------------------------------------------------------------------------
 // ClusterGroup
 //
@@ -357,6 +538,35 @@ const std::string XFile::TimestepGroup::nzAttrName = "nz";
 const std::string XFile::TimestepGroup::hzAttrName = "hz";
 
 const std::string XFile::TimestepGroup::concDatasetName = "concs";
+const std::string XFile::TimestepGroup::denseConcDatasetName = "denseConcs";
+const std::string XFile::TimestepGroup::denseGridConcDatasetName =
+	"denseGridConcs";
+
+namespace
+{
+// Target size of a chunk of the dense concentration dataset (bytes).
+constexpr hsize_t denseChunkBytes = 1 << 20;
+
+// Compression level of the dense concentration dataset.
+constexpr unsigned int denseDeflateLevel = 4;
+
+// Compress a dense concentration dataset if we can, parallel writes of
+// filtered datasets need HDF5 1.10.2.
+void
+setDenseFilters(hid_t createProps, MPI_Comm comm)
+{
+	bool canFilter = H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+#if !H5_VERSION_GE(1, 10, 2)
+	int commSize;
+	MPI_Comm_size(comm, &commSize);
+	canFilter = canFilter && (commSize == 1);
+#endif
+	if (canFilter) {
+		H5Pset_shuffle(createProps);
+		H5Pset_deflate(createProps, denseDeflateLevel);
+	}
+}
+} // namespace
 
 std::string
 XFile::TimestepGroup::makeGroupName(
@@ -870,11 +1080,314 @@ XFile::TimestepGroup::Concs1DType
 XFile::TimestepGroup::readConcentrations(
 	const XFile& file, int baseX, int numX) const
 {
+	if (hasDenseConcentrations()) {
+		// Read everything and keep the non-zero values.
+		auto numValues = getNumDenseValues();
+		auto denseConcs =
+			readDenseConcentrations(file, baseX, numX, 0, numValues);
+		Concs1DType ret(numX);
+		for (auto i = 0; i < numX; ++i) {
+			for (auto l = 0; l < numValues; ++l) {
+				auto conc = denseConcs[(std::size_t)i * numValues + l];
+				if (conc != 0.0) {
+					ret[i].emplace_back(l, conc);
+				}
+			}
+		}
+		return ret;
+	}
+
 	// Open and read the ragged dataset.
 	RaggedDataSet2D<ConcType> dataset(file.getComm(), *this, concDatasetName);
 	return dataset.read(baseX, numX);
 }
 
+void
+XFile::TimestepGroup::writeDenseConcentrations(const XFile& file, int baseX,
+	int numX, int numValues, const DenseConcsType& concs) const
+{
+	assert(baseX >= 0);
+	assert(numValues > 0);
+	assert(concs.size() == (std::size_t)numX * numValues);
+
+	// The whole dataset covers the grid points of all the processes.
+	auto comm = file.getComm();
+	unsigned long long myNumX = numX;
+	unsigned long long totalNumX = 0;
+	unsigned long long maxNumX = 0;
+	MPI_Allreduce(
+		&myNumX, &totalNumX, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+	MPI_Allreduce(&myNumX, &maxNumX, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+
+	SimpleDataSpace<2>::Dimensions dims{
+		(hsize_t)totalNumX, (hsize_t)numValues};
+	SimpleDataSpace<2> dspace(dims);
+
+	// Match the chunks to the decomposition: a chunk spans the grid points
+	// of one process, and the values are cut so that a range of clusters
+	// can be read without decompressing everything.
+	hsize_t chunkX = std::max<hsize_t>(maxNumX, 1);
+	hsize_t chunkValues = std::clamp<hsize_t>(
+		denseChunkBytes / (sizeof(double) * chunkX), 1, numValues);
+	SimpleDataSpace<2>::Dimensions chunkDims{chunkX, chunkValues};
+	PropertyList createProps(H5P_DATASET_CREATE);
+	H5Pset_chunk(createProps.getId(), 2, chunkDims.data());
+	setDenseFilters(createProps.getId(), comm);
+
+	DataSet<double> dataset(*this, denseConcDatasetName, dspace, createProps);
+
+	// Select our hyperslab within the file.
+	SimpleDataSpace<2>::Dimensions counts{(hsize_t)numX, (hsize_t)numValues};
+	SimpleDataSpace<2>::Dimensions offsets{(hsize_t)baseX, 0};
+	SimpleDataSpace<2> memspace(counts);
+	SimpleDataSpace<2> filespace(dataset);
+	if (numX > 0) {
+		H5Sselect_hyperslab(filespace.getId(), H5S_SELECT_SET,
+			offsets.data(), nullptr, counts.data(), nullptr);
+	}
+	else {
+		H5Sselect_none(filespace.getId());
+		H5Sselect_none(memspace.getId());
+	}
+
+	// Write our part using a collective write, required by the filters.
+	PropertyList plist(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(plist.getId(), H5FD_MPIO_COLLECTIVE);
+	TypeInMemory<double> memType;
+	auto status = H5Dwrite(dataset.getId(), memType.getId(),
+		memspace.getId(), filespace.getId(), plist.getId(), concs.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to write dataset " << dataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
+XFile::TimestepGroup::DenseConcsType
+XFile::TimestepGroup::readDenseConcentrations(const XFile& file, int baseX,
+	int numX, int firstValue, int numValues) const
+{
+	DenseConcsType ret((std::size_t)numX * numValues, 0.0);
+	readConcentrations(file, baseX, numX, firstValue, numValues, ret.data());
+	return ret;
+}
+
+void
+XFile::TimestepGroup::readConcentrations(const XFile& file, int baseX,
+	int numX, int firstValue, int numValues, double* concs) const
+{
+	assert(baseX >= 0);
+	assert(firstValue >= 0);
+
+	if (not hasDenseConcentrations()) {
+		// Read our part of the flattened ragged dataset in one go and
+		// scatter the values that are in the range.
+		RaggedDataSet2D<ConcType> dataset(
+			file.getComm(), *this, concDatasetName);
+		std::vector<uint32_t> startingIndices;
+		auto flatConcs = dataset.readFlat(baseX, numX, startingIndices);
+		for (auto i = 0; i < numX; ++i) {
+			auto gridPointConcs = concs + (std::size_t)i * numValues;
+			auto begin = startingIndices[i] - startingIndices[0];
+			auto end = startingIndices[i + 1] - startingIndices[0];
+			for (auto n = begin; n < end; ++n) {
+				auto l = flatConcs[n].first - firstValue;
+				if (l >= 0 and l < numValues) {
+					gridPointConcs[l] = flatConcs[n].second;
+				}
+			}
+		}
+		return;
+	}
+
+	DataSet<double> dataset(*this, denseConcDatasetName);
+	SimpleDataSpace<2> filespace(dataset);
+
+	// Only the values that are in the file are read.
+	hsize_t numFileValues = filespace.getDims()[1];
+	hsize_t numReadValues = (hsize_t)firstValue < numFileValues ?
+		std::min<hsize_t>(numValues, numFileValues - firstValue) :
+		0;
+
+	// Select only our grid points and the requested values, and read them
+	// where they go in the caller's array.
+	SimpleDataSpace<2>::Dimensions memDims{(hsize_t)numX, (hsize_t)numValues};
+	SimpleDataSpace<2>::Dimensions counts{(hsize_t)numX, numReadValues};
+	SimpleDataSpace<2>::Dimensions memOffsets{0, 0};
+	SimpleDataSpace<2>::Dimensions fileOffsets{
+		(hsize_t)baseX, (hsize_t)firstValue};
+	SimpleDataSpace<2> memspace(memDims);
+	if (numX > 0 and numReadValues > 0) {
+		H5Sselect_hyperslab(memspace.getId(), H5S_SELECT_SET,
+			memOffsets.data(), nullptr, counts.data(), nullptr);
+		H5Sselect_hyperslab(filespace.getId(), H5S_SELECT_SET,
+			fileOffsets.data(), nullptr, counts.data(), nullptr);
+	}
+	else {
+		H5Sselect_none(filespace.getId());
+		H5Sselect_none(memspace.getId());
+	}
+
+	// Read using a collective operation.
+	PropertyList plist(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(plist.getId(), H5FD_MPIO_COLLECTIVE);
+	TypeInMemory<double> memType;
+	auto status = H5Dread(dataset.getId(), memType.getId(), memspace.getId(),
+		filespace.getId(), plist.getId(), concs);
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to read dataset " << dataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
+void
+XFile::TimestepGroup::writeDenseConcentrations(const XFile& file, int baseX,
+	int numX, int baseY, int numY, int baseZ, int numZ, int numValues,
+	const DenseConcsType& concs) const
+{
+	assert(baseX >= 0 and baseY >= 0 and baseZ >= 0);
+	assert(numValues > 0);
+	assert(concs.size() == (std::size_t)numX * numY * numZ * numValues);
+
+	// The whole dataset covers the blocks of all the processes, in the
+	// (z, y, x) order of the DMDA arrays.
+	auto comm = file.getComm();
+	std::array<unsigned long long, 3> myEnds{
+		(unsigned long long)baseZ + numZ, (unsigned long long)baseY + numY,
+		(unsigned long long)baseX + numX};
+	std::array<unsigned long long, 3> myNums{(unsigned long long)numZ,
+		(unsigned long long)numY, (unsigned long long)numX};
+	std::array<unsigned long long, 3> ends{}, maxNums{};
+	MPI_Allreduce(
+		myEnds.data(), ends.data(), 3, MPI_UNSIGNED_LONG_LONG, MPI_MAX, comm);
+	MPI_Allreduce(myNums.data(), maxNums.data(), 3, MPI_UNSIGNED_LONG_LONG,
+		MPI_MAX, comm);
+
+	SimpleDataSpace<4>::Dimensions dims{(hsize_t)ends[0], (hsize_t)ends[1],
+		(hsize_t)ends[2], (hsize_t)numValues};
+	SimpleDataSpace<4> dspace(dims);
+
+	// Match the chunks to the decomposition: a chunk spans the largest
+	// block of a process, and the values are cut as in 1D.
+	SimpleDataSpace<4>::Dimensions chunkDims;
+	hsize_t chunkPoints = 1;
+	for (auto d = 0; d < 3; ++d) {
+		chunkDims[d] = std::max<hsize_t>(maxNums[d], 1);
+		chunkPoints *= chunkDims[d];
+	}
+	chunkDims[3] = std::clamp<hsize_t>(
+		denseChunkBytes / (sizeof(double) * chunkPoints), 1, numValues);
+	PropertyList createProps(H5P_DATASET_CREATE);
+	H5Pset_chunk(createProps.getId(), 4, chunkDims.data());
+	setDenseFilters(createProps.getId(), comm);
+
+	DataSet<double> dataset(
+		*this, denseGridConcDatasetName, dspace, createProps);
+
+	// Select our block within the file.
+	SimpleDataSpace<4>::Dimensions counts{
+		(hsize_t)numZ, (hsize_t)numY, (hsize_t)numX, (hsize_t)numValues};
+	SimpleDataSpace<4>::Dimensions offsets{
+		(hsize_t)baseZ, (hsize_t)baseY, (hsize_t)baseX, 0};
+	SimpleDataSpace<4> memspace(counts);
+	SimpleDataSpace<4> filespace(dataset);
+	if (numX > 0 and numY > 0 and numZ > 0) {
+		H5Sselect_hyperslab(filespace.getId(), H5S_SELECT_SET,
+			offsets.data(), nullptr, counts.data(), nullptr);
+	}
+	else {
+		H5Sselect_none(filespace.getId());
+		H5Sselect_none(memspace.getId());
+	}
+
+	// Write our part using a collective write, required by the filters.
+	PropertyList plist(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(plist.getId(), H5FD_MPIO_COLLECTIVE);
+	TypeInMemory<double> memType;
+	auto status = H5Dwrite(dataset.getId(), memType.getId(),
+		memspace.getId(), filespace.getId(), plist.getId(), concs.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to write dataset " << dataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
+void
+XFile::TimestepGroup::readConcentrations(const XFile& file, int baseX,
+	int numX, int baseY, int numY, int baseZ, int numZ, int numValues,
+	double* concs) const
+{
+	assert(baseX >= 0 and baseY >= 0 and baseZ >= 0);
+
+	DataSet<double> dataset(*this, denseGridConcDatasetName);
+	SimpleDataSpace<4> filespace(dataset);
+
+	// Only the values that are in the file are read.
+	hsize_t numReadValues =
+		std::min<hsize_t>(numValues, filespace.getDims()[3]);
+
+	// Select our block and read it where it goes in the caller's array.
+	SimpleDataSpace<4>::Dimensions memDims{
+		(hsize_t)numZ, (hsize_t)numY, (hsize_t)numX, (hsize_t)numValues};
+	SimpleDataSpace<4>::Dimensions counts{
+		(hsize_t)numZ, (hsize_t)numY, (hsize_t)numX, numReadValues};
+	SimpleDataSpace<4>::Dimensions memOffsets{0, 0, 0, 0};
+	SimpleDataSpace<4>::Dimensions fileOffsets{
+		(hsize_t)baseZ, (hsize_t)baseY, (hsize_t)baseX, 0};
+	SimpleDataSpace<4> memspace(memDims);
+	if (numX > 0 and numY > 0 and numZ > 0 and numReadValues > 0) {
+		H5Sselect_hyperslab(memspace.getId(), H5S_SELECT_SET,
+			memOffsets.data(), nullptr, counts.data(), nullptr);
+		H5Sselect_hyperslab(filespace.getId(), H5S_SELECT_SET,
+			fileOffsets.data(), nullptr, counts.data(), nullptr);
+	}
+	else {
+		H5Sselect_none(filespace.getId());
+		H5Sselect_none(memspace.getId());
+	}
+
+	// Read using a collective operation.
+	PropertyList plist(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(plist.getId(), H5FD_MPIO_COLLECTIVE);
+	TypeInMemory<double> memType;
+	auto status = H5Dread(dataset.getId(), memType.getId(), memspace.getId(),
+		filespace.getId(), plist.getId(), concs);
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to read dataset " << dataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
+bool
+XFile::TimestepGroup::hasRaggedConcentrations(void) const
+{
+	return H5Lexists(getId(), concDatasetName.c_str(), H5P_DEFAULT) > 0;
+}
+
+bool
+XFile::TimestepGroup::hasDenseConcentrations(void) const
+{
+	return H5Lexists(getId(), denseConcDatasetName.c_str(), H5P_DEFAULT) > 0;
+}
+
+bool
+XFile::TimestepGroup::hasDenseGridConcentrations(void) const
+{
+	return H5Lexists(getId(), denseGridConcDatasetName.c_str(), H5P_DEFAULT) >
+		0;
+}
+
+int
+XFile::TimestepGroup::getNumDenseValues(void) const
+{
+	DataSet<double> dataset(*this, denseConcDatasetName);
+	SimpleDataSpace<2> dspace(dataset);
+	return dspace.getDims()[1];
+}
+
 std::pair<double, double>
 XFile::TimestepGroup::readTimes(void) const
 {
@@ -1075,5 +1588,208 @@ XFile::TimestepGroup::readGridPoint(int i, int j, int k) const -> Data3DType
 	return toReturn;
 }
 
+bool
+XFile::TimestepGroup::readGridPoint(
+	double* concs, int numValues, int i, int j, int k) const
+{
+	// Set the dataset name
+	std::stringstream datasetName;
+	datasetName << "position_" << i << "_" << j << "_" << k;
+
+	// Check the dataset
+	if (H5Lexists(getId(), datasetName.str().c_str(), H5P_DEFAULT) <= 0) {
+		return false;
+	}
+
+	// Read the (index, value) rows in one flat array
+	DataSet<double> dataset(*this, datasetName.str());
+	SimpleDataSpace<2> dspace(dataset);
+	auto numRows = dspace.getDims()[0];
+	std::vector<double> rows(numRows * 2);
+	auto status = H5Dread(dataset.getId(), H5T_NATIVE_DOUBLE, H5S_ALL,
+		H5S_ALL, H5P_DEFAULT, rows.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to read dataset " << dataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+
+	// Scatter them
+	for (hsize_t n = 0; n < numRows; n++) {
+		auto l = (int)rows[2 * n];
+		if (l >= 0 and l < numValues) {
+			concs[l] = rows[2 * n + 1];
+		}
+	}
+
+	return true;
+}
+
+//----------------------------------------------------------------------------
+// TimeSeriesGroup
+//
+const fs::path XFile::TimeSeriesGroup::path = "/timeSeriesGroup";
+const std::string XFile::TimeSeriesGroup::columnsAttrName = "columns";
+
+namespace
+{
+// Target size of a chunk of a time series dataset (bytes).
+constexpr hsize_t seriesChunkBytes = 1 << 16;
+} // namespace
+
+XFile::TimeSeriesGroup::TimeSeriesGroup(const XFile& file, bool create) :
+	HDF5File::Group(file, TimeSeriesGroup::path, create)
+{
+}
+
+void
+XFile::TimeSeriesGroup::appendRows(const XFile& file, const std::string& name,
+	const std::vector<std::string>& columns,
+	const std::vector<double>& rows) const
+{
+	assert(not columns.empty());
+	assert(rows.size() % columns.size() == 0);
+
+	// Find where our rows go among the ones of all the processes.
+	auto comm = file.getComm();
+	int commRank;
+	MPI_Comm_rank(comm, &commRank);
+	unsigned long long myNumRows = rows.size() / columns.size();
+	unsigned long long baseRow = 0;
+	unsigned long long totalNumRows = 0;
+	MPI_Exscan(&myNumRows, &baseRow, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+	if (commRank == 0) {
+		baseRow = 0;
+	}
+	MPI_Allreduce(
+		&myNumRows, &totalNumRows, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, comm);
+	if (totalNumRows == 0) {
+		return;
+	}
+
+	// Open the dataset, or create it empty and extensible along the rows.
+	std::unique_ptr<DataSet<double>> dataset;
+	if (hasSeries(name)) {
+		dataset = std::make_unique<DataSet<double>>(*this, name);
+	}
+	else {
+		hsize_t numColumns = columns.size();
+		SimpleDataSpace<2>::Dimensions dims{0, numColumns};
+		SimpleDataSpace<2>::Dimensions maxDims{H5S_UNLIMITED, numColumns};
+		SimpleDataSpace<2> dspace(dims, maxDims);
+		SimpleDataSpace<2>::Dimensions chunkDims{
+			std::max<hsize_t>(
+				seriesChunkBytes / (sizeof(double) * numColumns), 1),
+			numColumns};
+		PropertyList createProps(H5P_DATASET_CREATE);
+		H5Pset_chunk(createProps.getId(), 2, chunkDims.data());
+		dataset = std::make_unique<DataSet<double>>(
+			*this, name, dspace, createProps);
+
+		// Name the columns the way the text files do
+		std::ostringstream columnStr;
+		for (std::size_t i = 0; i < columns.size(); ++i) {
+			columnStr << (i > 0 ? " " : "") << columns[i];
+		}
+		ScalarDataSpace scalarDSpace;
+		Attribute<std::string> columnsAttr(
+			*dataset, columnsAttrName, scalarDSpace);
+		columnsAttr.setTo(columnStr.str());
+	}
+
+	// Fit our rows to the width of the dataset.
+	auto oldDims = SimpleDataSpace<2>(*dataset).getDims();
+	hsize_t numColumns = oldDims[1];
+	const double* data = rows.data();
+	std::vector<double> fittedRows;
+	if (numColumns != columns.size()) {
+		fittedRows.assign(
+			myNumRows * numColumns, std::numeric_limits<double>::quiet_NaN());
+		auto numCopied = std::min<std::size_t>(numColumns, columns.size());
+		for (std::size_t r = 0; r < myNumRows; ++r) {
+			std::copy_n(&rows[r * columns.size()], numCopied,
+				&fittedRows[r * numColumns]);
+		}
+		data = fittedRows.data();
+	}
+
+	// Extend the dataset by the rows of all the processes.
+	SimpleDataSpace<2>::Dimensions newDims{
+		oldDims[0] + (hsize_t)totalNumRows, numColumns};
+	if (H5Dset_extent(dataset->getId(), newDims.data()) < 0) {
+		std::ostringstream estr;
+		estr << "Failed to extend dataset " << dataset->getName();
+		throw HDF5Exception(estr.str());
+	}
+
+	// Select our hyperslab within the file.
+	SimpleDataSpace<2>::Dimensions counts{(hsize_t)myNumRows, numColumns};
+	SimpleDataSpace<2>::Dimensions offsets{oldDims[0] + (hsize_t)baseRow, 0};
+	SimpleDataSpace<2> memspace(counts);
+	SimpleDataSpace<2> filespace(*dataset);
+	if (myNumRows > 0) {
+		H5Sselect_hyperslab(filespace.getId(), H5S_SELECT_SET,
+			offsets.data(), nullptr, counts.data(), nullptr);
+	}
+	else {
+		H5Sselect_none(filespace.getId());
+		H5Sselect_none(memspace.getId());
+	}
+
+	// Write our rows using a collective write.
+	PropertyList plist(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(plist.getId(), H5FD_MPIO_COLLECTIVE);
+	TypeInMemory<double> memType;
+	auto status = H5Dwrite(dataset->getId(), memType.getId(),
+		memspace.getId(), filespace.getId(), plist.getId(), data);
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to write dataset " << dataset->getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
+bool
+XFile::TimeSeriesGroup::hasSeries(const std::string& name) const
+{
+	return H5Lexists(getId(), name.c_str(), H5P_DEFAULT) > 0;
+}
+
+std::vector<std::string>
+XFile::TimeSeriesGroup::readColumns(const std::string& name) const
+{
+	DataSet<double> dataset(*this, name);
+	Attribute<std::string> columnsAttr(dataset, columnsAttrName);
+	std::istringstream columnStr(columnsAttr.get());
+	return std::vector<std::string>(
+		std::istream_iterator<std::string>(columnStr),
+		std::istream_iterator<std::string>());
+}
+
+std::vector<std::vector<double>>
+XFile::TimeSeriesGroup::readRows(const std::string& name) const
+{
+	DataSet<double> dataset(*this, name);
+	auto dims = SimpleDataSpace<2>(dataset).getDims();
+	std::vector<double> flatRows(dims[0] * dims[1]);
+	if (not flatRows.empty()) {
+		TypeInMemory<double> memType;
+		auto status = H5Dread(dataset.getId(), memType.getId(), H5S_ALL,
+			H5S_ALL, H5P_DEFAULT, flatRows.data());
+		if (status < 0) {
+			std::ostringstream estr;
+			estr << "Failed to read dataset " << dataset.getName();
+			throw HDF5Exception(estr.str());
+		}
+	}
+
+	std::vector<std::vector<double>> rows(dims[0]);
+	for (hsize_t r = 0; r < dims[0]; ++r) {
+		rows[r].assign(flatRows.begin() + r * dims[1],
+			flatRows.begin() + (r + 1) * dims[1]);
+	}
+	return rows;
+}
+
 } // namespace io
 } // namespace xolotl
@@ -480,6 +480,84 @@ public:
 	 */
 	virtual std::string
 	getFluxDepthProfileFilePath() const = 0;
+
+	/**
+	 * Obtain how the reaction rates are stored over the grid.
+	 *
+	 * @return "grid" for one set of rates per grid point, "temperature" for
+	 * one set per distinct temperature
+	 */
+	virtual std::string
+	getRateStorage() const = 0;
+
+	/**
+	 * Obtain how the reaction kernels are dispatched.
+	 *
+	 * @return "fused" for a single kernel over all the reactions, "type" for
+	 * one kernel per reaction type
+	 */
+	virtual std::string
+	getReactionDispatch() const = 0;
+
+	/**
+	 * Obtain how the reaction fluxes are accumulated.
+	 *
+	 * @return "atomic" for atomic additions to the fluxes, "gather" for
+	 * per-reaction slots summed for each cluster
+	 */
+	virtual std::string
+	getFluxAccumulation() const = 0;
+
+	/**
+	 * Obtain the directory of the network construction cache.
+	 *
+	 * @return The directory, empty if the network is always generated
+	 */
+	virtual std::string
+	getNetworkCache() const = 0;
+
+	/**
+	 * Obtain how the network is updated when the temperature changes.
+	 *
+	 * @return "local" if each process only updates its own grid points
+	 * without communicating, "global" if all the processes agree on the
+	 * update through a reduction at each evaluation
+	 */
+	virtual std::string
+	getTempUpdate() const = 0;
+
+	/**
+	 * Obtain the absolute temperature change (K) above which the network is
+	 * updated.
+	 */
+	virtual double
+	getTempUpdateTolerance() const = 0;
+
+	/**
+	 * Obtain the temperature change, relative to the temperature the network
+	 * was last updated with, above which the network is updated.
+	 */
+	virtual double
+	getTempUpdateRelTolerance() const = 0;
+
+	/**
+	 * Obtain the temperature lattice on which the diffusion coefficients and
+	 * rates are tabulated.
+	 *
+	 * @return The minimum temperature, maximum temperature, and step (K),
+	 * empty if they are always computed
+	 */
+	virtual std::vector<double>
+	getRateTable() const = 0;
+
+	/**
+	 * Should the checkpoints be written by a background thread?
+	 *
+	 * @return True to initialize MPI with full thread support, the
+	 * checkpoints are only written in the background if HDF5 is thread-safe
+	 */
+	virtual bool
+	useCheckpointThread() const = 0;
 };
 // end class IOptions
 } /* namespace options */
@@ -281,6 +281,47 @@ protected:
 	 */
 	fs::path fluxDepthProfileFilePath;
 
+	/**
+	 * How the reaction rates are stored over the grid
+	 */
+	std::string rateStorage;
+
+	/**
+	 * How the reaction kernels are dispatched
+	 */
+	std::string reactionDispatch;
+
+	/**
+	 * How the reaction fluxes are accumulated
+	 */
+	std::string fluxAccumulation;
+
+	/**
+	 * Directory of the network construction cache
+	 */
+	std::string networkCache;
+
+	/**
+	 * How the network is updated when the temperature changes
+	 */
+	std::string tempUpdate;
+
+	/**
+	 * Absolute and relative temperature changes triggering a network update
+	 */
+	double tempUpdateTolerance;
+	double tempUpdateRelTolerance;
+
+	/**
+	 * Minimum temperature, maximum temperature, and step of the rate table
+	 */
+	std::vector<double> rateTable;
+
+	/**
+	 * Write the checkpoints from a background thread?
+	 */
+	bool checkpointThreadFlag;
+
 public:
 	/**
 	 * The constructor.
@@ -809,6 +850,87 @@ public:
 	{
 		return fluxDepthProfileFilePath.string();
 	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	std::string
+	getRateStorage() const override
+	{
+		return rateStorage;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	std::string
+	getReactionDispatch() const override
+	{
+		return reactionDispatch;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	std::string
+	getFluxAccumulation() const override
+	{
+		return fluxAccumulation;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	std::string
+	getNetworkCache() const override
+	{
+		return networkCache;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	std::string
+	getTempUpdate() const override
+	{
+		return tempUpdate;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	double
+	getTempUpdateTolerance() const override
+	{
+		return tempUpdateTolerance;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	double
+	getTempUpdateRelTolerance() const override
+	{
+		return tempUpdateRelTolerance;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	std::vector<double>
+	getRateTable() const override
+	{
+		return rateTable;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	bool
+	useCheckpointThread() const override
+	{
+		return checkpointThreadFlag;
+	}
 };
 // end class Options
 } /* namespace options */
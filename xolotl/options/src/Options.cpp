@@ -71,7 +71,15 @@ Options::Options() :
 	xenonDiffusivity(-1.0),
 	fissionYield(0.25),
 	heVRatio(4.0),
-	migrationThreshold(std::numeric_limits<double>::infinity())
+	migrationThreshold(std::numeric_limits<double>::infinity()),
+	rateStorage("grid"),
+	reactionDispatch("fused"),
+	fluxAccumulation("atomic"),
+	networkCache(""),
+	tempUpdate("local"),
+	tempUpdateTolerance(0.1),
+	tempUpdateRelTolerance(0.0),
+	checkpointThreadFlag(false)
 {
 	return;
 }
@@ -246,7 +254,50 @@ Options::readParams(int argc, const char* argv[])
 		"ignored.")("fluxDepthProfileFilePath",
 		bpo::value<fs::path>(&fluxDepthProfileFilePath),
 		"The path to the custom flux profile file; the default is an empty "
-		"string that will use the default material associated flux handler.");
+		"string that will use the default material associated flux "
+		"handler.")("rateStorage",
+		bpo::value<std::string>(&rateStorage)->default_value("grid"),
+		"How the reaction rates are stored over the grid. (default = grid; "
+		"available grid,temperature). With temperature, the grid points "
+		"sharing the same temperature share the same rates.")(
+		"reactionDispatch",
+		bpo::value<std::string>(&reactionDispatch)->default_value("fused"),
+		"How the reaction kernels are launched. (default = fused; available "
+		"fused,type). With type, one kernel is launched per reaction type.")(
+		"fluxAccumulation",
+		bpo::value<std::string>(&fluxAccumulation)->default_value("atomic"),
+		"How the reaction fluxes are accumulated. (default = atomic; "
+		"available atomic,gather). With gather, each reaction writes its "
+		"contributions to its own slots which are then summed per cluster. "
+		"The slots take 8 bytes per flux contribution and grid point of a "
+		"batch, batches are split to keep them under 256 MiB.")(
+		"networkCache", bpo::value<std::string>(&networkCache),
+		"The directory where the generated reactions are cached and reloaded "
+		"from when the network is identical (default = no cache).")(
+		"tempUpdate",
+		bpo::value<std::string>(&tempUpdate)->default_value("local"),
+		"How the network is updated when the temperature changes. (default = "
+		"local; available local,global). With local, each process only "
+		"updates the rates of its own grid points that changed, without "
+		"communicating.")("tempUpdateTolerance",
+		bpo::value<double>(&tempUpdateTolerance)->default_value(0.1),
+		"The temperature change (K) since the last network update above "
+		"which the rates of a grid point are updated. (default = 0.1).")(
+		"tempUpdateRelTolerance",
+		bpo::value<double>(&tempUpdateRelTolerance)->default_value(0.0),
+		"The temperature change, relative to the temperature of the last "
+		"network update, above which the rates of a grid point are "
+		"updated. The largest of both tolerances is used. (default = 0.0).")(
+		"rateTable", bpo::value<std::string>(),
+		"The minimum temperature (K), maximum temperature (K) and step (K) "
+		"of the lattice on which the diffusion coefficients and rates are "
+		"tabulated then interpolated when the temperature changes (default "
+		"= no table, they are always computed).")("checkpointThread",
+		bpo::value<bool>(&checkpointThreadFlag),
+		"Should the checkpoints be written by a background thread? This "
+		"initializes MPI with full thread support and needs a thread-safe "
+		"HDF5 build, the checkpoints are written synchronously otherwise. "
+		"(default = false)");
 
 	bpo::options_description visible("Allowed options");
 	visible.add(desc).add(config);
@@ -368,6 +419,20 @@ Options::readParams(int argc, const char* argv[])
 		}
 	}
 
+	if (opts.count("rateTable")) {
+		// Break the argument into tokens.
+		auto tokens =
+			util::Tokenizer<double>{opts["rateTable"].as<std::string>()}();
+
+		if (tokens.size() != 3 || tokens[0] <= 0.0 || tokens[1] <= tokens[0] ||
+			tokens[2] <= 0.0) {
+			throw bpo::invalid_option_value(
+				"Options: The rate table needs a minimum temperature, a "
+				"larger maximum temperature and a positive step. Aborting!");
+		}
+		rateTable = tokens;
+	}
+
 	// Take care of the processes
 	if (opts.count("process")) {
 		// Break the argument into tokens.
@@ -502,6 +567,39 @@ Options::readParams(int argc, const char* argv[])
 		pulseTime = tokens[0];
 		pulseProportion = tokens[1];
 	}
+
+	// Check the rate storage
+	if (rateStorage != "grid" && rateStorage != "temperature") {
+		throw bpo::invalid_option_value(
+			"Options: Invalid rate storage (" + rateStorage +
+			"), must be grid or temperature. Aborting!");
+	}
+
+	// Check the reaction dispatch
+	if (reactionDispatch != "fused" && reactionDispatch != "type") {
+		throw bpo::invalid_option_value(
+			"Options: Invalid reaction dispatch (" + reactionDispatch +
+			"), must be fused or type. Aborting!");
+	}
+
+	// Check the flux accumulation
+	if (fluxAccumulation != "atomic" && fluxAccumulation != "gather") {
+		throw bpo::invalid_option_value(
+			"Options: Invalid flux accumulation (" + fluxAccumulation +
+			"), must be atomic or gather. Aborting!");
+	}
+
+	// Check the temperature update
+	if (tempUpdate != "local" && tempUpdate != "global") {
+		throw bpo::invalid_option_value(
+			"Options: Invalid temperature update (" + tempUpdate +
+			"), must be local or global. Aborting!");
+	}
+	if (tempUpdateTolerance < 0.0 || tempUpdateRelTolerance < 0.0) {
+		throw bpo::invalid_option_value(
+			"Options: The temperature update tolerances must be positive. "
+			"Aborting!");
+	}
 }
 
 } // end namespace options
@@ -21,6 +21,9 @@ protected:
 	//! The string of option
 	std::string optionsString;
 
+	//! The perf handler
+	std::shared_ptr<perf::IPerfHandler> perfHandler;
+
 	//! The network
 	std::shared_ptr<core::network::IReactionNetwork> network;
 
@@ -36,13 +39,11 @@ protected:
 	//! The monitor
 	std::shared_ptr<monitor::IMonitor> monitor;
 
-	//! The perf handler
-	std::shared_ptr<perf::IPerfHandler> perfHandler;
-
 public:
 	using SolverHandlerGenerator =
 		std::function<std::shared_ptr<handler::ISolverHandler>(
-			core::network::IReactionNetwork&)>;
+			core::network::IReactionNetwork&,
+			const std::shared_ptr<perf::IPerfHandler>&)>;
 
 	/**
 	 * Default constructor, deleted because we must have arguments to construct.
@@ -419,6 +419,14 @@ public:
 	virtual bool
 	burstBubbles() const = 0;
 
+	/**
+	 * To know if the checkpoints may be written by a background thread.
+	 *
+	 * @return True if the checkpointThread option is set.
+	 */
+	virtual bool
+	useCheckpointThread() const = 0;
+
 	/**
 	 * To know if a temporal profile is used for the flux.
 	 *
@@ -507,6 +515,20 @@ public:
 	virtual core::network::IReactionNetwork&
 	getNetwork() const = 0;
 
+	/**
+	 * Get a view of the concentrations at one grid point that can be passed
+	 * to the network. On host-only builds the array is wrapped without any
+	 * copy, otherwise it is copied into a scratch view owned by the handler
+	 * that is reused by every call. Only one view may thus be in use at a
+	 * time: the next call overwrites the concentrations seen through the
+	 * previous one on device builds.
+	 *
+	 * @param gridPointSolution The concentrations at the grid point
+	 * @return The view on the concentrations
+	 */
+	virtual core::network::IReactionNetwork::ConcentrationsView
+	getConcentrationsView(const double* gridPointSolution) = 0;
+
 	/**
 	 * Get the network name.
 	 *
@@ -28,10 +28,13 @@ public:
 	 * Construct a PetscSolver2DHandler.
 	 *
 	 * @param _network The reaction network to use.
+	 * @param _perfHandler The perf handler to use (a new one is created if
+	 * null).
 	 */
-	PetscSolver2DHandler(
-		NetworkType& _network, const options::IOptions& options) :
-		PetscSolverHandler(_network, options)
+	PetscSolver2DHandler(NetworkType& _network,
+		const options::IOptions& options,
+		const std::shared_ptr<perf::IPerfHandler>& _perfHandler = nullptr) :
+		PetscSolverHandler(_network, options, _perfHandler)
 	{
 	}
 
@@ -41,31 +41,44 @@ checkPetscError(PetscErrorCode errorCode, const char* errorMsg)
 class PetscSolverHandler : public SolverHandler
 {
 protected:
-	//! Partial derivatives for all reactions at one grid point.
-	Kokkos::View<double*> vals;
-
 	//! Map of connectivities
 	SparseFillMap dfill;
 
 	//! The offset at the surface
 	IdType surfaceOffset;
 
+	//! The view type for the data of a batch of grid points
+	using BatchView = Kokkos::View<double**, Kokkos::LayoutRight>;
+
 	/**
-	 * A vector for holding the partial derivatives for one cluster in the order
-	 * that PETSc expects. It is sized in the createSolverContext() operation.
-	 *
-	 * The vector is used for every cluster and immediately reset to zero before
-	 * being used for the next. This allows the acquisition of the partial
-	 * derivatives to take up minimal memory and require no additional dynamic
-	 * allocations.
+	 * Scratch views for the batched reaction computations and their host
+	 * mirrors (the same memory on host-only builds). They are kept across
+	 * calls and only reallocated when a batch has more grid points than
+	 * before.
+	 */
+	BatchView batchConcs;
+	BatchView batchFluxes;
+	BatchView batchPartials;
+	BatchView::HostMirror batchConcsHost;
+	BatchView::HostMirror batchFluxesHost;
+	BatchView::HostMirror batchPartialsHost;
+	NetworkType::GridIndicesView batchGridIds;
+
+	/**
+	 * The offset of each DOF row in the reaction partial derivatives, in CSR
+	 * fashion, and the corresponding column stencils. They are built once
+	 * from the network fill so that the Jacobian rows can be inserted
+	 * directly from the partials without searching the fill map.
 	 */
-	std::vector<double> reactingPartialsForCluster;
+	std::vector<IdType> partialsRowOffsets;
+	std::vector<MatStencil> partialsColIds;
 
 	//! Times and counters
 	std::shared_ptr<perf::ITimer> fluxTimer;
 	std::shared_ptr<perf::ITimer> partialDerivativeTimer;
 	std::shared_ptr<perf::IEventCounter> fluxCounter;
 	std::shared_ptr<perf::IEventCounter> partialDerivativeCounter;
+	std::shared_ptr<perf::IEventCounter> tempUpdateCounter;
 
 	/**
 	 * Convert a C++ sparse fill map representation to the one that
@@ -80,6 +93,126 @@ protected:
 	ConvertToPetscSparseFillMap(size_t dof,
 		const core::network::IReactionNetwork::SparseFillMap& fillMap);
 
+	/**
+	 * The grid points at which the reaction fluxes are computed together.
+	 */
+	struct ReactionFluxBatch
+	{
+		std::vector<const double*> concs;
+		std::vector<double*> fluxes;
+		std::vector<IdType> gridIndices;
+		std::vector<double> depths;
+		std::vector<double> spacings;
+
+		void
+		add(const double* conc, double* flux, IdType gridIndex, double depth,
+			double spacing)
+		{
+			concs.push_back(conc);
+			fluxes.push_back(flux);
+			gridIndices.push_back(gridIndex);
+			depths.push_back(depth);
+			spacings.push_back(spacing);
+		}
+
+		void
+		clear()
+		{
+			concs.clear();
+			fluxes.clear();
+			gridIndices.clear();
+			depths.clear();
+			spacings.clear();
+		}
+	};
+
+	/**
+	 * Compute the reaction fluxes at all the grid points of the batch with a
+	 * single network call, add them to the updated concentrations, and
+	 * empty the batch.
+	 *
+	 * @param batch The grid points to compute.
+	 */
+	void
+	computeBatchedReactionFluxes(ReactionFluxBatch& batch);
+
+	/**
+	 * The grid points at which the reaction partial derivatives are
+	 * computed together.
+	 */
+	struct ReactionPartialsBatch
+	{
+		std::vector<const double*> concs;
+		std::vector<MatStencil> points;
+		std::vector<IdType> gridIndices;
+		std::vector<double> depths;
+		std::vector<double> spacings;
+
+		void
+		add(const double* conc, const MatStencil& point, IdType gridIndex,
+			double depth, double spacing)
+		{
+			concs.push_back(conc);
+			points.push_back(point);
+			gridIndices.push_back(gridIndex);
+			depths.push_back(depth);
+			spacings.push_back(spacing);
+		}
+
+		void
+		clear()
+		{
+			concs.clear();
+			points.clear();
+			gridIndices.clear();
+			depths.clear();
+			spacings.clear();
+		}
+	};
+
+	/**
+	 * Get the concentrations of a batch of grid points as a network view and
+	 * copy their grid indices to the scratch view. On host builds the DMDA
+	 * rows are wrapped without a copy when they are contiguous, otherwise
+	 * they are copied to the scratch view, growing it if needed.
+	 *
+	 * @param concs The pointers to the concentrations at each grid point.
+	 * @param gridIndices The network grid index of each grid point.
+	 * @return The view of the concentrations, one row per grid point
+	 */
+	NetworkType::ConcentrationsBatchView
+	packBatchConcentrations(const std::vector<const double*>& concs,
+		const std::vector<IdType>& gridIndices);
+
+	/**
+	 * Copy the grid indices of a batch of grid points to the scratch view.
+	 *
+	 * @param gridIndices The network grid index of each grid point.
+	 */
+	void
+	setBatchGridIndices(const std::vector<IdType>& gridIndices);
+
+	/**
+	 * Build the CSR row offsets and column stencils used to insert the
+	 * reaction partial derivatives in the Jacobian.
+	 *
+	 * @param fillMap The diagonal fill of the network.
+	 */
+	void
+	initializeReactionPartialsMap(
+		const core::network::IReactionNetwork::SparseFillMap& fillMap);
+
+	/**
+	 * Compute the reaction partial derivatives at all the grid points of the
+	 * batch with a single network call, add them to the Jacobian, and empty
+	 * the batch.
+	 *
+	 * @param J The Jacobian.
+	 * @param batch The grid points to compute.
+	 */
+	void
+	computeBatchedReactionPartials(Mat& J, ReactionPartialsBatch& batch);
+
 public:
 	/**
 	 * Default constructor, deleted because we need to construct with objects.
@@ -90,9 +223,11 @@ public:
 	 * Construct a PetscSolverHandler.
 	 *
 	 * @param _network The reaction network to use.
-	 * @param _perfHandler The perf handler to use.
+	 * @param _perfHandler The perf handler to use (a new one is created if
+	 * null).
 	 */
-	PetscSolverHandler(NetworkType& _network, const options::IOptions& options);
+	PetscSolverHandler(NetworkType& _network, const options::IOptions& options,
+		const std::shared_ptr<perf::IPerfHandler>& _perfHandler = nullptr);
 
 	/**
 	 * Set the number of grid points we want to move by at the surface.
@@ -3,6 +3,7 @@
 // Includes
 #include <xolotl/core/Constants.h>
 #include <xolotl/solver/handler/ISolverHandler.h>
+#include <xolotl/solver/handler/TemperatureChangeTracker.h>
 #include <xolotl/util/MPIUtils.h>
 #include <xolotl/util/RandomNumberGenerator.h>
 
@@ -136,6 +137,9 @@ protected:
 	//! If the user wants to burst bubbles.
 	bool bubbleBursting;
 
+	//! If the user wants the checkpoints written in the background.
+	bool checkpointThread;
+
 	//! If the user wants to use x mirror boundary conditions or periodic ones.
 	bool isMirror;
 
@@ -148,6 +152,9 @@ protected:
 	//! What type of temperature grid to use.
 	bool sameTemperatureGrid;
 
+	//! The grid points where the network temperature has to be updated.
+	TemperatureChangeTracker tempTracker;
+
 	//! If the user wants to use a temporal profile for the flux.
 	bool fluxTempProfile;
 
@@ -184,6 +191,10 @@ protected:
 	//! The random number generator to use.
 	std::unique_ptr<util::RandomNumberGenerator<int, unsigned int>> rng;
 
+	//! The scratch view for the concentrations at one grid point, shared
+	//! by all the views returned by getConcentrationsView().
+	Kokkos::View<double*> scratchConcs;
+
 	/**
 	 * Method generating the grid in the x direction
 	 *
@@ -197,9 +208,11 @@ protected:
 	 * Constructor.
 	 *
 	 * @param _network The reaction network to use.
-	 * @param _perfHandler The perf handler to use.
+	 * @param _perfHandler The perf handler to use (a new one is created if
+	 * null).
 	 */
-	SolverHandler(NetworkType& _network, const options::IOptions& options);
+	SolverHandler(NetworkType& _network, const options::IOptions& options,
+		const std::shared_ptr<perf::IPerfHandler>& _perfHandler = nullptr);
 
 public:
 	//! The Constructor
@@ -578,6 +591,15 @@ public:
 		return bubbleBursting;
 	}
 
+	/**
+	 * \see ISolverHandler.h
+	 */
+	bool
+	useCheckpointThread() const override
+	{
+		return checkpointThread;
+	}
+
 	/**
 	 * \see ISolverHandler.h
 	 */
@@ -715,6 +737,12 @@ public:
 		return network;
 	}
 
+	/**
+	 * \see ISolverHandler.h
+	 */
+	ConcentrationsView
+	getConcentrationsView(const double* gridPointSolution) override;
+
 	/**
 	 * \see ISolverHandler.h
 	 */
@@ -0,0 +1,141 @@
+#pragma once
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <xolotl/config.h>
+#include <xolotl/util/MPIUtils.h>
+
+namespace xolotl
+{
+namespace solver
+{
+namespace handler
+{
+/**
+ * This class keeps track of the grid points where the temperature moved far
+ * enough from the one the network was last updated with for their rates to
+ * be recomputed.
+ *
+ * The comparison is always made against the temperature of the last network
+ * update (and not the previous evaluation) so that slow drifts still trigger
+ * an update once they accumulate, while noise around a value does not.
+ */
+class TemperatureChangeTracker
+{
+public:
+	//! The Constructor
+	TemperatureChangeTracker(double absTol = 0.1, double relTol = 0.0,
+		bool globalUpdate = false) :
+		_absTol(absTol),
+		_relTol(relTol),
+		_globalUpdate(globalUpdate)
+	{
+	}
+
+	/**
+	 * Set the policy.
+	 *
+	 * @param absTol The absolute temperature change (K) triggering an update
+	 * @param relTol The relative temperature change triggering an update
+	 * @param globalUpdate Whether all the processes have to agree on the
+	 * update as soon as one of them sees a change
+	 */
+	void
+	setPolicy(double absTol, double relTol, bool globalUpdate)
+	{
+		_absTol = absTol;
+		_relTol = relTol;
+		_globalUpdate = globalUpdate;
+	}
+
+	//! Forget the changes from the previous evaluation.
+	void
+	clear()
+	{
+		_changedIds.clear();
+	}
+
+	/**
+	 * Compare a new temperature to the one the network was last updated
+	 * with and register the grid point if it has to be updated. A grid
+	 * point whose network temperature was never set (not positive) is
+	 * always updated.
+	 *
+	 * @param networkTemp The temperature of the network at this grid point,
+	 * replaced by the new one if it changed
+	 * @param newTemp The new temperature
+	 * @param gridId The index of the grid point in the network
+	 * @return True if the grid point has to be updated
+	 */
+	bool
+	update(double& networkTemp, double newTemp, IdType gridId)
+	{
+		auto tol = std::max(_absTol, _relTol * std::fabs(networkTemp));
+		if (networkTemp > 0.0 && std::fabs(networkTemp - newTemp) <= tol)
+			return false;
+
+		networkTemp = newTemp;
+		_changedIds.push_back(gridId);
+		return true;
+	}
+
+	/**
+	 * Did any grid point of this process change?
+	 */
+	bool
+	hasChanged() const
+	{
+		return !_changedIds.empty();
+	}
+
+	/**
+	 * Get the grid points that changed since the last clear.
+	 */
+	const std::vector<IdType>&
+	getChangedIds() const
+	{
+		return _changedIds;
+	}
+
+	/**
+	 * Decide if the network of this process has to be updated.
+	 *
+	 * Only the global policy, or a network fed by a collective operation
+	 * (the interpolation from a different temperature grid), needs all the
+	 * processes to agree, which costs a reduction.
+	 *
+	 * @param collective Whether the update involves all the processes
+	 * @return True if the network has to be updated
+	 */
+	bool
+	needsUpdate(bool collective) const
+	{
+		bool changed = hasChanged();
+		if (!collective && !_globalUpdate)
+			return changed;
+
+		bool totalChanged = false;
+		MPI_Allreduce(&changed, &totalChanged, 1, MPI_C_BOOL, MPI_LOR,
+			util::getMPIComm());
+		return totalChanged;
+	}
+
+private:
+	//! The absolute tolerance (K)
+	double _absTol;
+
+	//! The relative tolerance
+	double _relTol;
+
+	//! Whether the processes always agree on the update
+	bool _globalUpdate;
+
+	//! The grid points that changed
+	std::vector<IdType> _changedIds;
+};
+} /* end namespace handler */
+} /* end namespace solver */
+} /* end namespace xolotl */
@@ -27,6 +27,12 @@ public:
 		std::vector<std::vector<std::vector<double>>>& nBulk,
 		std::vector<std::vector<std::vector<double>>>& surfFlux,
 		std::vector<std::vector<std::vector<double>>>& bulkFlux) = 0;
+
+	/**
+	 * Wait for the checkpoints being written and close the checkpoint file.
+	 */
+	virtual void
+	finishCheckpoints() = 0;
 };
 } // namespace monitor
 } // namespace solver
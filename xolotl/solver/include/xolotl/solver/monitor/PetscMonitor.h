@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include <xolotl/io/CheckpointWriter.h>
+#include <xolotl/io/TimeSeriesWriter.h>
 #include <xolotl/solver/handler/ISolverHandler.h>
 #include <xolotl/solver/monitor/IPetscMonitor.h>
 #include <xolotl/viz/IPlot.h>
@@ -26,6 +28,9 @@ public:
 	writeNetwork(MPI_Comm comm, const std::string& targetFileName,
 		const std::string& srcFileName = "") override;
 
+	void
+	finishCheckpoints() override;
+
 	PetscErrorCode
 	monitorTime(
 		TS ts, PetscInt timestep, PetscReal time, Vec solution) override;
@@ -59,6 +64,31 @@ public:
 		PetscReal time, Vec solution, PetscBool) override;
 
 protected:
+	/**
+	 * Get the writer of the checkpoint file, opening the file on first use.
+	 */
+	io::CheckpointWriter&
+	getCheckpointWriter();
+
+	/**
+	 * Write a checkpoint, along with the time series rows buffered for the
+	 * checkpoint file.
+	 *
+	 * @param task The work of the checkpoint.
+	 */
+	void
+	submitCheckpoint(io::CheckpointWriter::Task task);
+
+	/**
+	 * Read the options of the time series writer, before any series is
+	 * registered.
+	 *
+	 * @param hasCheckpoints Whether checkpoints are written, the time
+	 * series can only go to the checkpoint file in that case
+	 */
+	void
+	setupTimeSeries(bool hasCheckpoints);
+
 	TS _ts;
 
 	std::shared_ptr<handler::ISolverHandler> _solverHandler;
@@ -81,6 +111,10 @@ protected:
 	PetscReal _hdf5Stride = 0.0;
 	PetscInt _hdf5Previous = 0;
 	std::string _hdf5OutputName = "xolotlStop.h5";
+	bool _denseConcs = false;
+	std::unique_ptr<io::CheckpointWriter> _checkpointWriter;
+
+	io::TimeSeriesWriter _timeSeries;
 };
 } // namespace monitor
 } // namespace solver
@@ -121,21 +121,22 @@ RHSJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J, void* ctx)
 
 PetscSolver::PetscSolver(const options::IOptions& options) :
 	Solver(options,
-		[&options](core::network::IReactionNetwork& network)
+		[&options](core::network::IReactionNetwork& network,
+			const std::shared_ptr<perf::IPerfHandler>& perfHandler)
 			-> std::shared_ptr<handler::ISolverHandler> {
 			switch (options.getDimensionNumber()) {
 			case 0:
 				return std::make_shared<handler::PetscSolver0DHandler>(
-					network, options);
+					network, options, perfHandler);
 			case 1:
 				return std::make_shared<handler::PetscSolver1DHandler>(
-					network, options);
+					network, options, perfHandler);
 			case 2:
 				return std::make_shared<handler::PetscSolver2DHandler>(
-					network, options);
+					network, options, perfHandler);
 			case 3:
 				return std::make_shared<handler::PetscSolver3DHandler>(
-					network, options);
+					network, options, perfHandler);
 			default:
 				// The asked dimension is not good (e.g. -1, 4)
 				throw std::runtime_error(
@@ -411,6 +412,9 @@ PetscSolver::solve()
 			// Stop the timer
 			solveTimer->stop();
 
+			// The checkpoint file has to be complete before the next loop
+			this->monitor->finishCheckpoints();
+
 			// Save some data from the monitors for next loop
 			this->monitor->keepFlux(
 				_nSurf, _nBulk, _previousSurfFlux, _previousBulkFlux);
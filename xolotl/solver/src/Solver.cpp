@@ -2,26 +2,43 @@
 #include <xolotl/core/network/INetworkHandler.h>
 #include <xolotl/factory/material/MaterialHandlerFactory.h>
 #include <xolotl/factory/network/NetworkHandlerFactory.h>
+#include <xolotl/factory/perf/PerfHandlerFactory.h>
 #include <xolotl/factory/temperature/TemperatureHandlerFactory.h>
+#include <xolotl/perf/ScopedTimer.h>
 #include <xolotl/solver/Solver.h>
 
 namespace xolotl
 {
 namespace solver
 {
+namespace
+{
+/**
+ * Builds the network, timing its construction with the given perf handler.
+ */
+std::shared_ptr<core::network::IReactionNetwork>
+generateNetwork(
+	const options::IOptions& options, perf::IPerfHandler& perfHandler)
+{
+	perf::ScopedTimer myTimer(perfHandler.getTimer("networkSetup"));
+	return factory::network::NetworkHandlerFactory::get(
+		core::network::loadNetworkHandlers)
+		.generate(options)
+		->getNetwork();
+}
+} // namespace
+
 Solver::Solver(
 	const options::IOptions& options, SolverHandlerGenerator handlerGenerator) :
-	network(factory::network::NetworkHandlerFactory::get(
-		core::network::loadNetworkHandlers)
-				.generate(options)
-				->getNetwork()),
+	perfHandler(factory::perf::PerfHandlerFactory::get(perf::loadPerfHandlers)
+					.generate(options)),
+	network(generateNetwork(options, *perfHandler)),
 	materialHandler(
 		factory::material::MaterialHandlerFactory::get().generate(options)),
 	temperatureHandler(
 		factory::temperature::TemperatureHandlerFactory::get().generate(
 			options)),
-	solverHandler(handlerGenerator(*network)),
-	perfHandler(solverHandler->getPerfHandler())
+	solverHandler(handlerGenerator(*network, perfHandler))
 {
 	assert(solverHandler);
 	solverHandler->initializeHandlers(
@@ -30,8 +47,8 @@ Solver::Solver(
 
 Solver::Solver(const std::shared_ptr<handler::ISolverHandler>& _solverHandler) :
 	optionsString(""),
-	solverHandler(_solverHandler),
-	perfHandler(solverHandler->getPerfHandler())
+	perfHandler(_solverHandler->getPerfHandler()),
+	solverHandler(_solverHandler)
 {
 }
 
@@ -59,7 +59,8 @@ PetscSolver0DHandler::createSolverContext(DM& da)
 	temperatureHandler->initializeTemperature(dof, ofill, dfill);
 
 	// Get the diagonal fill
-	auto nPartials = network.getDiagonalFill(dfill);
+	network.getDiagonalFill(dfill);
+	initializeReactionPartialsMap(dfill);
 
 	// Load up the block fills
 	auto dfillsparse = ConvertToPetscSparseFillMap(dof + 1, dfill);
@@ -69,12 +70,6 @@ PetscSolver0DHandler::createSolverContext(DM& da)
 		"PetscSolver0DHandler::createSolverContext: "
 		"DMDASetBlockFills failed.");
 
-	// Initialize the arrays for the reaction partial derivatives
-	vals = Kokkos::View<double*>("solverPartials", nPartials);
-
-	// Set the size of the partial derivatives vectors
-	reactingPartialsForCluster.resize(dof, 0.0);
-
 	// Initialize the flux handler
 	fluxHandler->initializeFluxHandler(network, 0, grid);
 
@@ -141,17 +136,11 @@ PetscSolver0DHandler::initializeConcentration(
 		assert(concGroup);
 		auto tsGroup = concGroup->getLastTimestepGroup();
 		assert(tsGroup);
-		auto myConcs = tsGroup->readConcentrations(*xfile, 0, 1);
-
-		// Apply the concentrations we just read.
 		concOffset = concentrations[0];
+		tsGroup->readConcentrations(*xfile, 0, 1, 0, dof + 1, concOffset);
 
-		for (auto const& currConcData : myConcs[0]) {
-			concOffset[currConcData.first] = currConcData.second;
-		}
 		// Get the temperature
-		double temp = myConcs[0][myConcs[0].size() - 1].second;
-		temperature[0] = temp;
+		temperature[0] = concOffset[dof];
 	}
 
 	// Update the network with the temperature
@@ -300,10 +289,6 @@ PetscSolver0DHandler::updateConcentration(
 	concOffset = concs[0];
 	updatedConcOffset = updatedConcs[0];
 
-	// Degrees of freedom is the total number of clusters in the network +
-	// moments
-	const auto dof = network.getDOF();
-
 	// Update the time in the network
 	network.setTime(ftime);
 
@@ -323,19 +308,9 @@ PetscSolver0DHandler::updateConcentration(
 
 	// ----- Compute the reaction fluxes over the locally owned part of the grid
 	// -----
-	using HostUnmanaged =
-		Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-	auto hConcs = HostUnmanaged(concOffset, dof);
-	auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-	deep_copy(dConcs, hConcs);
-	auto hFlux = HostUnmanaged(updatedConcOffset, dof);
-	auto dFlux = Kokkos::View<double*>("Fluxes", dof);
-	deep_copy(dFlux, hFlux);
-	fluxCounter->increment();
-	fluxTimer->start();
-	network.computeAllFluxes(dConcs, dFlux);
-	fluxTimer->stop();
-	deep_copy(hFlux, dFlux);
+	ReactionFluxBatch fluxBatch;
+	fluxBatch.add(concOffset, updatedConcOffset, 0, 0.0, 0.0);
+	computeBatchedReactionFluxes(fluxBatch);
 
 	/*
 	 Restore vectors
@@ -375,16 +350,6 @@ PetscSolver0DHandler::computeJacobian(
 	// Pointer to the concentrations at a given grid point
 	PetscScalar* concOffset = nullptr;
 
-	// Degrees of freedom is the total number of clusters in the network +
-	// moments
-	const auto dof = network.getDOF();
-
-	// Arguments for MatSetValuesStencil called below
-	MatStencil rowId;
-	MatStencil colIds[dof];
-	MatStencil colId;
-	IdType pdColIdsVectorSize = 0;
-
 	// Set the grid position
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
 
@@ -404,56 +369,10 @@ PetscSolver0DHandler::computeJacobian(
 	}
 
 	// ----- Take care of the reactions for all the reactants -----
-
-	// Compute all the partial derivatives for the reactions
-	using HostUnmanaged =
-		Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-	auto hConcs = HostUnmanaged(concOffset, dof);
-	auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-	deep_copy(dConcs, hConcs);
-	partialDerivativeCounter->increment();
-	partialDerivativeTimer->start();
-	network.computeAllPartials(dConcs, vals);
-	partialDerivativeTimer->stop();
-	auto hPartials = create_mirror_view(vals);
-	deep_copy(hPartials, vals);
-
-	// Variable for the loop on reactants
-	IdType startingIdx = 0;
-
-	// Update the column in the Jacobian that represents each DOF
-	for (auto i = 0; i < dof; i++) {
-		// Set grid coordinate and component number for the row
-		rowId.i = 0;
-		rowId.c = i;
-
-		// Number of partial derivatives
-		auto rowIter = dfill.find(i);
-		if (rowIter != dfill.end()) {
-			const auto& row = rowIter->second;
-			pdColIdsVectorSize = row.size();
-
-			// Loop over the list of column ids
-			for (auto j = 0; j < pdColIdsVectorSize; j++) {
-				// Set grid coordinate and component number for a column in the
-				// list
-				colIds[j].i = 0;
-				colIds[j].c = row[j];
-				// Get the partial derivative from the array of all of the
-				// partials
-				reactingPartialsForCluster[j] = hPartials(startingIdx + j);
-			}
-			// Update the matrix
-			ierr = MatSetValuesStencil(J, 1, &rowId, pdColIdsVectorSize, colIds,
-				reactingPartialsForCluster.data(), ADD_VALUES);
-			checkPetscError(ierr,
-				"PetscSolverExpHandler::computeDiagonalJacobian: "
-				"MatSetValuesStencil (reactions) failed.");
-
-			// Increase the starting index
-			startingIdx += pdColIdsVectorSize;
-		}
-	}
+	ReactionPartialsBatch partialsBatch;
+	MatStencil rowPoint{};
+	partialsBatch.add(concOffset, rowPoint, 0, 0.0, 0.0);
+	computeBatchedReactionPartials(J, partialsBatch);
 
 	/*
 	 Restore vectors
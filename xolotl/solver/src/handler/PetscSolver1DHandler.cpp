@@ -146,7 +146,8 @@ PetscSolver1DHandler::createSolverContext(DM& da)
 	network.setGridSize(localXM + 2);
 
 	// Get the diagonal fill
-	auto nPartials = network.getDiagonalFill(dfill);
+	network.getDiagonalFill(dfill);
+	initializeReactionPartialsMap(dfill);
 
 	// The soret initialization needs to be done after the network
 	// because it adds connectivities the network would remove
@@ -160,12 +161,6 @@ PetscSolver1DHandler::createSolverContext(DM& da)
 		"PetscSolver1DHandler::createSolverContext: "
 		"DMDASetBlockFills failed.");
 
-	// Initialize the arrays for the reaction partial derivatives
-	vals = Kokkos::View<double*>("solverPartials", nPartials + 1);
-
-	// Set the size of the partial derivatives vectors
-	reactingPartialsForCluster.resize(dof, 0.0);
-
 	// Initialize the flux handler
 	fluxHandler->initializeFluxHandler(network, 0, grid);
 
@@ -267,19 +262,14 @@ PetscSolver1DHandler::initializeConcentration(
 			assert(concGroup);
 			auto tsGroup = concGroup->getLastTimestepGroup();
 			assert(tsGroup);
-			auto myConcs =
-				tsGroup->readConcentrations(*xfile, localXS, localXM);
+			// Our grid points are contiguous in the local array, so they
+			// are read in place.
+			tsGroup->readConcentrations(*xfile, localXS, localXM, 0, dof + 1,
+				concentrations[localXS]);
 
-			// Apply the concentrations we just read.
+			// Get the temperature
 			for (auto i = 0; i < localXM; ++i) {
-				concOffset = concentrations[localXS + i];
-
-				for (auto const& currConcData : myConcs[i]) {
-					concOffset[currConcData.first] = currConcData.second;
-				}
-				// Get the temperature
-				double temp = myConcs[i][myConcs[i].size() - 1].second;
-				temperature[i + 1] = temp;
+				temperature[i + 1] = concentrations[localXS + i][dof];
 			}
 		}
 
@@ -565,11 +555,7 @@ PetscSolver1DHandler::initGBLocation(DM& da, Vec& C)
 			// Get the local concentration
 			concOffset = concentrations[xi];
 
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(concOffset, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
+			auto dConcs = getConcentrationsView(concOffset);
 
 			// Transfer the local amount of Xe clusters
 			setLocalXeRate(
@@ -794,11 +780,7 @@ PetscSolver1DHandler::updateConcentration(
 			concOffset = concs[xi];
 
 			// Sum the total atom concentration
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(concOffset, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
+			auto dConcs = getConcentrationsView(concOffset);
 			atomConc +=
 				psiNetwork.getTotalTrappedHeliumConcentration(dConcs, 0) *
 				(grid[xi + 1] - grid[xi]);
@@ -818,9 +800,14 @@ PetscSolver1DHandler::updateConcentration(
 	double* concVector[3]{nullptr};
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
 
+	// The step sizes and the points where the heat equation is computed in
+	// one pass
+	std::vector<double> tempHxLefts(localXM, 1.0), tempHxRights(localXM, 1.0);
+	std::vector<std::uint8_t> tempPoints(localXM, 0);
+
 	// Loop over grid points first for the temperature, including the ghost
 	// points
-	bool tempHasChanged = false;
+	tempTracker.clear();
 	for (auto xi = (PetscInt)localXS - 1;
 		 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 		// Heat condition
@@ -873,11 +860,9 @@ PetscSolver1DHandler::updateConcentration(
 		temperatureHandler->setTemperature(concOffset);
 		double temp = temperatureHandler->getTemperature(gridPosition, ftime);
 
-		// Update the network if the temperature changed
-		if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
-			temperature[xi + 1 - localXS] = temp;
-			tempHasChanged = true;
-		}
+		// Register the grid point if the temperature changed
+		tempTracker.update(
+			temperature[xi + 1 - localXS], temp, xi + 1 - localXS);
 
 		// Boundary conditions
 		// Everything to the left of the surface is empty
@@ -895,12 +880,6 @@ PetscSolver1DHandler::updateConcentration(
 		if (skip)
 			continue;
 
-		// Fill the concVector with the pointer to the middle, left, and right
-		// grid points
-		concVector[0] = concOffset; // middle
-		concVector[1] = concs[(PetscInt)xi - 1]; // left
-		concVector[2] = concs[xi + 1]; // right
-
 		// Compute the left and right hx
 		double hxLeft = 0.0, hxRight = 0.0;
 		if (xi >= 1 && xi < nX) {
@@ -916,21 +895,23 @@ PetscSolver1DHandler::updateConcentration(
 			hxRight = temperatureGrid[xi + 1] - temperatureGrid[xi];
 		}
 
-		// ---- Compute the temperature over the locally owned part of the grid
-		// -----
+		// ---- Register the grid point for the temperature -----
 		if (xi >= localXS && xi < localXS + localXM) {
-			temperatureHandler->computeTemperature(
-				ftime, concVector, updatedConcOffset, hxLeft, hxRight, xi);
+			tempHxLefts[xi - localXS] = hxLeft;
+			tempHxRights[xi - localXS] = hxRight;
+			tempPoints[xi - localXS] = 1;
 		}
 	}
 
-	// Share the information with all the processes
-	bool totalTempHasChanged = false;
-	auto xolotlComm = util::getMPIComm();
-	MPI_Allreduce(&tempHasChanged, &totalTempHasChanged, 1, MPI_C_BOOL, MPI_LOR,
-		xolotlComm);
+	// ---- Compute the temperature over the locally owned part of the grid
+	// -----
+	temperatureHandler->computeTemperatureLine(ftime, &concs, updatedConcs,
+		tempHxLefts.data(), tempHxRights.data(), tempPoints.data(), localXS,
+		localXM);
 
-	if (totalTempHasChanged) {
+	// Only the interpolation from a different temperature grid needs all the
+	// processes to update their network together
+	if (tempTracker.needsUpdate(!sameTemperatureGrid)) {
 		// Update the network with the temperature
 		auto networkTemp = interpolateTemperature();
 		std::vector<double> depths;
@@ -942,9 +923,23 @@ PetscSolver1DHandler::updateConcentration(
 					(grid[localXS + i + 1] + grid[localXS + i]) / 2.0 -
 					grid[1]);
 		}
-		network.setTemperatures(networkTemp, depths);
+		if (sameTemperatureGrid)
+			network.setTemperatures(
+				networkTemp, depths, tempTracker.getChangedIds());
+		else
+			network.setTemperatures(networkTemp, depths);
+		tempUpdateCounter->increment();
 	}
 
+	// The grid points where the reaction fluxes are computed in one batch
+	ReactionFluxBatch fluxBatch;
+
+	// The step sizes, positions, and points where the diffusion and advection
+	// are computed in one pass
+	std::vector<double> hxLefts(localXM, 1.0), hxRights(localXM, 1.0);
+	std::vector<double> xPositions(localXM, 0.0);
+	std::vector<std::uint8_t> diffusionPoints(localXM, 0);
+
 	// Loop over grid points computing ODE terms for each grid point
 	for (auto xi = localXS; xi < localXS + localXM; xi++) {
 		// Compute the old and new array offsets
@@ -998,17 +993,11 @@ PetscSolver1DHandler::updateConcentration(
 		// ----- Account for flux of incoming particles -----
 		fluxHandler->computeIncidentFlux(ftime, updatedConcOffset, xi, 0);
 
-		// ---- Compute diffusion over the locally owned part of the grid -----
-		diffusionHandler->computeDiffusion(network, concVector,
-			updatedConcOffset, hxLeft, hxRight, xi - localXS);
-
-		// ---- Compute advection over the locally owned part of the grid -----
-		// Set the grid position
-		gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
-		for (auto i = 0; i < advectionHandlers.size(); i++) {
-			advectionHandlers[i]->computeAdvection(network, gridPosition,
-				concVector, updatedConcOffset, hxLeft, hxRight, xi - localXS);
-		}
+		// ---- Register the grid point for the diffusion and advection -----
+		hxLefts[xi - localXS] = hxLeft;
+		hxRights[xi - localXS] = hxRight;
+		xPositions[xi - localXS] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
+		diffusionPoints[xi - localXS] = 1;
 
 		auto surfacePos = grid[1];
 		auto curXPos = (grid[xi] + grid[xi + 1]) / 2.0;
@@ -1016,24 +1005,27 @@ PetscSolver1DHandler::updateConcentration(
 		auto curDepth = curXPos - surfacePos;
 		auto curSpacing = curXPos - prevXPos;
 
-		// ----- Compute the reaction fluxes over the locally owned part of the
-		// grid -----
-		using HostUnmanaged =
-			Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-		auto hConcs = HostUnmanaged(concOffset, dof);
-		auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-		deep_copy(dConcs, hConcs);
-		auto hFlux = HostUnmanaged(updatedConcOffset, dof);
-		auto dFlux = Kokkos::View<double*>("Fluxes", dof);
-		deep_copy(dFlux, hFlux);
-		fluxCounter->increment();
-		fluxTimer->start();
-		network.computeAllFluxes(
-			dConcs, dFlux, xi + 1 - localXS, curDepth, curSpacing);
-		fluxTimer->stop();
-		deep_copy(hFlux, dFlux);
+		// ----- Register the grid point for the reaction fluxes -----
+		fluxBatch.add(concOffset, updatedConcOffset, xi + 1 - localXS,
+			curDepth, curSpacing);
+	}
+
+	// ---- Compute diffusion over the locally owned part of the grid -----
+	diffusionHandler->computeDiffusionLine(network, &concs, updatedConcs,
+		hxLefts.data(), hxRights.data(), diffusionPoints.data(), localXS,
+		localXM);
+
+	// ---- Compute advection over the locally owned part of the grid -----
+	for (auto i = 0; i < advectionHandlers.size(); i++) {
+		advectionHandlers[i]->computeAdvectionLine(network, gridPosition,
+			xPositions.data(), &concs, updatedConcs, hxLefts.data(),
+			hxRights.data(), diffusionPoints.data(), localXS, localXM);
 	}
 
+	// ----- Compute the reaction fluxes over the locally owned part of the
+	// grid -----
+	computeBatchedReactionFluxes(fluxBatch);
+
 	/*
 	 Restore vectors
 	 */
@@ -1098,10 +1090,15 @@ PetscSolver1DHandler::computeJacobian(
 	double** concVector = new double*[3];
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
 
+	// The step sizes and the points where the heat equation partials are
+	// computed in one pass
+	std::vector<double> tempHxLefts(localXM, 1.0), tempHxRights(localXM, 1.0);
+	std::vector<std::uint8_t> tempPoints(localXM, 0);
+
 	/*
 	 Loop over grid points for the temperature, including ghosts
 	 */
-	bool tempHasChanged = false;
+	tempTracker.clear();
 	for (auto xi = (PetscInt)localXS - 1;
 		 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 		// Compute the left and right hx
@@ -1177,11 +1174,9 @@ PetscSolver1DHandler::computeJacobian(
 		temperatureHandler->setTemperature(concOffset);
 		double temp = temperatureHandler->getTemperature(gridPosition, ftime);
 
-		// Update the network if the temperature changed
-		if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
-			temperature[xi + 1 - localXS] = temp;
-			tempHasChanged = true;
-		}
+		// Register the grid point if the temperature changed
+		tempTracker.update(
+			temperature[xi + 1 - localXS], temp, xi + 1 - localXS);
 
 		// Boundary conditions
 		// Everything to the left of the surface is empty
@@ -1198,41 +1193,47 @@ PetscSolver1DHandler::computeJacobian(
 		if (skip)
 			continue;
 
-		// Get the partial derivatives for the temperature
+		// Register the grid point for the temperature partials
 		if (xi >= localXS && xi < localXS + localXM) {
-			auto setValues = temperatureHandler->computePartialsForTemperature(
-				ftime, concVector, tempVals, tempIndices, hxLeft, hxRight, xi);
-
-			if (setValues) {
-				// Set grid coordinate and component number for the row
-				row.i = xi;
-				row.c = tempIndices[0];
-
-				// Set grid coordinates and component numbers for the columns
-				// corresponding to the middle, left, and right grid points
-				cols[0].i = xi; // middle
-				cols[0].c = tempIndices[0];
-				cols[1].i = (PetscInt)xi - 1; // left
-				cols[1].c = tempIndices[0];
-				cols[2].i = xi + 1; // right
-				cols[2].c = tempIndices[0];
-
-				ierr = MatSetValuesStencil(
-					J, 1, &row, 3, cols, tempVals, ADD_VALUES);
-				checkPetscError(ierr,
-					"PetscSolver1DHandler::computeJacobian: "
-					"MatSetValuesStencil (temperature) failed.");
-			}
+			tempHxLefts[xi - localXS] = hxLeft;
+			tempHxRights[xi - localXS] = hxRight;
+			tempPoints[xi - localXS] = 1;
 		}
 	}
 
-	// Share the information with all the processes
-	bool totalTempHasChanged = false;
-	auto xolotlComm = util::getMPIComm();
-	MPI_Allreduce(&tempHasChanged, &totalTempHasChanged, 1, MPI_C_BOOL, MPI_LOR,
-		xolotlComm);
+	// Get the partial derivatives for the temperature over the locally owned
+	// part of the grid
+	std::vector<PetscScalar> tempLineVals(3 * localXM, 0.0);
+	auto setTempValues = temperatureHandler->computePartialsForTemperatureLine(
+		ftime, &concs, tempLineVals.data(), tempIndices, tempHxLefts.data(),
+		tempHxRights.data(), tempPoints.data(), localXS, localXM);
+	for (auto xi = localXS; setTempValues && xi < localXS + localXM; xi++) {
+		if (!tempPoints[xi - localXS])
+			continue;
 
-	if (totalTempHasChanged) {
+		// Set grid coordinate and component number for the row
+		row.i = xi;
+		row.c = tempIndices[0];
+
+		// Set grid coordinates and component numbers for the columns
+		// corresponding to the middle, left, and right grid points
+		cols[0].i = xi; // middle
+		cols[0].c = tempIndices[0];
+		cols[1].i = (PetscInt)xi - 1; // left
+		cols[1].c = tempIndices[0];
+		cols[2].i = xi + 1; // right
+		cols[2].c = tempIndices[0];
+
+		ierr = MatSetValuesStencil(J, 1, &row, 3, cols,
+			tempLineVals.data() + 3 * (xi - localXS), ADD_VALUES);
+		checkPetscError(ierr,
+			"PetscSolver1DHandler::computeJacobian: "
+			"MatSetValuesStencil (temperature) failed.");
+	}
+
+	// Only the interpolation from a different temperature grid needs all the
+	// processes to update their network together
+	if (tempTracker.needsUpdate(!sameTemperatureGrid)) {
 		// Update the network with the temperature
 		auto networkTemp = interpolateTemperature();
 		std::vector<double> depths;
@@ -1244,7 +1245,12 @@ PetscSolver1DHandler::computeJacobian(
 					(grid[localXS + i + 1] + grid[localXS + i]) / 2.0 -
 					grid[1]);
 		}
-		network.setTemperatures(networkTemp, depths);
+		if (sameTemperatureGrid)
+			network.setTemperatures(
+				networkTemp, depths, tempTracker.getChangedIds());
+		else
+			network.setTemperatures(networkTemp, depths);
+		tempUpdateCounter->increment();
 	}
 
 	// Computing the trapped atom concentration is only needed for the
@@ -1271,11 +1277,7 @@ PetscSolver1DHandler::computeJacobian(
 			concOffset = concs[xi];
 
 			// Sum the total atom concentration
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(concOffset, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
+			auto dConcs = getConcentrationsView(concOffset);
 			atomConc +=
 				psiNetwork.getTotalTrappedHeliumConcentration(dConcs, 0) *
 				(grid[xi + 1] - grid[xi]);
@@ -1291,10 +1293,8 @@ PetscSolver1DHandler::computeJacobian(
 		psiNetwork.updateTrapMutationDisappearingRate(totalAtomConc);
 	}
 
-	// Arguments for MatSetValuesStencil called below
-	MatStencil rowId;
-	MatStencil colIds[dof];
-	IdType pdColIdsVectorSize = 0;
+	// The grid points where the reaction partials are computed in one batch
+	ReactionPartialsBatch partialsBatch;
 
 	// Loop over the grid points
 	for (auto xi = localXS; xi < localXS + localXM; xi++) {
@@ -1453,57 +1453,16 @@ PetscSolver1DHandler::computeJacobian(
 		auto curDepth = curXPos - surfacePos;
 		auto curSpacing = curXPos - prevXPos;
 
-		// Compute all the partial derivatives for the reactions
-		using HostUnmanaged =
-			Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-		auto hConcs = HostUnmanaged(concOffset, dof);
-		auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-		deep_copy(dConcs, hConcs);
-		partialDerivativeCounter->increment();
-		partialDerivativeTimer->start();
-		network.computeAllPartials(
-			dConcs, vals, xi + 1 - localXS, curDepth, curSpacing);
-		partialDerivativeTimer->stop();
-		auto hPartials = create_mirror_view(vals);
-		deep_copy(hPartials, vals);
-
-		// Variable for the loop on reactants
-		IdType startingIdx = 0;
-
-		// Update the column in the Jacobian that represents each DOF
-		for (auto i = 0; i < dof; i++) {
-			// Set grid coordinate and component number for the row
-			rowId.i = xi;
-			rowId.c = i;
-
-			// Number of partial derivatives
-			auto rowIter = dfill.find(i);
-			if (rowIter != dfill.end()) {
-				const auto& row = rowIter->second;
-				pdColIdsVectorSize = row.size();
-				// Loop over the list of column ids
-				for (auto j = 0; j < pdColIdsVectorSize; j++) {
-					// Set grid coordinate and component number for a column in
-					// the list
-					colIds[j].i = xi;
-					colIds[j].c = row[j];
-					// Get the partial derivative from the array of all of the
-					// partials
-					reactingPartialsForCluster[j] = hPartials(startingIdx + j);
-				}
-				// Update the matrix
-				ierr = MatSetValuesStencil(J, 1, &rowId, pdColIdsVectorSize,
-					colIds, reactingPartialsForCluster.data(), ADD_VALUES);
-				checkPetscError(ierr,
-					"PetscSolverExpHandler::computeJacobian: "
-					"MatSetValuesStencil (reactions) failed.");
-
-				// Increase the starting index
-				startingIdx += pdColIdsVectorSize;
-			}
-		}
+		// ----- Register the grid point for the reaction partials -----
+		MatStencil rowPoint{};
+		rowPoint.i = xi;
+		partialsBatch.add(
+			concOffset, rowPoint, xi + 1 - localXS, curDepth, curSpacing);
 	}
 
+	// ----- Take care of the reactions for all the grid points -----
+	computeBatchedReactionPartials(J, partialsBatch);
+
 	/*
 	 Restore vectors
 	 */
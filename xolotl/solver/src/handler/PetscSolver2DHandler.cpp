@@ -165,7 +165,8 @@ PetscSolver2DHandler::createSolverContext(DM& da)
 	network.setGridSize(localXM + 2);
 
 	// Get the diagonal fill
-	auto nPartials = network.getDiagonalFill(dfill);
+	network.getDiagonalFill(dfill);
+	initializeReactionPartialsMap(dfill);
 
 	// Load up the block fills
 	auto dfillsparse = ConvertToPetscSparseFillMap(dof + 1, dfill);
@@ -175,12 +176,6 @@ PetscSolver2DHandler::createSolverContext(DM& da)
 		"PetscSolver2DHandler::createSolverContext: "
 		"DMDASetBlockFills failed.");
 
-	// Initialize the arrays for the reaction partial derivatives
-	vals = Kokkos::View<double*>("solverPartials", nPartials + 1);
-
-	// Set the size of the partial derivatives vectors
-	reactingPartialsForCluster.resize(dof, 0.0);
-
 	// Initialize the flux handler
 	fluxHandler->initializeFluxHandler(network, surfacePosition[0], grid);
 
@@ -279,28 +274,32 @@ PetscSolver2DHandler::initializeConcentration(
 			auto tsGroup = concGroup->getLastTimestepGroup();
 			assert(tsGroup);
 
-			// Loop on the full grid
-			for (auto j = 0; j < nY; j++)
-				for (auto i = 0; i < nX; i++) {
-					// Read the concentrations from the HDF5 file
-					auto concVector = tsGroup->readGridPoint(i, j);
-
-					// Change the concentration only if we are on the locally
-					// owned part of the grid
-					if (i >= localXS && i < localXS + localXM && j >= localYS &&
-						j < localYS + localYM) {
+			if (tsGroup->hasDenseGridConcentrations()) {
+				// Read our block of the grid with one collective read,
+				// straight into the PETSc array which is contiguous over
+				// the grid points we own
+				tsGroup->readConcentrations(*xfile, localXS, localXM, localYS,
+					localYM, 0, 1, dof + 1, concentrations[localYS][localXS]);
+				for (auto j = localYS; j < localYS + localYM; j++)
+					for (auto i = localXS; i < localXS + localXM; i++) {
+						// Get the temperature
+						temperature[i - localXS + 1] =
+							concentrations[j][i][dof];
+					}
+			}
+			else {
+				// Loop on the locally owned part of the grid only, reading
+				// the concentrations from the HDF5 file in place
+				for (auto j = localYS; j < localYS + localYM; j++)
+					for (auto i = localXS; i < localXS + localXM; i++) {
 						concOffset = concentrations[j][i];
-						// Loop on the concVector size
-						for (auto l = 0; l < concVector.size(); l++) {
-							concOffset[(IdType)concVector.at(l).at(0)] =
-								concVector.at(l).at(1);
+						if (tsGroup->readGridPoint(
+								concOffset, dof + 1, i, j)) {
+							// Get the temperature
+							temperature[i - localXS + 1] = concOffset[dof];
 						}
-						// Get the temperature
-						double temp =
-							concVector.at(concVector.size() - 1).at(1);
-						temperature[i - localXS + 1] = temp;
 					}
-				}
+			}
 		}
 
 		// Update the network with the temperature
@@ -595,11 +594,7 @@ PetscSolver2DHandler::initGBLocation(DM& da, Vec& C)
 			// Get the local concentration
 			concOffset = concentrations[yj][xi];
 
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(concOffset, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
+			auto dConcs = getConcentrationsView(concOffset);
 
 			// Transfer the local amount of Xe clusters
 			setLocalXeRate(
@@ -816,11 +811,17 @@ PetscSolver2DHandler::updateConcentration(
 	std::vector<double> incidentFluxVector;
 	double atomConc = 0.0, totalAtomConc = 0.0;
 
+	// The step sizes and the points where the heat equation is computed in
+	// one pass for each line
+	std::vector<double> tempHxLefts(localXM, 1.0), tempHxRights(localXM, 1.0);
+	std::vector<std::uint8_t> tempPoints(localXM, 0);
+
 	// Loop over grid points first for the temperature, including the ghost
 	// points in X
 	for (auto yj = localYS; yj < localYS + localYM; yj++) {
 		temperatureHandler->updateSurfacePosition(surfacePosition[yj], grid);
-		bool tempHasChanged = false;
+		std::fill(tempPoints.begin(), tempPoints.end(), 0);
+		tempTracker.clear();
 		for (auto xi = (PetscInt)localXS - 1;
 			 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 			// Heat condition
@@ -876,11 +877,9 @@ PetscSolver2DHandler::updateConcentration(
 			double temp =
 				temperatureHandler->getTemperature(gridPosition, ftime);
 
-			// Update the network if the temperature changed
-			if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
-				temperature[xi + 1 - localXS] = temp;
-				tempHasChanged = true;
-			}
+			// Register the grid point if the temperature changed
+			tempTracker.update(
+				temperature[xi + 1 - localXS], temp, xi + 1 - localXS);
 
 			// Boundary conditions
 			// Everything to the left of the surface is empty
@@ -899,14 +898,6 @@ PetscSolver2DHandler::updateConcentration(
 			if (skip)
 				continue;
 
-			// Fill the concVector with the pointer to the middle, left, and
-			// right grid points
-			concVector[0] = concOffset; // middle
-			concVector[1] = concs[yj][(PetscInt)xi - 1]; // left
-			concVector[2] = concs[yj][xi + 1]; // right
-			concVector[3] = concs[(PetscInt)yj - 1][xi]; // bottom
-			concVector[4] = concs[yj + 1][xi]; // top
-
 			// Compute the left and right hx
 			double hxLeft = 0.0, hxRight = 0.0;
 			if (xi >= 1 && xi < nX) {
@@ -922,17 +913,25 @@ PetscSolver2DHandler::updateConcentration(
 				hxRight = grid[xi + 1] - grid[xi];
 			}
 
-			// ---- Compute the temperature over the locally owned part of the
-			// grid -----
+			// ---- Register the grid point for the temperature -----
 			if (xi >= localXS && xi < localXS + localXM) {
-				temperatureHandler->computeTemperature(ftime, concVector,
-					updatedConcOffset, hxLeft, hxRight, xi, sy, yj);
+				tempHxLefts[xi - localXS] = hxLeft;
+				tempHxRights[xi - localXS] = hxRight;
+				tempPoints[xi - localXS] = 1;
 			}
 		}
 
+		// ---- Compute the temperature over the locally owned part of the
+		// line -----
+		PetscScalar** tempConcLines[3] = {
+			concs[yj], concs[(PetscInt)yj - 1], concs[yj + 1]};
+		temperatureHandler->computeTemperatureLine(ftime, tempConcLines,
+			updatedConcs[yj], tempHxLefts.data(), tempHxRights.data(),
+			tempPoints.data(), localXS, localXM, sy, yj);
+
 		// TODO: it is updated T more than once per MPI process in preparation
 		// of T depending on more than X
-		if (tempHasChanged) {
+		if (tempTracker.hasChanged()) {
 			// Update the network with the temperature
 			std::vector<double> depths;
 			for (auto i = 0; i < temperature.size(); i++) {
@@ -944,10 +943,21 @@ PetscSolver2DHandler::updateConcentration(
 						(grid[localXS + i + 1] + grid[localXS + i]) / 2.0 -
 						grid[surfacePosition[localYS] + 1]);
 			}
-			network.setTemperatures(temperature, depths);
+			network.setTemperatures(
+				temperature, depths, tempTracker.getChangedIds());
+			tempUpdateCounter->increment();
 		}
 	}
 
+	// The grid points where the reaction fluxes are computed in one batch
+	ReactionFluxBatch fluxBatch;
+
+	// The step sizes, positions, and points where the diffusion and advection
+	// are computed in one pass for each line
+	std::vector<double> hxLefts(localXM, 1.0), hxRights(localXM, 1.0);
+	std::vector<double> xPositions(localXM, 0.0);
+	std::vector<std::uint8_t> diffusionPoints(localXM, 0);
+
 	// Loop over grid points
 	for (auto yj = bottomOffset; yj < nY - topOffset; yj++) {
 		// Computing the trapped atom concentration is only needed for the
@@ -975,11 +985,7 @@ PetscSolver2DHandler::updateConcentration(
 					concOffset = concs[yj][xi];
 
 					// Sum the total atom concentration
-					using HostUnmanaged = Kokkos::View<double*,
-						Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-					auto hConcs = HostUnmanaged(concOffset, dof);
-					auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-					deep_copy(dConcs, hConcs);
+					auto dConcs = getConcentrationsView(concOffset);
 					atomConc += psiNetwork.getTotalTrappedHeliumConcentration(
 									dConcs, 0) *
 						(grid[xi + 1] - grid[xi]);
@@ -1009,6 +1015,7 @@ PetscSolver2DHandler::updateConcentration(
 		advectionHandlers[0]->setLocation(
 			grid[surfacePosition[yj] + 1] - grid[1]);
 
+		std::fill(diffusionPoints.begin(), diffusionPoints.end(), 0);
 		for (auto xi = localXS; xi < localXS + localXM; xi++) {
 			// Compute the old and new array offsets
 			concOffset = concs[yj][xi];
@@ -1059,20 +1066,13 @@ PetscSolver2DHandler::updateConcentration(
 			fluxHandler->computeIncidentFlux(
 				ftime, updatedConcOffset, xi, surfacePosition[yj]);
 
-			// ---- Compute diffusion over the locally owned part of the grid
+			// ---- Register the grid point for the diffusion and advection
 			// -----
-			diffusionHandler->computeDiffusion(network, concVector,
-				updatedConcOffset, hxLeft, hxRight, xi - localXS, sy,
-				yj - localYS);
-
-			// ---- Compute advection over the locally owned part of the grid
-			// ----- Set the grid position
-			gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
-			for (auto i = 0; i < advectionHandlers.size(); i++) {
-				advectionHandlers[i]->computeAdvection(network, gridPosition,
-					concVector, updatedConcOffset, hxLeft, hxRight,
-					xi - localXS, hY, yj - localYS);
-			}
+			hxLefts[xi - localXS] = hxLeft;
+			hxRights[xi - localXS] = hxRight;
+			xPositions[xi - localXS] =
+				(grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
+			diffusionPoints[xi - localXS] = 1;
 
 			auto surfacePos = grid[surfacePosition[yj] + 1];
 			auto curXPos = (grid[xi] + grid[xi + 1]) / 2.0;
@@ -1080,25 +1080,38 @@ PetscSolver2DHandler::updateConcentration(
 			auto curDepth = curXPos - surfacePos;
 			auto curSpacing = curXPos - prevXPos;
 
-			// ----- Compute the reaction fluxes over the locally owned part of
-			// the grid -----
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(concOffset, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
-			auto hFlux = HostUnmanaged(updatedConcOffset, dof);
-			auto dFlux = Kokkos::View<double*>("Fluxes", dof);
-			deep_copy(dFlux, hFlux);
-			fluxCounter->increment();
-			fluxTimer->start();
-			network.computeAllFluxes(
-				dConcs, dFlux, xi + 1 - localXS, curDepth, curSpacing);
-			fluxTimer->stop();
-			deep_copy(hFlux, dFlux);
+			// ----- Register the grid point for the reaction fluxes -----
+			fluxBatch.add(concOffset, updatedConcOffset, xi + 1 - localXS,
+				curDepth, curSpacing);
+		}
+
+		// ---- Compute diffusion over the locally owned part of the line
+		// -----
+		PetscScalar** concLines[3] = {
+			concs[yj], concs[(PetscInt)yj - 1], concs[yj + 1]};
+		diffusionHandler->computeDiffusionLine(network, concLines,
+			updatedConcs[yj], hxLefts.data(), hxRights.data(),
+			diffusionPoints.data(), localXS, localXM, sy, yj - localYS);
+
+		// ---- Compute advection over the locally owned part of the line
+		// -----
+		for (auto i = 0; i < advectionHandlers.size(); i++) {
+			advectionHandlers[i]->computeAdvectionLine(network, gridPosition,
+				xPositions.data(), concLines, updatedConcs[yj], hxLefts.data(),
+				hxRights.data(), diffusionPoints.data(), localXS, localXM, hY,
+				yj - localYS);
+		}
+
+		// The attenuation changes the rates for each Y
+		if (useAttenuation) {
+			computeBatchedReactionFluxes(fluxBatch);
 		}
 	}
 
+	// ----- Compute the reaction fluxes over the locally owned part of the
+	// grid -----
+	computeBatchedReactionFluxes(fluxBatch);
+
 	/*
 	 Restore vectors
 	 */
@@ -1143,10 +1156,8 @@ PetscSolver2DHandler::computeJacobian(
 	// Pointer to the concentrations at a given grid point
 	PetscScalar* concOffset = nullptr;
 
-	// Arguments for MatSetValuesStencil called below
-	MatStencil rowId;
-	MatStencil colIds[dof];
-	IdType pdColIdsVectorSize = 0;
+	// The grid points where the reaction partials are computed in one batch
+	ReactionPartialsBatch partialsBatch;
 
 	// Declarations for variables used in the loop
 	double atomConc = 0.0, totalAtomConc = 0.0;
@@ -1173,12 +1184,19 @@ PetscSolver2DHandler::computeJacobian(
 	PetscScalar advecVals[2 * nAdvec];
 	IdType advecIndices[nAdvec];
 
+	// The step sizes, points, and values of the heat equation partials
+	// computed in one pass for each line
+	std::vector<double> tempHxLefts(localXM, 1.0), tempHxRights(localXM, 1.0);
+	std::vector<std::uint8_t> tempPoints(localXM, 0);
+	std::vector<PetscScalar> tempLineVals(5 * localXM, 0.0);
+
 	/*
 	 Loop over grid points for the temperature, including ghosts
 	 */
 	for (auto yj = localYS; yj < localYS + localYM; yj++) {
 		temperatureHandler->updateSurfacePosition(surfacePosition[yj], grid);
-		bool tempHasChanged = false;
+		std::fill(tempPoints.begin(), tempPoints.end(), 0);
+		tempTracker.clear();
 		for (auto xi = (PetscInt)localXS - 1;
 			 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 			// Compute the left and right hx
@@ -1268,11 +1286,9 @@ PetscSolver2DHandler::computeJacobian(
 			double temp =
 				temperatureHandler->getTemperature(gridPosition, ftime);
 
-			// Update the network if the temperature changed
-			if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
-				temperature[xi + 1 - localXS] = temp;
-				tempHasChanged = true;
-			}
+			// Register the grid point if the temperature changed
+			tempTracker.update(
+				temperature[xi + 1 - localXS], temp, xi + 1 - localXS);
 
 			// Boundary conditions
 			// Everything to the left of the surface is empty
@@ -1290,48 +1306,59 @@ PetscSolver2DHandler::computeJacobian(
 			if (skip)
 				continue;
 
-			// Get the partial derivatives for the temperature
+			// Register the grid point for the temperature partials
 			if (xi >= localXS && xi < localXS + localXM) {
-				auto setValues =
-					temperatureHandler->computePartialsForTemperature(ftime,
-						concVector, tempVals, tempIndices, hxLeft, hxRight, xi,
-						sy, yj);
-
-				if (setValues) {
-					// Set grid coordinate and component number for the row
-					row.i = xi;
-					row.j = yj;
-					row.c = tempIndices[0];
+				tempHxLefts[xi - localXS] = hxLeft;
+				tempHxRights[xi - localXS] = hxRight;
+				tempPoints[xi - localXS] = 1;
+			}
+		}
 
-					// Set grid coordinates and component numbers for the
-					// columns corresponding to the middle, left, and right grid
-					// points
-					cols[0].i = xi; // middle
-					cols[0].j = yj;
-					cols[0].c = tempIndices[0];
-					cols[1].i = (PetscInt)xi - 1; // left
-					cols[1].j = yj;
-					cols[1].c = tempIndices[0];
-					cols[2].i = xi + 1; // right
-					cols[2].j = yj;
-					cols[2].c = tempIndices[0];
-					cols[3].i = xi; // bottom
-					cols[3].j = (PetscInt)yj - 1;
-					cols[3].c = tempIndices[0];
-					cols[4].i = xi; // top
-					cols[4].j = yj + 1;
-					cols[4].c = tempIndices[0];
+		// Get the partial derivatives for the temperature over the locally
+		// owned part of the line
+		PetscScalar** tempConcLines[3] = {
+			concs[yj], concs[(PetscInt)yj - 1], concs[yj + 1]};
+		auto setTempValues =
+			temperatureHandler->computePartialsForTemperatureLine(ftime,
+				tempConcLines, tempLineVals.data(), tempIndices,
+				tempHxLefts.data(), tempHxRights.data(), tempPoints.data(),
+				localXS, localXM, sy, yj);
+		for (auto xi = localXS; setTempValues && xi < localXS + localXM; xi++) {
+			if (!tempPoints[xi - localXS])
+				continue;
 
-					ierr = MatSetValuesStencil(
-						J, 1, &row, 5, cols, tempVals, ADD_VALUES);
-					checkPetscError(ierr,
-						"PetscSolver2DHandler::computeJacobian: "
-						"MatSetValuesStencil (temperature) failed.");
-				}
-			}
+			// Set grid coordinate and component number for the row
+			row.i = xi;
+			row.j = yj;
+			row.c = tempIndices[0];
+
+			// Set grid coordinates and component numbers for the
+			// columns corresponding to the middle, left, and right grid
+			// points
+			cols[0].i = xi; // middle
+			cols[0].j = yj;
+			cols[0].c = tempIndices[0];
+			cols[1].i = (PetscInt)xi - 1; // left
+			cols[1].j = yj;
+			cols[1].c = tempIndices[0];
+			cols[2].i = xi + 1; // right
+			cols[2].j = yj;
+			cols[2].c = tempIndices[0];
+			cols[3].i = xi; // bottom
+			cols[3].j = (PetscInt)yj - 1;
+			cols[3].c = tempIndices[0];
+			cols[4].i = xi; // top
+			cols[4].j = yj + 1;
+			cols[4].c = tempIndices[0];
+
+			ierr = MatSetValuesStencil(J, 1, &row, 5, cols,
+				tempLineVals.data() + 5 * (xi - localXS), ADD_VALUES);
+			checkPetscError(ierr,
+				"PetscSolver2DHandler::computeJacobian: "
+				"MatSetValuesStencil (temperature) failed.");
 		}
 
-		if (tempHasChanged) {
+		if (tempTracker.hasChanged()) {
 			// Update the network with the temperature
 			std::vector<double> depths;
 			for (auto i = 0; i < temperature.size(); i++) {
@@ -1343,7 +1370,9 @@ PetscSolver2DHandler::computeJacobian(
 						(grid[localXS + i + 1] + grid[localXS + i]) / 2.0 -
 						grid[surfacePosition[localYS] + 1]);
 			}
-			network.setTemperatures(temperature, depths);
+			network.setTemperatures(
+				temperature, depths, tempTracker.getChangedIds());
+			tempUpdateCounter->increment();
 		}
 	}
 
@@ -1374,11 +1403,7 @@ PetscSolver2DHandler::computeJacobian(
 					concOffset = concs[yj][xi];
 
 					// Sum the total atom concentration
-					using HostUnmanaged = Kokkos::View<double*,
-						Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-					auto hConcs = HostUnmanaged(concOffset, dof);
-					auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-					deep_copy(dConcs, hConcs);
+					auto dConcs = getConcentrationsView(concOffset);
 					atomConc += psiNetwork.getTotalTrappedHeliumConcentration(
 									dConcs, 0) *
 						(grid[xi + 1] - grid[xi]);
@@ -1545,61 +1570,23 @@ PetscSolver2DHandler::computeJacobian(
 			auto curDepth = curXPos - surfacePos;
 			auto curSpacing = curXPos - prevXPos;
 
-			// Compute all the partial derivatives for the reactions
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(concOffset, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
-			partialDerivativeCounter->increment();
-			partialDerivativeTimer->start();
-			network.computeAllPartials(
-				dConcs, vals, xi + 1 - localXS, curDepth, curSpacing);
-			partialDerivativeTimer->stop();
-			auto hPartials = create_mirror_view(vals);
-			deep_copy(hPartials, vals);
-
-			// Variable for the loop on reactants
-			IdType startingIdx = 0;
-			// Update the column in the Jacobian that represents each DOF
-			for (auto i = 0; i < dof; i++) {
-				// Set grid coordinate and component number for the row
-				rowId.i = xi;
-				rowId.j = yj;
-				rowId.c = i;
-
-				// Number of partial derivatives
-				auto rowIter = dfill.find(i);
-				if (rowIter != dfill.end()) {
-					const auto& row = rowIter->second;
-					pdColIdsVectorSize = row.size();
-
-					// Loop over the list of column ids
-					for (auto j = 0; j < pdColIdsVectorSize; j++) {
-						// Set grid coordinate and component number for a column
-						// in the list
-						colIds[j].i = xi;
-						colIds[j].j = yj;
-						colIds[j].c = row[j];
-						// Get the partial derivative from the array of all of
-						// the partials
-						reactingPartialsForCluster[j] =
-							hPartials(startingIdx + j);
-					}
-					// Update the matrix
-					ierr = MatSetValuesStencil(J, 1, &rowId, pdColIdsVectorSize,
-						colIds, reactingPartialsForCluster.data(), ADD_VALUES);
-					checkPetscError(ierr,
-						"PetscSolver2DHandler::computeJacobian: "
-						"MatSetValuesStencil (reactions) failed.");
+			// ----- Register the grid point for the reaction partials -----
+			MatStencil rowPoint{};
+			rowPoint.i = xi;
+			rowPoint.j = yj;
+			partialsBatch.add(
+				concOffset, rowPoint, xi + 1 - localXS, curDepth, curSpacing);
+		}
 
-					// Increase the starting index
-					startingIdx += pdColIdsVectorSize;
-				}
-			}
+		// The attenuation changes the rates for each Y
+		if (useAttenuation) {
+			computeBatchedReactionPartials(J, partialsBatch);
 		}
 	}
 
+	// ----- Take care of the reactions for all the grid points -----
+	computeBatchedReactionPartials(J, partialsBatch);
+
 	/*
 	 Restore vectors
 	 */
@@ -193,7 +193,8 @@ PetscSolver3DHandler::createSolverContext(DM& da)
 	network.setGridSize(localXM + 2);
 
 	// Get the diagonal fill
-	auto nPartials = network.getDiagonalFill(dfill);
+	network.getDiagonalFill(dfill);
+	initializeReactionPartialsMap(dfill);
 
 	// Load up the block fills
 	auto dfillsparse = ConvertToPetscSparseFillMap(dof + 1, dfill);
@@ -203,12 +204,6 @@ PetscSolver3DHandler::createSolverContext(DM& da)
 		"PetscSolver3DHandler::createSolverContext: "
 		"DMDASetBlockFills failed.");
 
-	// Initialize the arrays for the reaction partial derivatives
-	vals = Kokkos::View<double*>("solverPartials", nPartials + 1);
-
-	// Set the size of the partial derivatives vectors
-	reactingPartialsForCluster.resize(dof, 0.0);
-
 	// Initialize the flux handler
 	fluxHandler->initializeFluxHandler(network, surfacePosition[0][0], grid);
 
@@ -311,30 +306,35 @@ PetscSolver3DHandler::initializeConcentration(
 			auto tsGroup = concGroup->getLastTimestepGroup();
 			assert(tsGroup);
 
-			// Loop on the full grid
-			for (auto k = 0; k < nZ; k++)
-				for (auto j = 0; j < nY; j++)
-					for (auto i = 0; i < nX; i++) {
-						// Read the concentrations from the HDF5 file
-						auto concVector = tsGroup->readGridPoint(i, j, k);
-
-						// Change the concentration only if we are on the
-						// locally owned part of the grid
-						if (i >= localXS && i < localXS + localXM &&
-							j >= localYS && j < localYS + localYM &&
-							k >= localZS && k < localZS + localZM) {
+			if (tsGroup->hasDenseGridConcentrations()) {
+				// Read our block of the grid with one collective read,
+				// straight into the PETSc array which is contiguous over
+				// the grid points we own
+				tsGroup->readConcentrations(*xfile, localXS, localXM, localYS,
+					localYM, localZS, localZM, dof + 1,
+					concentrations[localZS][localYS][localXS]);
+				for (auto k = localZS; k < localZS + localZM; k++)
+					for (auto j = localYS; j < localYS + localYM; j++)
+						for (auto i = localXS; i < localXS + localXM; i++) {
+							// Get the temperature
+							temperature[i - localXS + 1] =
+								concentrations[k][j][i][dof];
+						}
+			}
+			else {
+				// Loop on the locally owned part of the grid only, reading
+				// the concentrations from the HDF5 file in place
+				for (auto k = localZS; k < localZS + localZM; k++)
+					for (auto j = localYS; j < localYS + localYM; j++)
+						for (auto i = localXS; i < localXS + localXM; i++) {
 							concOffset = concentrations[k][j][i];
-							// Loop on the concVector size
-							for (auto l = 0; l < concVector.size(); l++) {
-								concOffset[(IdType)concVector.at(l).at(0)] =
-									concVector.at(l).at(1);
+							if (tsGroup->readGridPoint(
+									concOffset, dof + 1, i, j, k)) {
+								// Get the temperature
+								temperature[i - localXS + 1] = concOffset[dof];
 							}
-							// Get the temperature
-							double temp =
-								concVector.at(concVector.size() - 1).at(1);
-							temperature[i - localXS + 1] = temp;
 						}
-					}
+			}
 		}
 
 		// Update the network with the temperature
@@ -638,11 +638,7 @@ PetscSolver3DHandler::initGBLocation(DM& da, Vec& C)
 			// Get the local concentration
 			concOffset = concentrations[zk][yj][xi];
 
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(concOffset, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
+			auto dConcs = getConcentrationsView(concOffset);
 
 			// Transfer the local amount of Xe clusters
 			setLocalXeRate(
@@ -870,13 +866,19 @@ PetscSolver3DHandler::updateConcentration(
 	std::vector<double> incidentFluxVector;
 	double atomConc = 0.0, totalAtomConc = 0.0;
 
+	// The step sizes and the points where the heat equation is computed in
+	// one pass for each line
+	std::vector<double> tempHxLefts(localXM, 1.0), tempHxRights(localXM, 1.0);
+	std::vector<std::uint8_t> tempPoints(localXM, 0);
+
 	// Loop over grid points first for the temperature, including the ghost
 	// points in X
 	for (auto zk = localZS; zk < localZS + localZM; zk++)
 		for (auto yj = localYS; yj < localYS + localYM; yj++) {
 			temperatureHandler->updateSurfacePosition(
 				surfacePosition[yj][zk], grid);
-			bool tempHasChanged = false;
+			std::fill(tempPoints.begin(), tempPoints.end(), 0);
+			tempTracker.clear();
 			for (auto xi = (PetscInt)localXS - 1;
 				 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 				// Heat condition
@@ -938,11 +940,9 @@ PetscSolver3DHandler::updateConcentration(
 				double temp =
 					temperatureHandler->getTemperature(gridPosition, ftime);
 
-				// Update the network if the temperature changed
-				if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
-					temperature[xi + 1 - localXS] = temp;
-					tempHasChanged = true;
-				}
+				// Register the grid point if the temperature changed
+				tempTracker.update(
+					temperature[xi + 1 - localXS], temp, xi + 1 - localXS);
 
 				// Boundary conditions
 				// Everything to the left of the surface is empty
@@ -962,16 +962,6 @@ PetscSolver3DHandler::updateConcentration(
 				if (skip)
 					continue;
 
-				// Fill the concVector with the pointer to the middle, left,
-				// and right grid points
-				concVector[0] = concOffset; // middle
-				concVector[1] = concs[zk][yj][(PetscInt)xi - 1]; // left
-				concVector[2] = concs[zk][yj][xi + 1]; // right
-				concVector[3] = concs[zk][(PetscInt)yj - 1][xi]; // bottom
-				concVector[4] = concs[zk][yj + 1][xi]; // top
-				concVector[5] = concs[(PetscInt)zk - 1][yj][xi]; // front
-				concVector[6] = concs[zk + 1][yj][xi]; // back
-
 				// Compute the left and right hx
 				double hxLeft = 0.0, hxRight = 0.0;
 				if (xi >= 1 && xi < nX) {
@@ -987,17 +977,26 @@ PetscSolver3DHandler::updateConcentration(
 					hxRight = grid[xi + 1] - grid[xi];
 				}
 
-				// ---- Compute the temperature over the locally owned part
-				// of the grid -----
+				// ---- Register the grid point for the temperature -----
 				if (xi >= localXS && xi < localXS + localXM) {
-					temperatureHandler->computeTemperature(ftime, concVector,
-						updatedConcOffset, hxLeft, hxRight, xi, sy, yj, sz, zk);
+					tempHxLefts[xi - localXS] = hxLeft;
+					tempHxRights[xi - localXS] = hxRight;
+					tempPoints[xi - localXS] = 1;
 				}
 			}
 
+			// ---- Compute the temperature over the locally owned part of
+			// the line -----
+			PetscScalar** tempConcLines[5] = {concs[zk][yj],
+				concs[zk][(PetscInt)yj - 1], concs[zk][yj + 1],
+				concs[(PetscInt)zk - 1][yj], concs[zk + 1][yj]};
+			temperatureHandler->computeTemperatureLine(ftime, tempConcLines,
+				updatedConcs[zk][yj], tempHxLefts.data(), tempHxRights.data(),
+				tempPoints.data(), localXS, localXM, sy, yj, sz, zk);
+
 			// TODO: it is updated T more than once per MPI process in
 			// preparation of T depending on more than X
-			if (tempHasChanged) {
+			if (tempTracker.hasChanged()) {
 				// Update the network with the temperature
 				std::vector<double> depths;
 				for (auto i = 0; i < temperature.size(); i++) {
@@ -1009,10 +1008,21 @@ PetscSolver3DHandler::updateConcentration(
 							(grid[localXS + i + 1] + grid[localXS + i]) / 2.0 -
 							grid[surfacePosition[localYS][localZS] + 1]);
 				}
-				network.setTemperatures(temperature, depths);
+				network.setTemperatures(
+					temperature, depths, tempTracker.getChangedIds());
+				tempUpdateCounter->increment();
 			}
 		}
 
+	// The grid points where the reaction fluxes are computed in one batch
+	ReactionFluxBatch fluxBatch;
+
+	// The step sizes, positions, and points where the diffusion and advection
+	// are computed in one pass for each line
+	std::vector<double> hxLefts(localXM, 1.0), hxRights(localXM, 1.0);
+	std::vector<double> xPositions(localXM, 0.0);
+	std::vector<std::uint8_t> diffusionPoints(localXM, 0);
+
 	// Loop over grid points
 	for (auto zk = frontOffset; zk < nZ - backOffset; zk++)
 		for (auto yj = bottomOffset; yj < nY - topOffset; yj++) {
@@ -1043,12 +1053,7 @@ PetscSolver3DHandler::updateConcentration(
 						concOffset = concs[zk][yj][xi];
 
 						// Sum the total atom concentration
-						using HostUnmanaged = Kokkos::View<double*,
-							Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-						auto hConcs = HostUnmanaged(concOffset, dof);
-						auto dConcs =
-							Kokkos::View<double*>("Concentrations", dof);
-						deep_copy(dConcs, hConcs);
+						auto dConcs = getConcentrationsView(concOffset);
 						atomConc +=
 							psiNetwork.getTotalTrappedHeliumConcentration(
 								dConcs, 0) *
@@ -1082,6 +1087,7 @@ PetscSolver3DHandler::updateConcentration(
 			advectionHandlers[0]->setLocation(
 				grid[surfacePosition[yj][zk] + 1] - grid[1]);
 
+			std::fill(diffusionPoints.begin(), diffusionPoints.end(), 0);
 			for (auto xi = localXS; xi < localXS + localXM; xi++) {
 				// Compute the old and new array offsets
 				concOffset = concs[zk][yj][xi];
@@ -1136,21 +1142,13 @@ PetscSolver3DHandler::updateConcentration(
 				fluxHandler->computeIncidentFlux(
 					ftime, updatedConcOffset, xi, surfacePosition[yj][zk]);
 
-				// ---- Compute diffusion over the locally owned part of the
-				// grid -----
-				diffusionHandler->computeDiffusion(network, concVector,
-					updatedConcOffset, hxLeft, hxRight, xi - localXS, sy,
-					yj - localYS, sz, zk - localZS);
-
-				// ---- Compute advection over the locally owned part of the
-				// grid ----- Set the grid position
-				gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
-				for (auto i = 0; i < advectionHandlers.size(); i++) {
-					advectionHandlers[i]->computeAdvection(network,
-						gridPosition, concVector, updatedConcOffset, hxLeft,
-						hxRight, xi - localXS, hY, yj - localYS, hZ,
-						zk - localZS);
-				}
+				// ---- Register the grid point for the diffusion and advection
+				// -----
+				hxLefts[xi - localXS] = hxLeft;
+				hxRights[xi - localXS] = hxRight;
+				xPositions[xi - localXS] =
+					(grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
+				diffusionPoints[xi - localXS] = 1;
 
 				auto surfacePos = grid[surfacePosition[yj][zk] + 1];
 				auto curXPos = (grid[xi] + grid[xi + 1]) / 2.0;
@@ -1158,25 +1156,41 @@ PetscSolver3DHandler::updateConcentration(
 				auto curDepth = curXPos - surfacePos;
 				auto curSpacing = curXPos - prevXPos;
 
-				// ----- Compute the reaction fluxes over the locally owned
-				// part of the grid -----
-				using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-					Kokkos::MemoryUnmanaged>;
-				auto hConcs = HostUnmanaged(concOffset, dof);
-				auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-				deep_copy(dConcs, hConcs);
-				auto hFlux = HostUnmanaged(updatedConcOffset, dof);
-				auto dFlux = Kokkos::View<double*>("Fluxes", dof);
-				deep_copy(dFlux, hFlux);
-				fluxCounter->increment();
-				fluxTimer->start();
-				network.computeAllFluxes(
-					dConcs, dFlux, xi + 1 - localXS, curDepth, curSpacing);
-				fluxTimer->stop();
-				deep_copy(hFlux, dFlux);
+				// ----- Register the grid point for the reaction fluxes -----
+				fluxBatch.add(concOffset, updatedConcOffset, xi + 1 - localXS,
+					curDepth, curSpacing);
+			}
+
+			// ---- Compute diffusion over the locally owned part of the
+			// line -----
+			PetscScalar** concLines[5] = {concs[zk][yj],
+				concs[zk][(PetscInt)yj - 1], concs[zk][yj + 1],
+				concs[(PetscInt)zk - 1][yj], concs[zk + 1][yj]};
+			diffusionHandler->computeDiffusionLine(network, concLines,
+				updatedConcs[zk][yj], hxLefts.data(), hxRights.data(),
+				diffusionPoints.data(), localXS, localXM, sy, yj - localYS,
+				sz, zk - localZS);
+
+			// ---- Compute advection over the locally owned part of the
+			// line -----
+			for (auto i = 0; i < advectionHandlers.size(); i++) {
+				advectionHandlers[i]->computeAdvectionLine(network,
+					gridPosition, xPositions.data(), concLines,
+					updatedConcs[zk][yj], hxLefts.data(), hxRights.data(),
+					diffusionPoints.data(), localXS, localXM, hY, yj - localYS,
+					hZ, zk - localZS);
+			}
+
+			// The attenuation changes the rates for each (Y, Z)
+			if (useAttenuation) {
+				computeBatchedReactionFluxes(fluxBatch);
 			}
 		}
 
+	// ----- Compute the reaction fluxes over the locally owned part of the
+	// grid -----
+	computeBatchedReactionFluxes(fluxBatch);
+
 	/*
 	 Restore vectors
 	 */
@@ -1222,10 +1236,8 @@ PetscSolver3DHandler::computeJacobian(
 	// Pointer to the concentrations at a given grid point
 	PetscScalar* concOffset = nullptr;
 
-	// Arguments for MatSetValuesStencil called below
-	MatStencil rowId;
-	MatStencil colIds[dof];
-	IdType pdColIdsVectorSize = 0;
+	// The grid points where the reaction partials are computed in one batch
+	ReactionPartialsBatch partialsBatch;
 
 	// Declarations for variables used in the loop
 	double atomConc = 0.0, totalAtomConc = 0.0;
@@ -1252,6 +1264,12 @@ PetscSolver3DHandler::computeJacobian(
 	PetscScalar advecVals[2 * nAdvec];
 	IdType advecIndices[nAdvec];
 
+	// The step sizes, points, and values of the heat equation partials
+	// computed in one pass for each line
+	std::vector<double> tempHxLefts(localXM, 1.0), tempHxRights(localXM, 1.0);
+	std::vector<std::uint8_t> tempPoints(localXM, 0);
+	std::vector<PetscScalar> tempLineVals(7 * localXM, 0.0);
+
 	/*
 	 Loop over grid points for the temperature, including ghosts
 	 */
@@ -1259,7 +1277,8 @@ PetscSolver3DHandler::computeJacobian(
 		for (auto yj = localYS; yj < localYS + localYM; yj++) {
 			temperatureHandler->updateSurfacePosition(
 				surfacePosition[yj][zk], grid);
-			bool tempHasChanged = false;
+			std::fill(tempPoints.begin(), tempPoints.end(), 0);
+			tempTracker.clear();
 			for (auto xi = (PetscInt)localXS - 1;
 				 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 				// Compute the left and right hx
@@ -1370,11 +1389,9 @@ PetscSolver3DHandler::computeJacobian(
 				double temp =
 					temperatureHandler->getTemperature(gridPosition, ftime);
 
-				// Update the network if the temperature changed
-				if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
-					temperature[xi + 1 - localXS] = temp;
-					tempHasChanged = true;
-				}
+				// Register the grid point if the temperature changed
+				tempTracker.update(
+					temperature[xi + 1 - localXS], temp, xi + 1 - localXS);
 
 				// Boundary conditions
 				// Everything to the left of the surface is empty
@@ -1393,65 +1410,77 @@ PetscSolver3DHandler::computeJacobian(
 				if (skip)
 					continue;
 
-				// Get the partial derivatives for the temperature
+				// Register the grid point for the temperature partials
 				if (xi >= localXS && xi < localXS + localXM) {
-					auto setValues =
-						temperatureHandler->computePartialsForTemperature(ftime,
-							concVector, tempVals, tempIndices, hxLeft, hxRight,
-							xi, sy, yj, sz, zk);
-
-					if (setValues) {
-						// Set grid coordinate and component number for the
-						// row
-						row.i = xi;
-						row.j = yj;
-						row.k = zk;
-						row.c = tempIndices[0];
+					tempHxLefts[xi - localXS] = hxLeft;
+					tempHxRights[xi - localXS] = hxRight;
+					tempPoints[xi - localXS] = 1;
+				}
+			}
 
-						// Set grid coordinates and component numbers for
-						// the columns corresponding to the middle, left,
-						// and right grid points
-						cols[0].i = xi; // middle
-						cols[0].j = yj;
-						cols[0].k = zk;
-						cols[0].c = tempIndices[0];
-						cols[1].i = (PetscInt)xi - 1; // left
-						cols[1].j = yj;
-						cols[1].k = zk;
-						cols[1].c = tempIndices[0];
-						cols[2].i = xi + 1; // right
-						cols[2].j = yj;
-						cols[2].k = zk;
-						cols[2].c = tempIndices[0];
-						cols[3].i = xi; // bottom
-						cols[3].j = (PetscInt)yj - 1;
-						cols[3].k = zk;
-						cols[3].c = tempIndices[0];
-						cols[4].i = xi; // top
-						cols[4].j = yj + 1;
-						cols[4].k = zk;
-						cols[4].c = tempIndices[0];
-						cols[5].i = xi; // front
-						cols[5].j = yj;
-						cols[5].k = (PetscInt)zk - 1;
-						cols[5].c = tempIndices[0];
-						cols[6].i = xi; // back
-						cols[6].j = yj;
-						cols[6].k = zk + 1;
-						cols[6].c = tempIndices[0];
+			// Get the partial derivatives for the temperature over the
+			// locally owned part of the line
+			PetscScalar** tempConcLines[5] = {concs[zk][yj],
+				concs[zk][(PetscInt)yj - 1], concs[zk][yj + 1],
+				concs[(PetscInt)zk - 1][yj], concs[zk + 1][yj]};
+			auto setTempValues =
+				temperatureHandler->computePartialsForTemperatureLine(ftime,
+					tempConcLines, tempLineVals.data(), tempIndices,
+					tempHxLefts.data(), tempHxRights.data(), tempPoints.data(),
+					localXS, localXM, sy, yj, sz, zk);
+			for (auto xi = localXS; setTempValues && xi < localXS + localXM;
+				 xi++) {
+				if (!tempPoints[xi - localXS])
+					continue;
 
-						ierr = MatSetValuesStencil(
-							J, 1, &row, 7, cols, tempVals, ADD_VALUES);
-						checkPetscError(ierr,
-							"PetscSolver3DHandler::computeJacobian: "
-							"MatSetValuesStencil (temperature) failed.");
-					}
-				}
+				// Set grid coordinate and component number for the row
+				row.i = xi;
+				row.j = yj;
+				row.k = zk;
+				row.c = tempIndices[0];
+
+				// Set grid coordinates and component numbers for the
+				// columns corresponding to the middle, left, and right grid
+				// points
+				cols[0].i = xi; // middle
+				cols[0].j = yj;
+				cols[0].k = zk;
+				cols[0].c = tempIndices[0];
+				cols[1].i = (PetscInt)xi - 1; // left
+				cols[1].j = yj;
+				cols[1].k = zk;
+				cols[1].c = tempIndices[0];
+				cols[2].i = xi + 1; // right
+				cols[2].j = yj;
+				cols[2].k = zk;
+				cols[2].c = tempIndices[0];
+				cols[3].i = xi; // bottom
+				cols[3].j = (PetscInt)yj - 1;
+				cols[3].k = zk;
+				cols[3].c = tempIndices[0];
+				cols[4].i = xi; // top
+				cols[4].j = yj + 1;
+				cols[4].k = zk;
+				cols[4].c = tempIndices[0];
+				cols[5].i = xi; // front
+				cols[5].j = yj;
+				cols[5].k = (PetscInt)zk - 1;
+				cols[5].c = tempIndices[0];
+				cols[6].i = xi; // back
+				cols[6].j = yj;
+				cols[6].k = zk + 1;
+				cols[6].c = tempIndices[0];
+
+				ierr = MatSetValuesStencil(J, 1, &row, 7, cols,
+					tempLineVals.data() + 7 * (xi - localXS), ADD_VALUES);
+				checkPetscError(ierr,
+					"PetscSolver3DHandler::computeJacobian: "
+					"MatSetValuesStencil (temperature) failed.");
 			}
 
 			// TODO: it is updated T more than once per MPI process in
 			// preparation of T depending on more than X
-			if (tempHasChanged) {
+			if (tempTracker.hasChanged()) {
 				// Update the network with the temperature
 				std::vector<double> depths;
 				for (auto i = 0; i < temperature.size(); i++) {
@@ -1463,7 +1492,9 @@ PetscSolver3DHandler::computeJacobian(
 							(grid[localXS + i + 1] + grid[localXS + i]) / 2.0 -
 							grid[surfacePosition[localYS][localZS] + 1]);
 				}
-				network.setTemperatures(temperature, depths);
+				network.setTemperatures(
+					temperature, depths, tempTracker.getChangedIds());
+				tempUpdateCounter->increment();
 			}
 		}
 
@@ -1497,12 +1528,7 @@ PetscSolver3DHandler::computeJacobian(
 						concOffset = concs[zk][yj][xi];
 
 						// Sum the total atom concentration
-						using HostUnmanaged = Kokkos::View<double*,
-							Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-						auto hConcs = HostUnmanaged(concOffset, dof);
-						auto dConcs =
-							Kokkos::View<double*>("Concentrations", dof);
-						deep_copy(dConcs, hConcs);
+						auto dConcs = getConcentrationsView(concOffset);
 						atomConc +=
 							psiNetwork.getTotalTrappedHeliumConcentration(
 								dConcs, 0) *
@@ -1697,65 +1723,24 @@ PetscSolver3DHandler::computeJacobian(
 				auto curDepth = curXPos - surfacePos;
 				auto curSpacing = curXPos - prevXPos;
 
-				// Compute all the partial derivatives for the reactions
-				using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-					Kokkos::MemoryUnmanaged>;
-				auto hConcs = HostUnmanaged(concOffset, dof);
-				auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-				deep_copy(dConcs, hConcs);
-				partialDerivativeCounter->increment();
-				partialDerivativeTimer->start();
-				network.computeAllPartials(
-					dConcs, vals, xi + 1 - localXS, curDepth, curSpacing);
-				partialDerivativeTimer->stop();
-				auto hPartials = create_mirror_view(vals);
-				deep_copy(hPartials, vals);
-
-				// Variable for the loop on reactants
-				IdType startingIdx = 0;
-				// Update the column in the Jacobian that represents each
-				// DOF
-				for (auto i = 0; i < dof; i++) {
-					// Set grid coordinate and component number for the row
-					rowId.i = xi;
-					rowId.j = yj;
-					rowId.k = zk;
-					rowId.c = i;
-
-					// Number of partial derivatives
-					auto rowIter = dfill.find(i);
-					if (rowIter != dfill.end()) {
-						const auto& row = rowIter->second;
-						pdColIdsVectorSize = row.size();
-
-						// Loop over the list of column ids
-						for (auto j = 0; j < pdColIdsVectorSize; j++) {
-							// Set grid coordinate and component number for
-							// a column in the list
-							colIds[j].i = xi;
-							colIds[j].j = yj;
-							colIds[j].k = zk;
-							colIds[j].c = row[j];
-							// Get the partial derivative from the array of
-							// all of the partials
-							reactingPartialsForCluster[j] =
-								hPartials(startingIdx + j);
-						}
-						// Update the matrix
-						ierr = MatSetValuesStencil(J, 1, &rowId,
-							pdColIdsVectorSize, colIds,
-							reactingPartialsForCluster.data(), ADD_VALUES);
-						checkPetscError(ierr,
-							"PetscSolver3DHandler::computeJacobian: "
-							"MatSetValuesStencil (reactions) failed.");
+				// ----- Register the grid point for the reaction partials -----
+				MatStencil rowPoint{};
+				rowPoint.i = xi;
+				rowPoint.j = yj;
+				rowPoint.k = zk;
+				partialsBatch.add(concOffset, rowPoint, xi + 1 - localXS,
+					curDepth, curSpacing);
+			}
 
-						// Increase the starting index
-						startingIdx += pdColIdsVectorSize;
-					}
-				}
+			// The attenuation changes the rates for each (Y, Z)
+			if (useAttenuation) {
+				computeBatchedReactionPartials(J, partialsBatch);
 			}
 		}
 
+	// ----- Take care of the reactions for all the grid points -----
+	computeBatchedReactionPartials(J, partialsBatch);
+
 	/*
 	 Restore vectors
 	 */
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <xolotl/solver/handler/PetscSolverHandler.h>
 
 namespace xolotl
@@ -6,18 +8,197 @@ namespace solver
 {
 namespace handler
 {
-PetscSolverHandler::PetscSolverHandler(
-	NetworkType& _network, const options::IOptions& options) :
-	SolverHandler(_network, options),
+PetscSolverHandler::PetscSolverHandler(NetworkType& _network,
+	const options::IOptions& options,
+	const std::shared_ptr<perf::IPerfHandler>& _perfHandler) :
+	SolverHandler(_network, options, _perfHandler),
 	fluxTimer(perfHandler->getTimer("Flux")),
 	partialDerivativeTimer(perfHandler->getTimer("Partial Derivatives")),
 	fluxCounter(perfHandler->getEventCounter("Flux")),
 	partialDerivativeCounter(
 		perfHandler->getEventCounter("Partial Derivatives")),
+	tempUpdateCounter(perfHandler->getEventCounter("Temperature Updates")),
 	surfaceOffset(0)
 {
 }
 
+namespace
+{
+/**
+ * Reallocate the batch view (and its host mirror) if it is too small.
+ */
+template <typename TView, typename TMirror>
+void
+growBatchView(TView& view, TMirror& mirror, const std::string& label,
+	std::size_t nRows, std::size_t width)
+{
+	if (view.extent(0) < nRows || view.extent(1) != width) {
+		view = TView(label, nRows, width);
+		mirror = create_mirror_view(view);
+	}
+}
+} // namespace
+
+NetworkType::ConcentrationsBatchView
+PetscSolverHandler::packBatchConcentrations(
+	const std::vector<const double*>& concs,
+	const std::vector<IdType>& gridIndices)
+{
+	const auto nRows = concs.size();
+	const auto dof = network.getDOF();
+
+	setBatchGridIndices(gridIndices);
+
+	// The rows of a grid line follow each other in the DMDA array (with the
+	// temperature as last component), wrap them directly when the network
+	// can read host memory
+	constexpr bool hostAccessible = Kokkos::SpaceAccessibility<
+		BatchView::memory_space, Kokkos::HostSpace>::accessible;
+	if constexpr (hostAccessible) {
+		bool contiguous = true;
+		for (std::size_t b = 1; b < nRows && contiguous; ++b) {
+			contiguous = (concs[b] == concs[0] + b * (dof + 1));
+		}
+		if (contiguous) {
+			return NetworkType::ConcentrationsBatchView(
+				const_cast<double*>(concs[0]), nRows, dof + 1);
+		}
+	}
+
+	growBatchView(batchConcs, batchConcsHost, "Concentrations", nRows, dof);
+	for (std::size_t b = 0; b < nRows; ++b) {
+		std::copy(concs[b], concs[b] + dof, &batchConcsHost(b, 0));
+	}
+	auto rows = std::make_pair(std::size_t{0}, nRows);
+	deep_copy(Kokkos::subview(batchConcs, rows, Kokkos::ALL),
+		Kokkos::subview(batchConcsHost, rows, Kokkos::ALL));
+
+	return batchConcs;
+}
+
+void
+PetscSolverHandler::setBatchGridIndices(const std::vector<IdType>& gridIndices)
+{
+	const auto nRows = gridIndices.size();
+
+	if (batchGridIds.extent(0) != nRows) {
+		batchGridIds = NetworkType::GridIndicesView("Grid Indices", nRows);
+	}
+	for (std::size_t b = 0; b < nRows; ++b) {
+		batchGridIds.h_view(b) = gridIndices[b];
+	}
+	batchGridIds.modify_host();
+	batchGridIds.sync_device();
+}
+
+void
+PetscSolverHandler::computeBatchedReactionFluxes(ReactionFluxBatch& batch)
+{
+	const auto nRows = batch.concs.size();
+	if (nRows == 0) {
+		return;
+	}
+	const auto dof = network.getDOF();
+
+	auto dConcs = packBatchConcentrations(batch.concs, batch.gridIndices);
+	growBatchView(batchFluxes, batchFluxesHost, "Fluxes", nRows, dof);
+	auto rows = std::make_pair(std::size_t{0}, nRows);
+	auto dFluxes = Kokkos::subview(batchFluxes, rows, Kokkos::ALL);
+	Kokkos::deep_copy(dFluxes, 0.0);
+
+	fluxCounter->increment();
+	fluxTimer->start();
+	network.computeAllFluxes(
+		dConcs, dFluxes, batchGridIds, batch.depths, batch.spacings);
+	fluxTimer->stop();
+
+	// Add the reaction fluxes to the other contributions
+	auto hFluxes = Kokkos::subview(batchFluxesHost, rows, Kokkos::ALL);
+	deep_copy(hFluxes, dFluxes);
+	for (std::size_t b = 0; b < nRows; ++b) {
+		for (std::size_t i = 0; i < dof; ++i) {
+			batch.fluxes[b][i] += hFluxes(b, i);
+		}
+	}
+
+	batch.clear();
+}
+
+void
+PetscSolverHandler::initializeReactionPartialsMap(
+	const core::network::IReactionNetwork::SparseFillMap& fillMap)
+{
+	const auto dof = network.getDOF();
+	partialsRowOffsets.assign(dof + 1, 0);
+	partialsColIds.clear();
+	for (std::size_t i = 0; i < dof; ++i) {
+		partialsRowOffsets[i] = partialsColIds.size();
+		auto rowIter = fillMap.find(i);
+		if (rowIter == fillMap.end()) {
+			continue;
+		}
+		for (auto colId : rowIter->second) {
+			MatStencil col{};
+			col.c = colId;
+			partialsColIds.push_back(col);
+		}
+	}
+	partialsRowOffsets[dof] = partialsColIds.size();
+}
+
+void
+PetscSolverHandler::computeBatchedReactionPartials(
+	Mat& J, ReactionPartialsBatch& batch)
+{
+	const auto nRows = batch.concs.size();
+	if (nRows == 0) {
+		return;
+	}
+	const auto dof = network.getDOF();
+	const auto nPartials = partialsColIds.size();
+
+	auto dConcs = packBatchConcentrations(batch.concs, batch.gridIndices);
+	growBatchView(
+		batchPartials, batchPartialsHost, "Partials", nRows, nPartials);
+	auto rows = std::make_pair(std::size_t{0}, nRows);
+	auto dPartials = Kokkos::subview(batchPartials, rows, Kokkos::ALL);
+
+	partialDerivativeCounter->increment();
+	partialDerivativeTimer->start();
+	network.computeAllPartials(
+		dConcs, dPartials, batchGridIds, batch.depths, batch.spacings);
+	partialDerivativeTimer->stop();
+	auto hPartials = Kokkos::subview(batchPartialsHost, rows, Kokkos::ALL);
+	deep_copy(hPartials, dPartials);
+
+	// Insert each row directly from the partials
+	PetscErrorCode ierr;
+	for (std::size_t b = 0; b < nRows; ++b) {
+		auto rowId = batch.points[b];
+		for (auto& colId : partialsColIds) {
+			colId.i = rowId.i;
+			colId.j = rowId.j;
+			colId.k = rowId.k;
+		}
+		for (std::size_t i = 0; i < dof; ++i) {
+			auto rowStart = partialsRowOffsets[i];
+			auto rowSize = partialsRowOffsets[i + 1] - rowStart;
+			if (rowSize == 0) {
+				continue;
+			}
+			rowId.c = i;
+			ierr = MatSetValuesStencil(J, 1, &rowId, rowSize,
+				partialsColIds.data() + rowStart, &hPartials(b, rowStart),
+				ADD_VALUES);
+			checkPetscError(ierr,
+				"PetscSolverHandler::computeBatchedReactionPartials: "
+				"MatSetValuesStencil (reactions) failed.");
+		}
+	}
+
+	batch.clear();
+}
+
 std::vector<PetscInt>
 PetscSolverHandler::ConvertToPetscSparseFillMap(
 	size_t dof, const core::network::IReactionNetwork::SparseFillMap& fillMap)
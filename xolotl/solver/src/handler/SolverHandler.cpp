@@ -10,8 +10,9 @@ namespace solver
 {
 namespace handler
 {
-SolverHandler::SolverHandler(
-	NetworkType& _network, const options::IOptions& options) :
+SolverHandler::SolverHandler(NetworkType& _network,
+	const options::IOptions& options,
+	const std::shared_ptr<perf::IPerfHandler>& _perfHandler) :
 	network(_network),
 	networkName(""),
 	nX(0),
@@ -36,6 +37,7 @@ SolverHandler::SolverHandler(
 	dimension(-1),
 	movingSurface(false),
 	bubbleBursting(false),
+	checkpointThread(false),
 	isMirror(true),
 	isRobin(false),
 	useAttenuation(false),
@@ -45,8 +47,10 @@ SolverHandler::SolverHandler(
 	fluxHandler(nullptr),
 	temperatureHandler(nullptr),
 	vizHandler(factory::viz::VizHandlerFactory::get().generate(options)),
-	perfHandler(factory::perf::PerfHandlerFactory::get(perf::loadPerfHandlers)
-					.generate(options)),
+	perfHandler(_perfHandler ?
+			_perfHandler :
+			factory::perf::PerfHandlerFactory::get(perf::loadPerfHandlers)
+				.generate(options)),
 	diffusionHandler(nullptr),
 	soretDiffusionHandler(nullptr),
 	tauBursting(10.0),
@@ -511,9 +515,16 @@ SolverHandler::initializeHandlers(core::material::IMaterialHandler* material,
 		tempGridPower = opts.getTempGridPower();
 	}
 
+	// When the network temperature is updated
+	tempTracker.setPolicy(opts.getTempUpdateTolerance(),
+		opts.getTempUpdateRelTolerance(), opts.getTempUpdate() == "global");
+
 	// Do we want a flux temporal profile?
 	fluxTempProfile = opts.useFluxTimeProfile();
 
+	// Can the checkpoints be written in the background?
+	checkpointThread = opts.useCheckpointThread();
+
 	// Boundary conditions in the X direction
 	if (opts.getBCString() == "periodic")
 		isMirror = false;
@@ -563,6 +574,27 @@ SolverHandler::initializeHandlers(core::material::IMaterialHandler* material,
 	return;
 }
 
+SolverHandler::ConcentrationsView
+SolverHandler::getConcentrationsView(const double* gridPointSolution)
+{
+	const auto dof = network.getDOF();
+	auto concs = const_cast<double*>(gridPointSolution);
+	if constexpr (std::is_same_v<Kokkos::DefaultExecutionSpace::memory_space,
+					  Kokkos::HostSpace>) {
+		// The network can read the PETSc array directly
+		return ConcentrationsView(concs, dof);
+	}
+	else {
+		if (scratchConcs.extent(0) != dof) {
+			scratchConcs = Kokkos::View<double*>("Concentrations", dof);
+		}
+		using HostUnmanaged =
+			Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+		deep_copy(scratchConcs, HostUnmanaged(concs, dof));
+		return scratchConcs;
+	}
+}
+
 void
 SolverHandler::createLocalNE(IdType a, IdType b, IdType c)
 {
@@ -1,5 +1,10 @@
+#include <algorithm>
+
+#include <xolotl/io/CheckpointWriter.h>
 #include <xolotl/io/XFile.h>
+#include <xolotl/solver/PetscSolver.h>
 #include <xolotl/solver/monitor/PetscMonitor.h>
+#include <xolotl/util/Log.h>
 #include <xolotl/util/MPIUtils.h>
 
 namespace xolotl
@@ -168,6 +173,87 @@ PetscMonitor::~PetscMonitor()
 {
 }
 
+void
+PetscMonitor::finishCheckpoints()
+{
+	// The rows buffered since the last checkpoint go with a last write
+	if (_timeSeries.getPolicy().format == io::TimeSeriesWriter::Format::hdf5) {
+		getCheckpointWriter().submit([rows = _timeSeries.takeRows()](
+										 io::XFile& checkpointFile, MPI_Comm) {
+			rows.write(checkpointFile);
+		});
+	}
+	_checkpointWriter.reset();
+	_timeSeries.flush();
+}
+
+io::CheckpointWriter&
+PetscMonitor::getCheckpointWriter()
+{
+	if (!_checkpointWriter) {
+		_checkpointWriter = std::make_unique<io::CheckpointWriter>(
+			_hdf5OutputName, util::getMPIComm(),
+			_solverHandler->useCheckpointThread());
+	}
+	return *_checkpointWriter;
+}
+
+void
+PetscMonitor::submitCheckpoint(io::CheckpointWriter::Task task)
+{
+	if (_timeSeries.getPolicy().format == io::TimeSeriesWriter::Format::hdf5) {
+		task = [task = std::move(task), rows = _timeSeries.takeRows()](
+				   io::XFile& checkpointFile, MPI_Comm comm) {
+			task(checkpointFile, comm);
+			rows.write(checkpointFile);
+		};
+	}
+	getCheckpointWriter().submit(std::move(task));
+}
+
+void
+PetscMonitor::setupTimeSeries(bool hasCheckpoints)
+{
+	io::TimeSeriesWriter::Policy policy;
+
+	// Check the option -series_hdf5 to write the time series in the
+	// checkpoint file instead of text files
+	PetscBool flagHDF5;
+	auto ierr = PetscOptionsHasName(NULL, NULL, "-series_hdf5", &flagHDF5);
+	checkPetscError(
+		ierr, "setupTimeSeries: PetscOptionsHasName (-series_hdf5) failed.");
+	if (flagHDF5) {
+		if (hasCheckpoints) {
+			policy.format = io::TimeSeriesWriter::Format::hdf5;
+		}
+		else {
+			XOLOTL_LOG_WARN << "-series_hdf5 needs -start_stop, the time "
+							   "series are written in text files.";
+		}
+	}
+
+	// Check the options giving how many rows and how much time (s) can go
+	// by before the text files are written
+	PetscBool flag;
+	PetscInt maxRows;
+	ierr = PetscOptionsGetInt(NULL, NULL, "-series_rows", &maxRows, &flag);
+	checkPetscError(
+		ierr, "setupTimeSeries: PetscOptionsGetInt (-series_rows) failed.");
+	if (flag) {
+		policy.maxRows = std::max<PetscInt>(maxRows, 1);
+	}
+	PetscReal maxSeconds;
+	ierr = PetscOptionsGetReal(
+		NULL, NULL, "-series_interval", &maxSeconds, &flag);
+	checkPetscError(ierr,
+		"setupTimeSeries: PetscOptionsGetReal (-series_interval) failed.");
+	if (flag) {
+		policy.maxSeconds = maxSeconds;
+	}
+
+	_timeSeries.setPolicy(policy);
+}
+
 void
 PetscMonitor::writeNetwork(MPI_Comm comm, const std::string& targetFileName,
 	const std::string& srcFileName)
@@ -175,6 +261,27 @@ PetscMonitor::writeNetwork(MPI_Comm comm, const std::string& targetFileName,
 	int procId;
 	MPI_Comm_rank(comm, &procId);
 
+	// Check the option -link_network to reference the network from another
+	// file instead of copying it into every checkpoint file
+	PetscBool flagLink;
+	auto ierr = PetscOptionsHasName(NULL, NULL, "-link_network", &flagLink);
+	checkPetscError(
+		ierr, "writeNetwork: PetscOptionsHasName (-link_network) failed.");
+
+	// Write the network once in a file named after its content, next to
+	// the checkpoint file, and link to it
+	auto& network = _solverHandler->getNetwork();
+	auto linkToSharedFile = [&network, &targetFileName]() {
+		auto sharedFileName = io::XFile::NetworkGroup::writeSharedFile(
+			fs::absolute(targetFileName).parent_path(), network);
+		io::XFile sharedFile(sharedFileName, MPI_COMM_SELF,
+			io::XFile::AccessMode::OpenReadOnly);
+		io::XFile checkpointFile(targetFileName, MPI_COMM_SELF,
+			io::XFile::AccessMode::OpenReadWrite);
+		io::XFile::NetworkGroup netGroup(sharedFile);
+		netGroup.linkTo(checkpointFile);
+	};
+
 	// Check if we are supposed to copy the network from
 	// another object into our new checkpoint file.
 	if (procId == 0) {
@@ -189,23 +296,34 @@ PetscMonitor::writeNetwork(MPI_Comm comm, const std::string& targetFileName,
 
 			// Check if given file even has a network group.
 			auto srcNetGroup = srcFile.getGroup<io::XFile::NetworkGroup>();
-			if (srcNetGroup) {
+			if (srcNetGroup and flagLink and
+				not srcNetGroup->isSharedFile(network)) {
+				// The given file may be the checkpoint of another run,
+				// which can be overwritten, only link to a shared file
+				linkToSharedFile();
+			}
+			else if (srcNetGroup) {
 				// Given file has a network group.  Copy it.
 				// First open the checkpoint file using a single-process
 				// communicator...
 				io::XFile checkpointFile(targetFileName, MPI_COMM_SELF,
 					io::XFile::AccessMode::OpenReadWrite);
 
-				// ...then do the copy.
-				srcNetGroup->copyTo(checkpointFile);
+				// ...then do the copy, or the link.
+				if (flagLink)
+					srcNetGroup->linkTo(checkpointFile);
+				else
+					srcNetGroup->copyTo(checkpointFile);
 			}
 		}
+		else if (flagLink) {
+			linkToSharedFile();
+		}
 		else {
 			// Write from scratch
 			io::XFile checkpointFile(targetFileName, MPI_COMM_SELF,
 				io::XFile::AccessMode::OpenReadWrite);
-			io::XFile::NetworkGroup netGroup(
-				checkpointFile, _solverHandler->getNetwork());
+			io::XFile::NetworkGroup netGroup(checkpointFile, network);
 		}
 	}
 }
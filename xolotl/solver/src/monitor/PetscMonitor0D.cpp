@@ -2,6 +2,7 @@
 #include <xolotl/core/network/FeReactionNetwork.h>
 #include <xolotl/core/network/NEReactionNetwork.h>
 #include <xolotl/core/network/ZrReactionNetwork.h>
+#include <xolotl/io/CheckpointWriter.h>
 #include <xolotl/io/XFile.h>
 #include <xolotl/solver/PetscSolver.h>
 #include <xolotl/solver/monitor/PetscMonitor0D.h>
@@ -96,6 +97,9 @@ PetscMonitor0D::setup(int loop)
 	checkPetscError(ierr,
 		"setupPetsc0DMonitor: PetscOptionsHasName (-largest_conc) failed.");
 
+	// The time series go to text files or the checkpoint file
+	setupTimeSeries(flagStatus);
+
 	// Determine if we have an existing restart file,
 	// and if so, it it has had timesteps written to it.
 	std::unique_ptr<io::XFile> networkFile;
@@ -171,18 +175,17 @@ PetscMonitor0D::setup(int loop)
 	if (flagAlloy) {
 		auto& network = _solverHandler->getNetwork();
 		auto numSpecies = network.getSpeciesListSize();
-		// Create/open the output files
-		std::fstream outputFile;
-		outputFile.open("Alloy.dat", std::fstream::out);
-		outputFile << "#time_step time ";
+		// Create/open the output file, written with 5 significant digits
+		// after the time step number
+		std::vector<std::string> columns = {"time_step", "time"};
 		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
 			auto speciesName = network.getSpeciesName(id);
-			outputFile << speciesName << "_density " << speciesName
-					   << "_diameter " << speciesName << "_partial_density "
-					   << speciesName << "_partial_diameter ";
+			columns.insert(columns.end(),
+				{speciesName + "_density", speciesName + "_diameter",
+					speciesName + "_partial_density",
+					speciesName + "_partial_diameter"});
 		}
-		outputFile << std::endl;
-		outputFile.close();
+		_timeSeries.addSeries("Alloy.dat", std::move(columns), true, 5, 1);
 
 		// computeAlloy0D will be called at each timestep
 		ierr = TSMonitorSet(_ts, monitor::computeAlloy, this, nullptr);
@@ -194,20 +197,18 @@ PetscMonitor0D::setup(int loop)
 		auto& network = _solverHandler->getNetwork();
 		auto numSpecies = network.getSpeciesListSize();
 
-		// Create/open the output files
-		std::fstream outputFile;
-		outputFile.open("AlphaZr.dat", std::fstream::out);
-		outputFile << "#time_step time ";
+		// Create/open the output file, written with 5 significant digits
+		// after the time step number
+		std::vector<std::string> columns = {"time_step", "time"};
 		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
 			auto speciesName = network.getSpeciesName(id);
-			outputFile << speciesName << "_density " << speciesName << "_atom "
-					   << speciesName << "_diameter " << speciesName
-					   << "_partial_density " << speciesName << "_partial_atom "
-					   << speciesName << "_partial_diameter ";
+			columns.insert(columns.end(),
+				{speciesName + "_density", speciesName + "_atom",
+					speciesName + "_diameter", speciesName + "_partial_density",
+					speciesName + "_partial_atom",
+					speciesName + "_partial_diameter"});
 		}
-
-		outputFile << std::endl;
-		outputFile.close();
+		_timeSeries.addSeries("AlphaZr.dat", std::move(columns), true, 5, 1);
 
 		// computeAlphaZr will be called at each timestep
 		ierr = TSMonitorSet(_ts, monitor::computeAlphaZr, this, nullptr);
@@ -238,12 +239,10 @@ PetscMonitor0D::setup(int loop)
 			"failed.");
 
 		// Uncomment to clear the file where the retention will be written
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt");
-		outputFile << "#time Xenon_conc radius partial_radius "
-					  "partial_bubble_conc partial_size"
-				   << std::endl;
-		outputFile.close();
+		_timeSeries.addSeries("retentionOut.txt",
+			{"time", "Xenon_conc", "radius", "partial_radius",
+				"partial_bubble_conc", "partial_size"},
+			true);
 	}
 
 	// Set the monitor to monitor the concentration of the largest cluster
@@ -276,6 +275,14 @@ PetscMonitor0D::setup(int loop)
 		if (!flag)
 			_hdf5Stride = 1.0;
 
+		// Check the option -dense_concs to write the concentrations
+		// with the dense layout
+		PetscBool flagDense;
+		ierr = PetscOptionsHasName(NULL, NULL, "-dense_concs", &flagDense);
+		checkPetscError(ierr,
+			"setupPetsc0DMonitor: PetscOptionsHasName (-dense_concs) failed.");
+		_denseConcs = flagDense;
+
 		// Compute the correct _hdf5Previous for a restart
 		// Get the last time step written in the HDF5 file
 		if (hasConcentrations) {
@@ -407,46 +414,57 @@ PetscMonitor0D::startStop(
 	auto& network = _solverHandler->getNetwork();
 	const auto dof = network.getDOF();
 
-	// Create an array for the concentration
-	double concArray[dof + 1][2];
-
-	// Open the existing HDF5 file
-	auto xolotlComm = util::getMPIComm();
-	io::XFile checkpointFile(
-		_hdf5OutputName, xolotlComm, io::XFile::AccessMode::OpenReadWrite);
-
 	// Get the current time step
 	double currentTimeStep;
 	ierr = TSGetTimeStep(ts, &currentTimeStep);
 	CHKERRQ(ierr);
 
-	// Add a concentration time step group for the current time step.
-	auto concGroup = checkpointFile.getGroup<io::XFile::ConcentrationGroup>();
-	assert(concGroup);
-	auto tsGroup = concGroup->addTimestepGroup(
-		_loopNumber, timestep, time, previousTime, currentTimeStep);
-
 	// Determine the concentration values we will write.
-	io::XFile::TimestepGroup::Concs1DType concs(1);
+	io::XFile::TimestepGroup::Concs1DType concs;
+	io::XFile::TimestepGroup::DenseConcsType denseConcs;
 
 	// Access the solution data for the current grid point.
 	gridPointSolution = solutionArray[0];
 
-	for (auto l = 0; l < dof + 1; ++l) {
-		if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-			concs[0].emplace_back(l, gridPointSolution[l]);
+	if (_denseConcs) {
+		denseConcs.assign(gridPointSolution, gridPointSolution + dof + 1);
+	}
+	else {
+		concs.resize(1);
+		for (auto l = 0; l < dof + 1; ++l) {
+			if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
+				concs[0].emplace_back(l, gridPointSolution[l]);
+			}
 		}
 	}
 
-	// Write our concentration data to the current timestep group
-	// in the HDF5 file.
-	// We only write the data for the grid points we own.
-	tsGroup->writeConcentrations(checkpointFile, 0, concs);
-
 	// Restore the solutionArray
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
 	CHKERRQ(ierr);
 
+	// Write the copy of the data to the checkpoint file, possibly in the
+	// background while the solver carries on
+	submitCheckpoint(
+		[loop = _loopNumber, timestep, time, previousTime, currentTimeStep,
+			dof, dense = _denseConcs, concs = std::move(concs),
+			denseConcs = std::move(denseConcs)](
+			io::XFile& checkpointFile, MPI_Comm) {
+			// Add a concentration time step group for the current time step.
+			auto concGroup =
+				checkpointFile.getGroup<io::XFile::ConcentrationGroup>();
+			assert(concGroup);
+			auto tsGroup = concGroup->addTimestepGroup(
+				loop, timestep, time, previousTime, currentTimeStep);
+
+			// Write our concentration data to the current timestep group
+			// in the HDF5 file.
+			if (dense)
+				tsGroup->writeDenseConcentrations(
+					checkpointFile, 0, 1, dof + 1, denseConcs);
+			else
+				tsGroup->writeConcentrations(checkpointFile, 0, concs);
+		});
+
 	PetscFunctionReturn(0);
 }
 
@@ -491,11 +509,7 @@ PetscMonitor0D::computeXenonRetention(
 	// Get the minimum size for the radius
 	auto minSizes = _solverHandler->getMinSizes();
 
-	using HostUnmanaged =
-		Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-	auto hConcs = HostUnmanaged(gridPointSolution, dof);
-	auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-	deep_copy(dConcs, hConcs);
+	auto dConcs = _solverHandler->getConcentrationsView(gridPointSolution);
 
 	// Get the concentrations
 	using TQ = core::network::IReactionNetwork::TotalQuantity;
@@ -525,13 +539,10 @@ PetscMonitor0D::computeXenonRetention(
 	}
 
 	// Uncomment to write the content in a file
-	std::ofstream outputFile;
-	outputFile.open("retentionOut.txt", std::ios::app);
-	outputFile << time << " " << xeConcentration << " "
-			   << radii / bubbleConcentration << " " << averagePartialRadius
-			   << " " << partialBubbleConcentration << " " << averagePartialSize
-			   << std::endl;
-	outputFile.close();
+	_timeSeries.addRow("retentionOut.txt",
+		{time, xeConcentration, radii / bubbleConcentration,
+			averagePartialRadius, partialBubbleConcentration,
+			averagePartialSize});
 
 	// Restore the solutionArray
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
@@ -578,11 +589,7 @@ PetscMonitor0D::computeAlloy(
 	// Get the pointer to the beginning of the solution data for this grid point
 	gridPointSolution = solutionArray[0];
 
-	using HostUnmanaged =
-		Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-	auto hConcs = HostUnmanaged(gridPointSolution, dof);
-	auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-	deep_copy(dConcs, hConcs);
+	auto dConcs = _solverHandler->getConcentrationsView(gridPointSolution);
 
 	// Loop on the species
 	for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
@@ -600,24 +607,10 @@ PetscMonitor0D::computeAlloy(
 		myData[(4 * id()) + 3] = 2.0 * totals[3] / myData[(4 * id()) + 2];
 	}
 
-	// Set the output precision
-	const int outputPrecision = 5;
-
-	// Open the output file
-	std::fstream outputFile;
-	outputFile.open("Alloy.dat", std::fstream::out | std::fstream::app);
-	outputFile << std::setprecision(outputPrecision);
-
 	// Output the data
-	outputFile << timestep << " " << time << " ";
-	for (auto i = 0; i < numSpecies; ++i) {
-		outputFile << myData[i * 4] << " " << myData[(i * 4) + 1] << " "
-				   << myData[(i * 4) + 2] << " " << myData[(i * 4) + 3] << " ";
-	}
-	outputFile << std::endl;
-
-	// Close the output file
-	outputFile.close();
+	std::vector<double> row = {(double)timestep, time};
+	row.insert(row.end(), myData.begin(), myData.end());
+	_timeSeries.addRow("Alloy.dat", row);
 
 	// Restore the PETSc solution array
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
@@ -664,11 +657,7 @@ PetscMonitor0D::computeAlphaZr(
 	// Get the pointer to the beginning of the solution data for this grid point
 	gridPointSolution = solutionArray[0];
 
-	using HostUnmanaged =
-		Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-	auto hConcs = HostUnmanaged(gridPointSolution, dof);
-	auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-	deep_copy(dConcs, hConcs);
+	auto dConcs = _solverHandler->getConcentrationsView(gridPointSolution);
 
 	// Loop on the species
 	for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
@@ -689,27 +678,10 @@ PetscMonitor0D::computeAlphaZr(
 		myData[(6 * id()) + 5] = 2.0 * totals[5] / myData[(6 * id()) + 3];
 	}
 
-	// Set the output precision
-	const int outputPrecision = 5;
-
-	// Open the output file
-	std::fstream outputFile;
-	outputFile.open("AlphaZr.dat", std::fstream::out | std::fstream::app);
-	outputFile << std::setprecision(outputPrecision);
-
 	// Output the data
-	outputFile << timestep << " " << time << " ";
-
-	for (auto i = 0; i < numSpecies; ++i) {
-		outputFile << myData[i * 6] << " " << myData[(i * 6) + 1] << " "
-				   << myData[(i * 6) + 2] << " " << myData[(i * 6) + 3] << " "
-				   << myData[(i * 6) + 4] << " " << myData[(i * 6) + 5] << " ";
-	}
-
-	outputFile << std::endl;
-
-	// Close the output file
-	outputFile.close();
+	std::vector<double> row = {(double)timestep, time};
+	row.insert(row.end(), myData.begin(), myData.end());
+	_timeSeries.addRow("AlphaZr.dat", row);
 
 	// Restore the PETSc solution array
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
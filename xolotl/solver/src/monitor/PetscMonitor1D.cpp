@@ -2,6 +2,7 @@
 #include <xolotl/core/network/AlloyReactionNetwork.h>
 #include <xolotl/core/network/IPSIReactionNetwork.h>
 #include <xolotl/core/network/NEReactionNetwork.h>
+#include <xolotl/io/CheckpointWriter.h>
 #include <xolotl/io/XFile.h>
 #include <xolotl/perf/ScopedTimer.h>
 #include <xolotl/solver/PetscSolver.h>
@@ -159,6 +160,9 @@ PetscMonitor1D::setup(int loop)
 	checkPetscError(ierr,
 		"setupPetsc1DMonitor: PetscOptionsHasName (-largest_conc) failed.");
 
+	// The time series go to text files or the checkpoint file
+	setupTimeSeries(flagStatus);
+
 	// Get the network and its size
 	auto& network = _solverHandler->getNetwork();
 	const auto networkSize = network.getNumClusters();
@@ -295,14 +299,10 @@ PetscMonitor1D::setup(int loop)
 			// Get the sputtering yield
 			_sputteringYield = _solverHandler->getSputteringYield();
 
-			// Master process
-			if (procId == 0 and _loopNumber == 0) {
-				// Clear the file where the surface will be written
-				std::ofstream outputFile;
-				outputFile.open("surface.txt");
-				outputFile << "#time height" << std::endl;
-				outputFile.close();
-			}
+			// The master process clears the file where the surface will be
+			// written
+			_timeSeries.addSeries("surface.txt", {"time", "height"},
+				procId == 0 and _loopNumber == 0);
 		}
 
 		// Set directions and terminate flags for the surface event
@@ -317,13 +317,11 @@ PetscMonitor1D::setup(int loop)
 		checkPetscError(ierr,
 			"setupPetsc1DMonitor: TSSetEventHandler (eventFunction1D) failed.");
 
-		if (_solverHandler->burstBubbles() && procId == 0) {
-			// Uncomment to clear the file where the bursting info will be
-			// written
-			std::ofstream outputFile;
-			outputFile.open("bursting.txt");
-			outputFile << "#time depth" << std::endl;
-			outputFile.close();
+		if (_solverHandler->burstBubbles()) {
+			// The master process clears the file where the bursting info
+			// will be written
+			_timeSeries.addSeries(
+				"bursting.txt", {"time", "depth"}, procId == 0);
 		}
 	}
 
@@ -504,61 +502,58 @@ PetscMonitor1D::setup(int loop)
 			"setupPetsc1DMonitor: TSMonitorSet (computeHeliumRetention) "
 			"failed.");
 
-		// Master process
-		if (procId == 0 and _loopNumber == 0) {
-			// Uncomment to clear the file where the retention will be written
-			std::ofstream outputFile;
-			outputFile.open("retentionOut.txt");
-			outputFile << "#time fluence ";
-			// Get the generated clusters
-			auto factors = fluxHandler->getReductionFactors();
-			for (auto i = 0; i < factors.size(); i++) {
-				outputFile << "fluence_" << i << " ";
-			}
+		// The columns of the file where the retention will be written,
+		// cleared by the master process
+		std::vector<std::string> columns = {"time", "fluence"};
+		// Get the generated clusters
+		auto factors = fluxHandler->getReductionFactors();
+		for (auto i = 0; i < factors.size(); i++) {
+			columns.push_back("fluence_" + std::to_string(i));
+		}
+		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+			auto speciesName = network.getSpeciesName(id);
+			columns.push_back(speciesName + "_content");
+		}
+		if (_solverHandler->getRightOffset() == 1) {
 			for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
 				auto speciesName = network.getSpeciesName(id);
-				outputFile << speciesName << "_content ";
+				columns.push_back(speciesName + "_bulk");
 			}
-			if (_solverHandler->getRightOffset() == 1) {
-				for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
-					auto speciesName = network.getSpeciesName(id);
-					outputFile << speciesName << "_bulk ";
-				}
+		}
+		if (_solverHandler->getLeftOffset() == 1) {
+			for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+				auto speciesName = network.getSpeciesName(id);
+				columns.push_back(speciesName + "_surface");
 			}
-			if (_solverHandler->getLeftOffset() == 1) {
-				for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+		}
+		columns.insert(columns.end(),
+			{"Helium_burst", "Deuterium_burst", "Tritium_burst"});
+		_timeSeries.addSeries("retentionOut.txt", std::move(columns),
+			procId == 0 and _loopNumber == 0);
+
+		if (_solverHandler->temporalFlux()) {
+			// An additional file will keep the flux evolution
+			std::vector<std::string> fluxColumns = {"time"};
+
+			// Get the generated clusters
+			auto indices = fluxHandler->getFluxIndices();
+
+			// Get the bounds
+			auto bounds = network.getAllClusterBounds();
+			// Loop on them
+			for (auto i : indices) {
+				std::string clusterName;
+				for (auto id = core::network::SpeciesId(numSpecies); id;
+					 ++id) {
 					auto speciesName = network.getSpeciesName(id);
-					outputFile << speciesName << "_surface ";
-				}
-			}
-			outputFile << "Helium_burst Deuterium_burst Tritium_burst"
-					   << std::endl;
-			outputFile.close();
-
-			if (_solverHandler->temporalFlux()) {
-				// Open an additional file that will keep the flux evolution
-				outputFile.open("instantFlux.txt");
-				outputFile << "#time ";
-
-				// Get the generated clusters
-				auto indices = fluxHandler->getFluxIndices();
-
-				// Get the bounds
-				auto bounds = network.getAllClusterBounds();
-				// Loop on them
-				for (auto i : indices) {
-					for (auto id = core::network::SpeciesId(numSpecies); id;
-						 ++id) {
-						auto speciesName = network.getSpeciesName(id);
-						if (bounds[i][2 * id()] > 0)
-							outputFile << speciesName << "_"
-									   << bounds[i][2 * id()];
-					}
-					outputFile << " ";
+					if (bounds[i][2 * id()] > 0)
+						clusterName += speciesName + "_" +
+							std::to_string(bounds[i][2 * id()]);
 				}
-				outputFile << std::endl;
-				outputFile.close();
+				fluxColumns.push_back(clusterName);
 			}
+			_timeSeries.addSeries("instantFlux.txt", std::move(fluxColumns),
+				procId == 0 and _loopNumber == 0);
 		}
 	}
 
@@ -600,16 +595,12 @@ PetscMonitor1D::setup(int loop)
 			"setupPetsc1DMonitor: TSMonitorSet (computeXenonRetention) "
 			"failed.");
 
-		// Master process
-		if (procId == 0 and _loopNumber == 0) {
-			// Uncomment to clear the file where the retention will be written
-			std::ofstream outputFile;
-			outputFile.open("retentionOut.txt");
-			outputFile << "#time Xenon_content radius partial_radius "
-						  "partial_bubble_conc partial_size"
-					   << std::endl;
-			outputFile.close();
-		}
+		// The master process clears the file where the retention will be
+		// written
+		_timeSeries.addSeries("retentionOut.txt",
+			{"time", "Xenon_content", "radius", "partial_radius",
+				"partial_bubble_conc", "partial_size"},
+			procId == 0 and _loopNumber == 0);
 	}
 
 	// Set the monitor to output data for TRIDYN
@@ -622,20 +613,18 @@ PetscMonitor1D::setup(int loop)
 
 	// Set the monitor to output data for Alloy
 	if (flagAlloy) {
-		if (procId == 0 and _loopNumber == 0) {
-			// Create/open the output files
-			std::fstream outputFile;
-			outputFile.open("Alloy.dat", std::fstream::out);
-			outputFile << "#time_step time ";
-			for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
-				auto speciesName = network.getSpeciesName(id);
-				outputFile << speciesName << "_density " << speciesName
-						   << "_diameter " << speciesName << "_partial_density "
-						   << speciesName << "_partial_diameter ";
-			}
-			outputFile << std::endl;
-			outputFile.close();
+		// Create/open the output file, written with 5 significant digits
+		// after the time step number
+		std::vector<std::string> columns = {"time_step", "time"};
+		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+			auto speciesName = network.getSpeciesName(id);
+			columns.insert(columns.end(),
+				{speciesName + "_density", speciesName + "_diameter",
+					speciesName + "_partial_density",
+					speciesName + "_partial_diameter"});
 		}
+		_timeSeries.addSeries("Alloy.dat", std::move(columns),
+			procId == 0 and _loopNumber == 0, 5, 1);
 
 		// computeAlloy1D will be called at each timestep
 		ierr = TSMonitorSet(_ts, monitor::computeAlloy, this, nullptr);
@@ -645,37 +634,38 @@ PetscMonitor1D::setup(int loop)
 
 	// Set the monitor to compute the temperature profile
 	if (flagTemp) {
-		if (procId == 0 and _loopNumber == 0) {
-			// Uncomment to clear the file where the retention will be written
-			std::ofstream outputFile;
-			outputFile.open("tempProf.txt");
-
-			// Get the da from _ts
-			DM da;
-			ierr = TSGetDM(_ts, &da);
-			checkPetscError(ierr, "setupPetsc1DMonitor: TSGetDM failed.");
-
-			// Get the total size of the grid
-			PetscInt Mx;
-			ierr = DMDAGetInfo(da, PETSC_IGNORE, &Mx, PETSC_IGNORE,
-				PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE,
-				PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE,
-				PETSC_IGNORE, PETSC_IGNORE);
-			checkPetscError(ierr, "setupPetsc1DMonitor: DMDAGetInfo failed.");
-
-			// Get the physical grid
-			auto grid = _solverHandler->getXGrid();
-
-			// Loop on the entire grid
-			for (auto xi = _solverHandler->getLeftOffset();
-				 xi < Mx - _solverHandler->getRightOffset(); xi++) {
-				// Set x
-				double x = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
-				outputFile << x << " ";
-			}
-			outputFile << std::endl;
-			outputFile.close();
+		// The columns of the file where the temperature profile will be
+		// written are the positions of the grid points, the master process
+		// clears it
+		std::vector<std::string> columns = {"time"};
+
+		// Get the da from _ts
+		DM da;
+		ierr = TSGetDM(_ts, &da);
+		checkPetscError(ierr, "setupPetsc1DMonitor: TSGetDM failed.");
+
+		// Get the total size of the grid
+		PetscInt Mx;
+		ierr = DMDAGetInfo(da, PETSC_IGNORE, &Mx, PETSC_IGNORE, PETSC_IGNORE,
+			PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE,
+			PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE,
+			PETSC_IGNORE);
+		checkPetscError(ierr, "setupPetsc1DMonitor: DMDAGetInfo failed.");
+
+		// Get the physical grid
+		auto grid = _solverHandler->getXGrid();
+
+		// Loop on the entire grid
+		for (auto xi = _solverHandler->getLeftOffset();
+			 xi < Mx - _solverHandler->getRightOffset(); xi++) {
+			// Set x
+			double x = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
+			std::ostringstream xStr;
+			xStr << x;
+			columns.push_back(xStr.str());
 		}
+		_timeSeries.addSeries("tempProf.txt", std::move(columns),
+			procId == 0 and _loopNumber == 0);
 
 		// computeCumulativeHelium1D will be called at each timestep
 		ierr = TSMonitorSet(_ts, monitor::profileTemperature, this, nullptr);
@@ -713,6 +703,14 @@ PetscMonitor1D::setup(int loop)
 		if (!flag)
 			_hdf5Stride = 1.0;
 
+		// Check the option -dense_concs to write the concentrations
+		// with the dense layout
+		PetscBool flagDense;
+		ierr = PetscOptionsHasName(NULL, NULL, "-dense_concs", &flagDense);
+		checkPetscError(ierr,
+			"setupPetsc1DMonitor: PetscOptionsHasName (-dense_concs) failed.");
+		_denseConcs = flagDense;
+
 		// Compute the correct _hdf5Previous for a restart
 		// Get the last time step written in the HDF5 file
 		if (hasConcentrations and _loopNumber == 0) {
@@ -836,9 +834,6 @@ PetscMonitor1D::startStop(
 	if ((PetscInt)((time + dt / 10.0) / _hdf5Stride) > _hdf5Previous)
 		_hdf5Previous++;
 
-	// Gets MPI comm
-	auto xolotlComm = util::getMPIComm();
-
 	// Get the da from ts
 	DM da;
 	ierr = TSGetDM(ts, &da);
@@ -852,28 +847,13 @@ PetscMonitor1D::startStop(
 	auto& network = _solverHandler->getNetwork();
 	const auto dof = network.getDOF();
 
-	// Create an array for the concentration
-	double concArray[dof + 1][2];
-
-	// Open the existing HDF5 file
-	io::XFile checkpointFile(
-		_hdf5OutputName, xolotlComm, io::XFile::AccessMode::OpenReadWrite);
-
 	// Get the current time step
 	double currentTimeStep;
 	ierr = TSGetTimeStep(ts, &currentTimeStep);
 	CHKERRQ(ierr);
 
-	// Add a concentration time step group for the current time step.
-	auto concGroup = checkpointFile.getGroup<io::XFile::ConcentrationGroup>();
-	assert(concGroup);
-	auto tsGroup = concGroup->addTimestepGroup(
-		_loopNumber, timestep, time, previousTime, currentTimeStep);
-
 	// Get the physical grid
 	auto grid = _solverHandler->getXGrid();
-	// Write it in the file
-	tsGroup->writeGrid(grid);
 
 	// Get the names of the species in the network
 	auto numSpecies = network.getSpeciesListSize();
@@ -882,45 +862,87 @@ PetscMonitor1D::startStop(
 		names.push_back(network.getSpeciesName(id));
 	}
 
-	if (_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1) {
-		// Write the surface positions and the associated interstitial
-		// quantities in the concentration sub group
-		tsGroup->writeSurface1D(_nSurf, _previousSurfFlux, names);
-	}
-
-	// Write the bottom impurity information if the bottom is a free surface
-	if (_solverHandler->getRightOffset() == 1)
-		tsGroup->writeBottom1D(_nBulk, _previousBulkFlux, names);
-
-	// Write the bursting information if the bubble bursting is used
-	if (_solverHandler->burstBubbles())
-		tsGroup->writeBursting(_nHeliumBurst, _nDeuteriumBurst, _nTritiumBurst);
-
 	// Determine the concentration values we will write.
 	// We only examine and collect the grid points we own.
 	// TODO measure impact of us building the flattened representation
 	// rather than a ragged 2D representation.
-	io::XFile::TimestepGroup::Concs1DType concs(xm);
-	for (auto i = 0; i < xm; ++i) {
-		// Access the solution data for the current grid point.
-		auto gridPointSolution = solutionArray[xs + i];
-
-		for (auto l = 0; l < dof + 1; ++l) {
-			if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-				concs[i].emplace_back(l, gridPointSolution[l]);
+	io::XFile::TimestepGroup::Concs1DType concs;
+	io::XFile::TimestepGroup::DenseConcsType denseConcs;
+	if (_denseConcs) {
+		denseConcs.reserve(xm * (dof + 1));
+		for (auto i = 0; i < xm; ++i) {
+			auto gridPointSolution = solutionArray[xs + i];
+			denseConcs.insert(denseConcs.end(), gridPointSolution,
+				gridPointSolution + dof + 1);
+		}
+	}
+	else {
+		concs.resize(xm);
+		for (auto i = 0; i < xm; ++i) {
+			// Access the solution data for the current grid point.
+			auto gridPointSolution = solutionArray[xs + i];
+
+			for (auto l = 0; l < dof + 1; ++l) {
+				if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
+					concs[i].emplace_back(l, gridPointSolution[l]);
+				}
 			}
 		}
 	}
 
-	// Write our concentration data to the current timestep group
-	// in the HDF5 file.
-	// We only write the data for the grid points we own.
-	tsGroup->writeConcentrations(checkpointFile, xs, concs);
-
 	// Restore the solutionArray
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
 	CHKERRQ(ierr);
 
+	// Write the copy of the data to the checkpoint file, possibly in the
+	// background while the solver carries on
+	bool writeSurface =
+		_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1;
+	bool writeBottom = _solverHandler->getRightOffset() == 1;
+	bool writeBursting = _solverHandler->burstBubbles();
+	submitCheckpoint(
+		[loop = _loopNumber, timestep, time, previousTime, currentTimeStep,
+			grid = std::move(grid), names = std::move(names), writeSurface,
+			nSurf = _nSurf, surfFlux = _previousSurfFlux, writeBottom,
+			nBulk = _nBulk, bulkFlux = _previousBulkFlux, writeBursting,
+			nHe = _nHeliumBurst, nD = _nDeuteriumBurst, nT = _nTritiumBurst,
+			xs, xm, dof, dense = _denseConcs, concs = std::move(concs),
+			denseConcs = std::move(denseConcs)](
+			io::XFile& checkpointFile, MPI_Comm) {
+			// Add a concentration time step group for the current time step.
+			auto concGroup =
+				checkpointFile.getGroup<io::XFile::ConcentrationGroup>();
+			assert(concGroup);
+			auto tsGroup = concGroup->addTimestepGroup(
+				loop, timestep, time, previousTime, currentTimeStep);
+
+			// Write the grid
+			tsGroup->writeGrid(grid);
+
+			// Write the surface positions and the associated interstitial
+			// quantities in the concentration sub group
+			if (writeSurface)
+				tsGroup->writeSurface1D(nSurf, surfFlux, names);
+
+			// Write the bottom impurity information if the bottom is a free
+			// surface
+			if (writeBottom)
+				tsGroup->writeBottom1D(nBulk, bulkFlux, names);
+
+			// Write the bursting information if the bubble bursting is used
+			if (writeBursting)
+				tsGroup->writeBursting(nHe, nD, nT);
+
+			// Write our concentration data to the current timestep group
+			// in the HDF5 file.
+			// We only write the data for the grid points we own.
+			if (dense)
+				tsGroup->writeDenseConcentrations(
+					checkpointFile, xs, xm, dof + 1, denseConcs);
+			else
+				tsGroup->writeConcentrations(checkpointFile, xs, concs);
+		});
+
 	ierr = computeTRIDYN(ts, timestep, time, solution);
 	CHKERRQ(ierr);
 
@@ -995,11 +1017,7 @@ PetscMonitor1D::computeHeliumRetention(
 
 		double hx = grid[xi + 1] - grid[xi];
 
-		using HostUnmanaged =
-			Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-		auto hConcs = HostUnmanaged(gridPointSolution, dof);
-		auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-		deep_copy(dConcs, hConcs);
+		auto dConcs = _solverHandler->getConcentrationsView(gridPointSolution);
 
 		// Get the total concentrations at this grid point
 		using Quant = core::network::IReactionNetwork::TotalQuantity;
@@ -1218,43 +1236,27 @@ PetscMonitor1D::computeHeliumRetention(
 		XOLOTL_LOG << ss.str();
 
 		// Write the retention and the fluence in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", std::ios::app);
-		outputFile << time << " ";
-		for (auto flu : fluence) {
-			outputFile << flu << " ";
-		}
-		for (auto i = 0; i < numSpecies; ++i) {
-			outputFile << totalConcData[i] << " ";
-		}
+		std::vector<double> row = {time};
+		row.insert(row.end(), fluence.begin(), fluence.end());
+		row.insert(row.end(), totalConcData.begin(), totalConcData.end());
 		if (_solverHandler->getRightOffset() == 1) {
-			for (auto i = 0; i < numSpecies; ++i) {
-				outputFile << _nBulk[i] << " ";
-			}
+			row.insert(row.end(), _nBulk.begin(), _nBulk.end());
 		}
 		if (_solverHandler->getLeftOffset() == 1) {
-			for (auto i = 0; i < numSpecies; ++i) {
-				outputFile << _nSurf[i] << " ";
-			}
+			row.insert(row.end(), _nSurf.begin(), _nSurf.end());
 		}
-		auto tempHandler = _solverHandler->getTemperatureHandler();
-		outputFile << _nHeliumBurst << " " << _nDeuteriumBurst << " "
-				   << _nTritiumBurst << std::endl;
-		outputFile.close();
+		row.insert(
+			row.end(), {_nHeliumBurst, _nDeuteriumBurst, _nTritiumBurst});
+		_timeSeries.addRow("retentionOut.txt", row);
 
 		if (_solverHandler->temporalFlux()) {
-			// Open an additional file that will keep the flux evolution
-			outputFile.open("instantFlux.txt", std::ios::app);
-			outputFile << time << " ";
+			// An additional file keeps the flux evolution
+			std::vector<double> fluxRow = {time};
 			// Get the flux information
 			auto instantFlux = fluxHandler->getInstantFlux(time);
-			// Loop on it
-			for (auto flux : instantFlux) {
-				outputFile << flux << " ";
-			}
-
-			outputFile << std::endl;
-			outputFile.close();
+			fluxRow.insert(
+				fluxRow.end(), instantFlux.begin(), instantFlux.end());
+			_timeSeries.addRow("instantFlux.txt", fluxRow);
 		}
 	}
 
@@ -1334,11 +1336,7 @@ PetscMonitor1D::computeXenonRetention(
 		// point
 		gridPointSolution = solutionArray[xi];
 
-		using HostUnmanaged =
-			Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-		auto hConcs = HostUnmanaged(gridPointSolution, dof);
-		auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-		deep_copy(dConcs, hConcs);
+		auto dConcs = _solverHandler->getConcentrationsView(gridPointSolution);
 
 		// Initialize the volume fraction and hx
 		double hx = grid[xi + 1] - grid[xi];
@@ -1487,13 +1485,9 @@ PetscMonitor1D::computeXenonRetention(
 		}
 
 		// Uncomment to write the content in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", std::ios::app);
-		outputFile << time << " " << totalConcData[0] << " "
-				   << totalConcData[2] / totalConcData[1] << " "
-				   << averagePartialRadius << " " << totalConcData[3] << " "
-				   << averagePartialSize << std::endl;
-		outputFile.close();
+		_timeSeries.addRow("retentionOut.txt",
+			{time, totalConcData[0], totalConcData[2] / totalConcData[1],
+				averagePartialRadius, totalConcData[3], averagePartialSize});
 	}
 
 	// Restore the solutionArray
@@ -1566,11 +1560,7 @@ PetscMonitor1D::computeAlloy(
 		// point
 		gridPointSolution = solutionArray[xi];
 
-		using HostUnmanaged =
-			Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-		auto hConcs = HostUnmanaged(gridPointSolution, dof);
-		auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-		deep_copy(dConcs, hConcs);
+		auto dConcs = _solverHandler->getConcentrationsView(gridPointSolution);
 
 		// Loop on the species
 		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
@@ -1603,25 +1593,10 @@ PetscMonitor1D::computeAlloy(
 			globalData[(4 * i) + 2] /= (grid[Mx] - grid[1]);
 		}
 
-		// Set the output precision
-		const int outputPrecision = 5;
-
-		// Open the output file
-		std::fstream outputFile;
-		outputFile.open("Alloy.dat", std::fstream::out | std::fstream::app);
-		outputFile << std::setprecision(outputPrecision);
-
 		// Output the data
-		outputFile << timestep << " " << time << " ";
-		for (auto i = 0; i < numSpecies; ++i) {
-			outputFile << globalData[i * 4] << " " << globalData[(i * 4) + 1]
-					   << " " << globalData[(i * 4) + 2] << " "
-					   << globalData[(i * 4) + 3] << " ";
-		}
-		outputFile << std::endl;
-
-		// Close the output file
-		outputFile.close();
+		std::vector<double> row = {(double)timestep, time};
+		row.insert(row.end(), globalData.begin(), globalData.end());
+		_timeSeries.addRow("Alloy.dat", row);
 	}
 
 	// Restore the PETSC solution array
@@ -1803,11 +1778,8 @@ PetscMonitor1D::eventFunction(
 	if (_solverHandler->moveSurface()) {
 		// Write the initial surface position
 		if (procId == 0 and tsNumber == 0) {
-			std::ofstream outputFile;
-			outputFile.open("surface.txt", std::ios::app);
-			outputFile << time << " " << grid[grid.size() - 2] - grid[1]
-					   << std::endl;
-			outputFile.close();
+			_timeSeries.addRow(
+				"surface.txt", {time, grid[grid.size() - 2] - grid[1]});
 		}
 
 		// Value to know on which processor is the location of the surface,
@@ -1918,11 +1890,8 @@ PetscMonitor1D::eventFunction(
 				// this grid point
 				gridPointSolution = solutionArray[xi];
 
-				using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-					Kokkos::MemoryUnmanaged>;
-				auto hConcs = HostUnmanaged(gridPointSolution, dof);
-				auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-				deep_copy(dConcs, hConcs);
+				auto dConcs =
+					_solverHandler->getConcentrationsView(gridPointSolution);
 
 				// Compute the helium density at this grid point
 				double heDensity =
@@ -2050,10 +2019,7 @@ PetscMonitor1D::postEventFunction(TS ts, PetscInt nevents, PetscInt eventList[],
 		}
 
 		// Write the bursting information
-		std::ofstream outputFile;
-		outputFile.open("bursting.txt", std::ios::app);
-		outputFile << time << " " << distance << std::endl;
-		outputFile.close();
+		_timeSeries.addRow("bursting.txt", {time, distance});
 
 		// Pinhole case
 		psiNetwork->updateBurstingConcs(gridPointSolution, hxLeft, nBurst);
@@ -2295,11 +2261,8 @@ PetscMonitor1D::computeTRIDYN(
 
 			// Access the solution data for this grid point.
 			auto gridPointSolution = solutionArray[xi];
-			using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-				Kokkos::MemoryUnmanaged>;
-			auto hConcs = HostUnmanaged(gridPointSolution, dof);
-			auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-			deep_copy(dConcs, hConcs);
+			auto dConcs =
+				_solverHandler->getConcentrationsView(gridPointSolution);
 
 			// Get the total concentrations at this grid point
 			auto currIdx = (PetscInt)xi - myFirstIdxToWrite;
@@ -2379,11 +2342,10 @@ PetscMonitor1D::profileTemperature(
 	// Declare the pointer for the concentrations at a specific grid point
 	PetscReal* gridPointSolution;
 
-	// Create the output file
-	std::ofstream outputFile;
+	// Create the row of the output file
+	std::vector<double> row;
 	if (procId == 0) {
-		outputFile.open("tempProf.txt", std::ios::app);
-		outputFile << time;
+		row.push_back(time);
 	}
 
 	// Create the local vector of temperature wrt temperatureGrid
@@ -2422,14 +2384,13 @@ PetscMonitor1D::profileTemperature(
 
 		// The master process writes in the file
 		if (procId == 0) {
-			outputFile << " " << temperature;
+			row.push_back(temperature);
 		}
 	}
 
-	// Close the file
+	// Add the row
 	if (procId == 0) {
-		outputFile << std::endl;
-		outputFile.close();
+		_timeSeries.addRow("tempProf.txt", row);
 	}
 
 	// Restore the solutionArray
@@ -1,6 +1,7 @@
 #include <xolotl/core/Constants.h>
 #include <xolotl/core/network/IPSIReactionNetwork.h>
 #include <xolotl/core/network/NEReactionNetwork.h>
+#include <xolotl/io/CheckpointWriter.h>
 #include <xolotl/io/XFile.h>
 #include <xolotl/perf/ScopedTimer.h>
 #include <xolotl/solver/PetscSolver.h>
@@ -100,6 +101,9 @@ PetscMonitor3D::setup(int loop)
 	checkPetscError(ierr,
 		"setupPetsc3DMonitor: PetscOptionsHasName (-largest_conc) failed.");
 
+	// The time series go to text files or the checkpoint file
+	setupTimeSeries(flagStatus);
+
 	// Get the network and its size
 	auto& network = _solverHandler->getNetwork();
 
@@ -238,13 +242,19 @@ PetscMonitor3D::setup(int loop)
 			_sputteringYield = _solverHandler->getSputteringYield();
 
 			// Master process
-			if (procId == 0 and _loopNumber == 0) {
-				// Clear the file where the surface will be written
-				std::ofstream outputFile;
-				outputFile.open("surface.txt");
-				outputFile << "#time heights" << std::endl;
-				outputFile.close();
+			// The master process clears the file where the surface heights
+			// will be written, with their position
+			std::vector<std::string> columns = {"time"};
+			for (auto yj = 0; yj < My; yj++) {
+				for (auto zk = 0; zk < Mz; zk++) {
+					auto suffix =
+						std::to_string(yj) + "_" + std::to_string(zk);
+					columns.insert(columns.end(),
+						{"y_" + suffix, "z_" + suffix, "height_" + suffix});
+				}
 			}
+			_timeSeries.addSeries("surface.txt", std::move(columns),
+				procId == 0 and _loopNumber == 0);
 		}
 
 		// Bursting
@@ -372,57 +382,54 @@ PetscMonitor3D::setup(int loop)
 			"setupPetsc3DMonitor: TSMonitorSet (computeHeliumRetention) "
 			"failed.");
 
-		// Master process
-		if (procId == 0 and _loopNumber == 0) {
-			auto numSpecies = network.getSpeciesListSize();
-			// Uncomment to clear the file where the retention will be written
-			std::ofstream outputFile;
-			outputFile.open("retentionOut.txt");
-			outputFile << "#time fluence ";
+		// The columns of the file where the retention will be written,
+		// cleared by the master process
+		auto numSpecies = network.getSpeciesListSize();
+		std::vector<std::string> columns = {"time", "fluence"};
+		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+			auto speciesName = network.getSpeciesName(id);
+			columns.push_back(speciesName + "_content");
+		}
+		if (_solverHandler->getRightOffset() == 1) {
 			for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
 				auto speciesName = network.getSpeciesName(id);
-				outputFile << speciesName << "_content ";
+				columns.push_back(speciesName + "_bulk");
 			}
-			if (_solverHandler->getRightOffset() == 1) {
-				for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
-					auto speciesName = network.getSpeciesName(id);
-					outputFile << speciesName << "_bulk ";
-				}
+		}
+		if (_solverHandler->getLeftOffset() == 1) {
+			for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+				auto speciesName = network.getSpeciesName(id);
+				columns.push_back(speciesName + "_surface");
 			}
-			if (_solverHandler->getLeftOffset() == 1) {
-				for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+		}
+		columns.insert(columns.end(),
+			{"Helium_burst", "Deuterium_burst", "Tritium_burst"});
+		_timeSeries.addSeries("retentionOut.txt", std::move(columns),
+			procId == 0 and _loopNumber == 0);
+
+		if (_solverHandler->temporalFlux()) {
+			// An additional file will keep the flux evolution
+			std::vector<std::string> fluxColumns = {"time"};
+
+			// Get the generated clusters
+			auto indices = fluxHandler->getFluxIndices();
+
+			// Get the bounds
+			auto bounds = network.getAllClusterBounds();
+			// Loop on them
+			for (auto i : indices) {
+				std::string clusterName;
+				for (auto id = core::network::SpeciesId(numSpecies); id;
+					 ++id) {
 					auto speciesName = network.getSpeciesName(id);
-					outputFile << speciesName << "_surface ";
+					if (bounds[i][2 * id()] > 0)
+						clusterName += speciesName + "_" +
+							std::to_string(bounds[i][2 * id()]);
 				}
+				fluxColumns.push_back(clusterName);
 			}
-			outputFile << "Helium_burst Deuterium_burst Tritium_burst"
-					   << std::endl;
-			outputFile.close();
-
-			if (_solverHandler->temporalFlux()) {
-				// Open an additional file that will keep the flux evolution
-				outputFile.open("instantFlux.txt");
-				outputFile << "#time ";
-
-				// Get the generated clusters
-				auto indices = fluxHandler->getFluxIndices();
-
-				// Get the bounds
-				auto bounds = network.getAllClusterBounds();
-				// Loop on them
-				for (auto i : indices) {
-					for (auto id = core::network::SpeciesId(numSpecies); id;
-						 ++id) {
-						auto speciesName = network.getSpeciesName(id);
-						if (bounds[i][2 * id()] > 0)
-							outputFile << speciesName << "_"
-									   << bounds[i][2 * id()];
-					}
-					outputFile << " ";
-				}
-				outputFile << std::endl;
-				outputFile.close();
-			}
+			_timeSeries.addSeries("instantFlux.txt", std::move(fluxColumns),
+				procId == 0 and _loopNumber == 0);
 		}
 	}
 
@@ -465,16 +472,11 @@ PetscMonitor3D::setup(int loop)
 			"setupPetsc3DMonitor: TSMonitorSet (computeXenonRetention) "
 			"failed.");
 
-		// Master process
-		if (procId == 0 and _loopNumber == 0) {
-			// Uncomment to clear the file where the retention will be written
-			std::ofstream outputFile;
-			outputFile.open("retentionOut.txt");
-			outputFile << "#time Xenon_content radius partial_radius "
-						  "Xenon_gb"
-					   << std::endl;
-			outputFile.close();
-		}
+		// The master process clears the file where the retention will be
+		// written
+		_timeSeries.addSeries("retentionOut.txt",
+			{"time", "Xenon_content", "radius", "partial_radius", "Xenon_gb"},
+			procId == 0 and _loopNumber == 0);
 	}
 
 	// Set the monitor to save surface plots of clusters concentration
@@ -569,6 +571,14 @@ PetscMonitor3D::setup(int loop)
 		if (!flag)
 			_hdf5Stride = 1.0;
 
+		// Check the option -dense_concs to write the concentrations
+		// with the dense layout
+		PetscBool flagDense;
+		ierr = PetscOptionsHasName(NULL, NULL, "-dense_concs", &flagDense);
+		checkPetscError(ierr,
+			"setupPetsc3DMonitor: PetscOptionsHasName (-dense_concs) failed.");
+		_denseConcs = flagDense;
+
 		// Compute the correct _hdf5Previous for a restart
 		if (hasConcentrations and _loopNumber == 0) {
 			assert(lastTsGroup);
@@ -709,9 +719,6 @@ PetscMonitor3D::startStop(
 	auto& network = _solverHandler->getNetwork();
 	const auto dof = network.getDOF();
 
-	// Create an array for the concentration
-	double concArray[dof + 1][2];
-
 	// Get the vector of positions of the surface
 	std::vector<std::vector<int>> surfaceIndices;
 	for (auto i = 0; i < My; i++) {
@@ -724,21 +731,11 @@ PetscMonitor3D::startStop(
 		surfaceIndices.push_back(temp);
 	}
 
-	// Open the existing HDF5 file.
-	io::XFile checkpointFile(
-		_hdf5OutputName, xolotlComm, io::XFile::AccessMode::OpenReadWrite);
-
 	// Get the current time step
 	double currentTimeStep;
 	ierr = TSGetTimeStep(ts, &currentTimeStep);
 	CHKERRQ(ierr);
 
-	// Add a concentration sub group
-	auto concGroup = checkpointFile.getGroup<io::XFile::ConcentrationGroup>();
-	assert(concGroup);
-	auto tsGroup = concGroup->addTimestepGroup(
-		_loopNumber, timestep, time, previousTime, currentTimeStep);
-
 	// Get the names of the species in the network
 	auto numSpecies = network.getSpeciesListSize();
 	std::vector<std::string> names;
@@ -746,76 +743,38 @@ PetscMonitor3D::startStop(
 		names.push_back(network.getSpeciesName(id));
 	}
 
-	if (_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1) {
-		// Write the surface positions and the associated interstitial
-		// quantities in the concentration sub group
-		tsGroup->writeSurface3D(
-			surfaceIndices, _nSurf, _previousSurfFlux, names);
+	// Copy the concentration values of the grid points we own
+	io::XFile::TimestepGroup::Concs1DType concs;
+	io::XFile::TimestepGroup::DenseConcsType denseConcs;
+	if (_denseConcs) {
+		denseConcs.reserve(xm * ym * zm * (dof + 1));
+		for (auto k = zs; k < zs + zm; k++) {
+			for (auto j = ys; j < ys + ym; j++) {
+				for (auto i = xs; i < xs + xm; i++) {
+					gridPointSolution = solutionArray[k][j][i];
+					denseConcs.insert(denseConcs.end(), gridPointSolution,
+						gridPointSolution + dof + 1);
+				}
+			}
+		}
 	}
-
-	// Write the bottom impurity information if the bottom is a free surface
-	if (_solverHandler->getRightOffset() == 1)
-		tsGroup->writeBottom3D(_nBulk, _previousBulkFlux, names);
-
-	// Write the bursting information if the bubble bursting is used
-	if (_solverHandler->burstBubbles())
-		tsGroup->writeBursting(_nHeliumBurst, _nDeuteriumBurst, _nTritiumBurst);
-
-	// Loop on the full grid
-	for (auto k = 0; k < Mz; k++) {
-		for (auto j = 0; j < My; j++) {
-			for (auto i = 0; i < Mx; i++) {
-				// Wait for all the processes
-				MPI_Barrier(xolotlComm);
-
-				// Size of the concentration that will be stored
-				int concSize = -1;
-				// To save which proc has the information
-				int concId = 0;
-				// To know which process should write
-				bool write = false;
-
-				// If it is the locally owned part of the grid
-				if (i >= xs && i < xs + xm && j >= ys && j < ys + ym &&
-					k >= zs && k < zs + zm) {
-					write = true;
-					// Get the pointer to the beginning of the solution data for
-					// this grid point
+	else {
+		concs.resize(xm * ym * zm);
+		for (auto k = zs; k < zs + zm; k++) {
+			for (auto j = ys; j < ys + ym; j++) {
+				for (auto i = xs; i < xs + xm; i++) {
+					// Get the pointer to the beginning of the solution data
+					// for this grid point
 					gridPointSolution = solutionArray[k][j][i];
 
-					// Loop on the concentrations
+					auto& pointConcs =
+						concs[((k - zs) * ym + (j - ys)) * xm + (i - xs)];
 					for (auto l = 0; l < dof + 1; l++) {
 						if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-							// Increase concSize
-							concSize++;
-							// Fill the concArray
-							concArray[concSize][0] = (double)l;
-							concArray[concSize][1] = gridPointSolution[l];
+							pointConcs.emplace_back(l, gridPointSolution[l]);
 						}
 					}
-
-					// Increase concSize one last time
-					concSize++;
-
-					// Save the procId
-					concId = procId;
 				}
-
-				// Get which processor will send the information
-				int concProc = 0;
-				MPI_Allreduce(
-					&concId, &concProc, 1, MPI_INT, MPI_SUM, xolotlComm);
-
-				// Broadcast the size
-				MPI_Bcast(&concSize, 1, MPI_INT, concProc, xolotlComm);
-
-				// Skip the grid point if the size is 0
-				if (concSize == 0)
-					continue;
-
-				// All processes create the dataset and fill it
-				tsGroup->writeConcentrationDataset(
-					concSize, concArray, write, i, j, k);
 			}
 		}
 	}
@@ -824,6 +783,106 @@ PetscMonitor3D::startStop(
 	ierr = DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray);
 	CHKERRQ(ierr);
 
+	// Write the copy of the data to the checkpoint file, possibly in the
+	// background while the solver carries on
+	bool writeSurface =
+		_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1;
+	bool writeBottom = _solverHandler->getRightOffset() == 1;
+	bool writeBursting = _solverHandler->burstBubbles();
+	submitCheckpoint(
+		[loop = _loopNumber, timestep, time, previousTime, currentTimeStep,
+			names = std::move(names), writeSurface,
+			surfaceIndices = std::move(surfaceIndices), nSurf = _nSurf,
+			surfFlux = _previousSurfFlux, writeBottom, nBulk = _nBulk,
+			bulkFlux = _previousBulkFlux, writeBursting, nHe = _nHeliumBurst,
+			nD = _nDeuteriumBurst, nT = _nTritiumBurst, procId, dof, xs, xm,
+			Mx, ys, ym, My, zs, zm, Mz, dense = _denseConcs,
+			concs = std::move(concs), denseConcs = std::move(denseConcs)](
+			io::XFile& checkpointFile, MPI_Comm comm) {
+			// Add a concentration sub group
+			auto concGroup =
+				checkpointFile.getGroup<io::XFile::ConcentrationGroup>();
+			assert(concGroup);
+			auto tsGroup = concGroup->addTimestepGroup(
+				loop, timestep, time, previousTime, currentTimeStep);
+
+			// Write the surface positions and the associated interstitial
+			// quantities in the concentration sub group
+			if (writeSurface)
+				tsGroup->writeSurface3D(
+					surfaceIndices, nSurf, surfFlux, names);
+
+			// Write the bottom impurity information if the bottom is a free
+			// surface
+			if (writeBottom)
+				tsGroup->writeBottom3D(nBulk, bulkFlux, names);
+
+			// Write the bursting information if the bubble bursting is used
+			if (writeBursting)
+				tsGroup->writeBursting(nHe, nD, nT);
+
+			// The dense layout is written with one collective write
+			if (dense) {
+				tsGroup->writeDenseConcentrations(checkpointFile, xs, xm, ys,
+					ym, zs, zm, dof + 1, denseConcs);
+				return;
+			}
+
+			// Create an array for the concentration
+			auto concArray = std::make_unique<double[][2]>(dof + 1);
+
+			// Loop on the full grid
+			for (auto k = 0; k < Mz; k++) {
+				for (auto j = 0; j < My; j++) {
+					for (auto i = 0; i < Mx; i++) {
+						// Wait for all the processes
+						MPI_Barrier(comm);
+
+						// Size of the concentration that will be stored
+						int concSize = 0;
+						// To save which proc has the information
+						int concId = 0;
+						// To know which process should write
+						bool write = false;
+
+						// If it is the locally owned part of the grid
+						if (i >= xs && i < xs + xm && j >= ys && j < ys + ym &&
+							k >= zs && k < zs + zm) {
+							write = true;
+							// Fill the concArray
+							auto localId =
+								((k - zs) * ym + (j - ys)) * xm + (i - xs);
+							auto& pointConcs = concs[localId];
+							concSize = pointConcs.size();
+							for (auto l = 0; l < concSize; l++) {
+								concArray[l][0] = (double)pointConcs[l].first;
+								concArray[l][1] = pointConcs[l].second;
+							}
+
+							// Save the procId
+							concId = procId;
+						}
+
+						// Get which processor will send the information
+						int concProc = 0;
+						MPI_Allreduce(
+							&concId, &concProc, 1, MPI_INT, MPI_SUM, comm);
+
+						// Broadcast the size
+						MPI_Bcast(&concSize, 1, MPI_INT, concProc, comm);
+
+						// Skip the grid point if the size is 0
+						if (concSize == 0)
+							continue;
+
+						// All processes create the dataset and fill it
+						tsGroup->writeConcentrationDataset(
+							concSize, concArray.get(), write, i, j, k);
+					}
+				}
+			}
+		});
+
 	PetscFunctionReturn(0);
 }
 
@@ -890,11 +949,8 @@ PetscMonitor3D::computeHeliumRetention(
 
 				double hx = grid[xi + 1] - grid[xi];
 
-				using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-					Kokkos::MemoryUnmanaged>;
-				auto hConcs = HostUnmanaged(gridPointSolution, dof);
-				auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-				deep_copy(dConcs, hConcs);
+				auto dConcs =
+					_solverHandler->getConcentrationsView(gridPointSolution);
 
 				// Get the total concentrations at this grid point
 				using Quant = core::network::IReactionNetwork::TotalQuantity;
@@ -1158,39 +1214,26 @@ PetscMonitor3D::computeHeliumRetention(
 		XOLOTL_LOG << ss.str();
 
 		// Uncomment to write the retention and the fluence in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", std::ios::app);
-		outputFile << time << ' ' << fluence[0] << " ";
-		for (auto i = 0; i < numSpecies; ++i) {
-			outputFile << totalConcData[i] << " ";
-		}
+		std::vector<double> row = {time, fluence[0]};
+		row.insert(row.end(), totalConcData.begin(), totalConcData.end());
 		if (_solverHandler->getRightOffset() == 1) {
-			for (auto i = 0; i < numSpecies; ++i) {
-				outputFile << totalBulk[i] << ' ';
-			}
+			row.insert(row.end(), totalBulk.begin(), totalBulk.end());
 		}
 		if (_solverHandler->getLeftOffset() == 1) {
-			for (auto i = 0; i < numSpecies; ++i) {
-				outputFile << totalSurf[i] << ' ';
-			}
+			row.insert(row.end(), totalSurf.begin(), totalSurf.end());
 		}
-		outputFile << _nHeliumBurst << " " << _nDeuteriumBurst << " "
-				   << _nTritiumBurst << std::endl;
-		outputFile.close();
+		row.insert(
+			row.end(), {_nHeliumBurst, _nDeuteriumBurst, _nTritiumBurst});
+		_timeSeries.addRow("retentionOut.txt", row);
 
 		if (_solverHandler->temporalFlux()) {
-			// Open an additional file that will keep the flux evolution
-			outputFile.open("instantFlux.txt", std::ios::app);
-			outputFile << time << " ";
+			// An additional file keeps the flux evolution
+			std::vector<double> fluxRow = {time};
 			// Get the flux information
 			auto instantFlux = fluxHandler->getInstantFlux(time);
-			// Loop on it
-			for (auto flux : instantFlux) {
-				outputFile << flux << " ";
-			}
-
-			outputFile << std::endl;
-			outputFile.close();
+			fluxRow.insert(
+				fluxRow.end(), instantFlux.begin(), instantFlux.end());
+			_timeSeries.addRow("instantFlux.txt", fluxRow);
 		}
 	}
 
@@ -1268,11 +1311,8 @@ PetscMonitor3D::computeXenonRetention(
 				// this grid point
 				gridPointSolution = solutionArray[zk][yj][xi];
 
-				using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-					Kokkos::MemoryUnmanaged>;
-				auto hConcs = HostUnmanaged(gridPointSolution, dof);
-				auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-				deep_copy(dConcs, hConcs);
+				auto dConcs =
+					_solverHandler->getConcentrationsView(gridPointSolution);
 
 				double hx = grid[xi + 1] - grid[xi];
 
@@ -1470,13 +1510,9 @@ PetscMonitor3D::computeXenonRetention(
 		}
 
 		// Uncomment to write the retention and the fluence in a file
-		std::ofstream outputFile;
-		outputFile.open("retentionOut.txt", std::ios::app);
-		outputFile << time << " " << totalConcData[0] << " "
-				   << totalConcData[2] / totalConcData[1] << " "
-				   << averagePartialRadius << " " << nXenon / surface
-				   << std::endl;
-		outputFile.close();
+		_timeSeries.addRow("retentionOut.txt",
+			{time, totalConcData[0], totalConcData[2] / totalConcData[1],
+				averagePartialRadius, nXenon / surface});
 	}
 
 	// Restore the solutionArray
@@ -1552,9 +1588,7 @@ PetscMonitor3D::eventFunction(
 	if (_solverHandler->moveSurface()) {
 		// Write the initial surface positions
 		if (procId == 0 and tsNumber == 0) {
-			std::ofstream outputFile;
-			outputFile.open("surface.txt", std::ios::app);
-			outputFile << time << " ";
+			std::vector<double> row = {time};
 
 			// Loop on the possible yj
 			for (auto yj = 0; yj < My; yj++) {
@@ -1562,12 +1596,12 @@ PetscMonitor3D::eventFunction(
 					// Get the position of the surface at yj, zk
 					auto surfacePos =
 						_solverHandler->getSurfacePosition(yj, zk);
-					outputFile << (double)yj * hy << " " << (double)zk * hz
-							   << " " << grid[surfacePos + 1] - grid[1] << " ";
+					row.insert(row.end(),
+						{(double)yj * hy, (double)zk * hz,
+							grid[surfacePos + 1] - grid[1]});
 				}
 			}
-			outputFile << std::endl;
-			outputFile.close();
+			_timeSeries.addRow("surface.txt", row);
 		}
 
 		// Loop on the possible zk and yj
@@ -1682,12 +1716,8 @@ PetscMonitor3D::eventFunction(
 						// for this grid point
 						gridPointSolution = solutionArray[zk][yj][xi];
 
-						using HostUnmanaged = Kokkos::View<double*,
-							Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-						auto hConcs = HostUnmanaged(gridPointSolution, dof);
 						auto dConcs =
-							Kokkos::View<double*>("Concentrations", dof);
-						deep_copy(dConcs, hConcs);
+							_solverHandler->getConcentrationsView(gridPointSolution);
 
 						// Get the distance from the surface
 						double distance = (grid[xi] + grid[xi + 1]) / 2.0 -
@@ -1988,21 +2018,19 @@ PetscMonitor3D::postEventFunction(TS ts, PetscInt nevents, PetscInt eventList[],
 
 	// Write the surface positions
 	if (procId == 0) {
-		std::ofstream outputFile;
-		outputFile.open("surface.txt", std::ios::app);
-		outputFile << time << " ";
+		std::vector<double> row = {time};
 
 		// Loop on the possible yj
 		for (auto yj = 0; yj < My; yj++) {
 			for (auto zk = 0; zk < Mz; zk++) {
 				// Get the position of the surface at yj, zk
 				auto surfacePos = _solverHandler->getSurfacePosition(yj, zk);
-				outputFile << (double)yj * hy << " " << (double)zk * hz << " "
-						   << grid[surfacePos + 1] - grid[1] << " ";
+				row.insert(row.end(),
+					{(double)yj * hy, (double)zk * hz,
+						grid[surfacePos + 1] - grid[1]});
 			}
 		}
-		outputFile << std::endl;
-		outputFile.close();
+		_timeSeries.addRow("surface.txt", row);
 	}
 
 	// Restore the solutionArray
@@ -28,9 +28,12 @@ getMPIComm();
 
 /**
  * Initialize MPI with const char array
+ *
+ * @param threadMultiple Whether to ask for full thread support (only needed
+ * to write the checkpoints in the background)
  */
 void
-mpiInit(int& argc, const char* argv[]);
+mpiInit(int& argc, const char* argv[], bool threadMultiple = false);
 
 /**
  * Has MPI been initialized